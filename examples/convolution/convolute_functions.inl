@@ -55,7 +55,11 @@
 #endif
 
 #if HYDRA_DEVICE_SYSTEM != CUDA
+#ifdef _FFTW_AVAILABLE_
 #include <hydra/FFTW.h>
+#else
+#include <hydra/NativeFFT.h>
+#endif //_FFTW_AVAILABLE_
 #endif
 
 
@@ -145,7 +149,11 @@ int main(int argv, char** argc)
 #endif
 
 #if HYDRA_DEVICE_SYSTEM!=CUDA
+#ifdef _FFTW_AVAILABLE_
 	auto fft_backend = hydra::fft::fftw_f64;
+#else
+	auto fft_backend = hydra::fft::native_f64;
+#endif //_FFTW_AVAILABLE_
 #endif
 
 	/*
@@ -166,6 +174,38 @@ int main(int argv, char** argc)
 	std::cout << "-----------------------------------------"<<std::endl;
 
 
+	/*
+	 * using a hydra::ConvolutionEngine, which keeps the FFT plans and the
+	 * kernel spectrum while only the signal parameters are changed
+	 */
+	hydra::ConvolutionEngine<decltype(fft_backend)> engine;
+
+	auto start_e = std::chrono::high_resolution_clock::now();
+
+	for(size_t i=0; i<10; i++){
+
+		signal.SetParameter("B", -2.0 + 0.1*i);
+
+		hydra::convolute(hydra::device::sys, engine,
+				signal, kernel, min, max,  conv_result, true);
+	}
+
+	signal.SetParameter("B", -2.0);
+
+	auto end_e = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_e = end_e - start_e;
+	//time
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| ConvolutionEngine: 10 calls"<<std::endl;
+	std::cout << "| Time per call (ms) ="<< elapsed_e.count()/10    <<std::endl;
+	std::cout << "| Kernel transforms  ="<< engine.GetNKernelTransforms() <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	// restore the result with the nominal parameters
+	hydra::convolute(hydra::device::sys, engine,
+			signal, kernel, min, max,  conv_result, true);
+
 	/*
 	 * using the hydra::ConvolutionFunctor
 	 */
@@ -0,0 +1,247 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * convolute_functions_batch.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef CONVOLUTE_FUNCTIONS_BATCH_INL_
+#define CONVOLUTE_FUNCTIONS_BATCH_INL_
+
+
+/**
+ * \example convolute_functions_batch.inl
+ *
+ * Convolution of many signal/resolution pairs, one per category, with the same number of samples.
+ * The batch is computed with a hydra::BatchConvolutionEngine and compared with
+ * one hydra::ConvolutionEngine call per category.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+#include <cmath>
+
+
+#include <hydra/Convolution.h>
+#include <hydra/ConvolutionEngine.h>
+#include <hydra/BatchConvolutionEngine.h>
+#include <hydra/functions/Gaussian.h>
+#include <hydra/functions/TrapezoidalShape.h>
+#include <hydra/device/System.h>
+
+//hydra
+#if HYDRA_DEVICE_SYSTEM == CUDA
+#include <hydra/CuFFT.h>
+#endif
+
+#if HYDRA_DEVICE_SYSTEM != CUDA
+#ifdef _FFTW_AVAILABLE_
+#include <hydra/FFTW.h>
+#else
+#include <hydra/NativeFFT.h>
+#endif //_FFTW_AVAILABLE_
+#endif
+
+
+//command line
+#include <tclap/CmdLine.h>
+
+
+int main(int argv, char** argc)
+{
+	size_t ncategories = 0;
+	size_t nsamples    = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> MArg("m", "number-of-categories","Number of convolutions in the batch", false, 64, "size_t");
+		cmd.add(MArg);
+
+		TCLAP::ValueArg<size_t> NArg("n", "number-of-samples","Number of samples of each convolution", false, 256, "size_t");
+		cmd.add(NArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		ncategories = MArg.getValue();
+		nsamples    = NArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+#if HYDRA_DEVICE_SYSTEM==CUDA
+	auto fft_backend = hydra::fft::cufft_f64;
+#endif
+
+#if HYDRA_DEVICE_SYSTEM!=CUDA
+#ifdef _FFTW_AVAILABLE_
+	auto fft_backend = hydra::fft::fftw_f64;
+#else
+	auto fft_backend = hydra::fft::native_f64;
+#endif //_FFTW_AVAILABLE_
+#endif
+
+	double min=-10.0;
+	double max= 10.0;
+
+	//===========================
+	// one trapezoidal signal and one Gaussian resolution per category
+	//---------------------------
+	typedef hydra::TrapezoidalShape<double> signal_type;
+	typedef hydra::Gaussian<double>         kernel_type;
+
+	std::vector<signal_type> signals;
+	std::vector<kernel_type> kernels;
+
+	for(size_t m=0; m<ncategories; m++)
+	{
+		auto A = hydra::Parameter::Create().Value(-5.0 + 0.01*m).Error(0.0001);
+		auto B = hydra::Parameter::Create().Value(-2.0).Error(0.0001);
+		auto C = hydra::Parameter::Create().Value( 2.0).Error(0.0001);
+		auto D = hydra::Parameter::Create().Value( 5.0 - 0.01*m).Error(0.0001);
+
+		signals.push_back( signal_type(A, B, C, D) );
+
+		auto mean  = hydra::Parameter::Create().Value(0.0).Error(0.0001);
+		auto sigma = hydra::Parameter::Create().Value(0.2 + 0.01*m).Error(0.0001);
+
+		kernels.push_back( kernel_type(mean, sigma) );
+	}
+
+	hydra::device::vector<double> batch_result(ncategories*nsamples);
+	hydra::device::vector<double> single_result(nsamples);
+
+	hydra::BatchConvolutionEngine<decltype(fft_backend)> batch_engine;
+	hydra::ConvolutionEngine<decltype(fft_backend)>           engine;
+
+	//===========================
+	// compare with one call per category
+	//---------------------------
+	batch_engine.Convolute(hydra::device::sys, signals, kernels, min, max, nsamples, batch_result);
+
+	double max_deviation = 0.0;
+
+	for(size_t m=0; m<ncategories; m++)
+	{
+		engine.Convolute(hydra::device::sys, signals[m], kernels[m], min, max, single_result, false);
+
+		for(size_t j=0; j<nsamples; j++)
+		{
+			double deviation = ::fabs(batch_result[m*nsamples + j] - single_result[j]);
+
+			max_deviation = deviation > max_deviation ? deviation : max_deviation;
+		}
+	}
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Batch of "<< ncategories << " convolutions with "<< nsamples << " samples" <<std::endl;
+	std::cout << "| Maximum deviation from the single calls: "<< max_deviation <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	//===========================
+	// same engine, twice the samples over twice the range:
+	// the sampling step is unchanged, but the kernel spectra are recomputed
+	//---------------------------
+	{
+		hydra::device::vector<double> batch_result_2(2*ncategories*nsamples);
+		hydra::device::vector<double> single_result_2(2*nsamples);
+
+		batch_engine.Convolute(hydra::device::sys, signals, kernels, 2*min, 2*max, 2*nsamples, batch_result_2);
+
+		double max_deviation_2 = 0.0;
+
+		for(size_t m=0; m<ncategories; m++)
+		{
+			engine.Convolute(hydra::device::sys, signals[m], kernels[m], 2*min, 2*max, single_result_2, false);
+
+			for(size_t j=0; j<2*nsamples; j++)
+			{
+				double deviation = ::fabs(batch_result_2[2*m*nsamples + j] - single_result_2[j]);
+
+				max_deviation_2 = deviation > max_deviation_2 ? deviation : max_deviation_2;
+			}
+		}
+
+		std::cout << "| Batch of "<< ncategories << " convolutions with "<< 2*nsamples << " samples, same engine" <<std::endl;
+		std::cout << "| Maximum deviation from the single calls: "<< max_deviation_2 <<std::endl;
+		std::cout << "| Batch kernel transforms: "<< batch_engine.GetNKernelTransforms() <<std::endl;
+		std::cout << "-----------------------------------------"<<std::endl;
+
+		// back to the original size, for the timing below
+		batch_engine.Convolute(hydra::device::sys, signals, kernels, min, max, nsamples, batch_result);
+	}
+
+	//===========================
+	// timing, moving the signals only: the kernel spectra are reused
+	//---------------------------
+	size_t niterations = 20;
+
+	auto start_s = std::chrono::high_resolution_clock::now();
+
+	for(size_t i=0; i<niterations; i++)
+		for(size_t m=0; m<ncategories; m++)
+		{
+			signals[m].SetParameter(1, -2.0 + 0.01*i);
+
+			engine.Convolute(hydra::device::sys, signals[m], kernels[m], min, max, single_result, false);
+		}
+
+	auto end_s = std::chrono::high_resolution_clock::now();
+
+	auto start_b = std::chrono::high_resolution_clock::now();
+
+	for(size_t i=0; i<niterations; i++)
+	{
+		for(size_t m=0; m<ncategories; m++)
+			signals[m].SetParameter(1, -2.0 + 0.01*i);
+
+		batch_engine.Convolute(hydra::device::sys, signals, kernels, min, max, nsamples, batch_result);
+	}
+
+	auto end_b = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_s = end_s - start_s;
+	std::chrono::duration<double, std::milli> elapsed_b = end_b - start_b;
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Time per update of all categories (ms)"<<std::endl;
+	std::cout << "| ConvolutionEngine, one call per category: "<< elapsed_s.count()/niterations <<std::endl;
+	std::cout << "| BatchConvolutionEngine:                   "<< elapsed_b.count()/niterations <<std::endl;
+	std::cout << "| Batch kernel transforms: "<< batch_engine.GetNKernelTransforms() <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	return 0;
+}
+
+
+#endif /* CONVOLUTE_FUNCTIONS_BATCH_INL_ */
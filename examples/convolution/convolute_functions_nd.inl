@@ -0,0 +1,277 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * convolute_functions_nd.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef CONVOLUTE_FUNCTIONS_ND_INL_
+#define CONVOLUTE_FUNCTIONS_ND_INL_
+
+
+/**
+ * \example convolute_functions_nd.inl
+ *
+ * Convolution of functors of two and three variables over regular grids. A two dimensional
+ * Gaussian signal is smeared with a correlated Gaussian resolution and the result, evaluated
+ * through a hydra::ConvolutionFunctorND, is compared with the analytical convolution.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+#include <array>
+#include <cmath>
+
+
+#include <hydra/Convolution.h>
+#include <hydra/ConvolutionEngine.h>
+#include <hydra/functions/Gaussian.h>
+#include <hydra/device/System.h>
+#include <hydra/functions/ConvolutionFunctorND.h>
+#include <hydra/Lambda.h>
+#include <hydra/FunctorArithmetic.h>
+
+//hydra
+#if HYDRA_DEVICE_SYSTEM == CUDA
+#include <hydra/CuFFT.h>
+#endif
+
+#if HYDRA_DEVICE_SYSTEM != CUDA
+#ifdef _FFTW_AVAILABLE_
+#include <hydra/FFTW.h>
+#else
+#include <hydra/NativeFFT.h>
+#endif //_FFTW_AVAILABLE_
+#endif
+
+
+//command line
+#include <tclap/CmdLine.h>
+
+declarg(xvar, double)
+declarg(yvar, double)
+declarg(zvar, double)
+
+using namespace hydra::arguments;
+
+int main(int argv, char** argc)
+{
+	size_t nsamples = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-samples","Number of samples per axis", false, 256, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nsamples = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+#if HYDRA_DEVICE_SYSTEM==CUDA
+	auto fft_backend = hydra::fft::cufft_f64;
+#endif
+
+#if HYDRA_DEVICE_SYSTEM!=CUDA
+#ifdef _FFTW_AVAILABLE_
+	auto fft_backend = hydra::fft::fftw_f64;
+#else
+	auto fft_backend = hydra::fft::native_f64;
+#endif //_FFTW_AVAILABLE_
+#endif
+
+	//===========================
+	// 2D: signal
+	//---------------------------
+	auto mean_x  = hydra::Parameter::Create("mean_x" ).Value( 0.5).Error(0.0001);
+	auto mean_y  = hydra::Parameter::Create("mean_y" ).Value(-1.0).Error(0.0001);
+	auto sigma_x = hydra::Parameter::Create("sigma_x").Value( 1.0).Error(0.0001);
+	auto sigma_y = hydra::Parameter::Create("sigma_y").Value( 1.5).Error(0.0001);
+
+	auto signal = hydra::Gaussian<xvar>(mean_x, sigma_x)*hydra::Gaussian<yvar>(mean_y, sigma_y);
+
+	//===========================
+	// 2D: correlated Gaussian resolution, normalized
+	//---------------------------
+	auto res_x = hydra::Parameter::Create("res_x").Value(0.5).Error(0.0001);
+	auto res_y = hydra::Parameter::Create("res_y").Value(0.8).Error(0.0001);
+	auto rho   = hydra::Parameter::Create("rho"  ).Value(0.4).Error(0.0001);
+
+	auto kernel = hydra::wrap_lambda( [] __hydra_dual__ (unsigned int npar, const hydra::Parameter* params, double dx, double dy)
+	{
+		double u = dx/params[0];
+		double v = dy/params[1];
+		double r = params[2];
+
+		return ::exp( -0.5*(u*u - 2.0*r*u*v + v*v)/(1.0 - r*r) )
+				/(2.0*PI*params[0]*params[1]*::sqrt(1.0 - r*r));
+
+	}, res_x, res_y, rho );
+
+	// analytical convolution: Gaussian with the covariances added
+	auto analytical = [&](double x, double y){
+
+		double sx2 = sigma_x.GetValue()*sigma_x.GetValue() + res_x.GetValue()*res_x.GetValue();
+		double sy2 = sigma_y.GetValue()*sigma_y.GetValue() + res_y.GetValue()*res_y.GetValue();
+		double cxy = rho.GetValue()*res_x.GetValue()*res_y.GetValue();
+		double det = sx2*sy2 - cxy*cxy;
+
+		double u = x - mean_x.GetValue();
+		double v = y - mean_y.GetValue();
+
+		return 2.0*PI*sigma_x.GetValue()*sigma_y.GetValue()
+				*::exp( -0.5*(sy2*u*u - 2.0*cxy*u*v + sx2*v*v)/det )/(2.0*PI*::sqrt(det));
+	};
+
+	std::array<double,2> min{-10.0, -10.0};
+	std::array<double,2> max{ 10.0,  10.0};
+	std::array<size_t,2> nbins{nsamples, nsamples};
+
+	/*
+	 * sampling the convolution on the grid with hydra::convolute
+	 */
+	hydra::device::vector<double> conv_result(nsamples*nsamples, 0.0);
+
+	auto start_d = std::chrono::high_resolution_clock::now();
+
+	hydra::convolute(hydra::device::sys, fft_backend, signal, kernel, min, max, nbins, conv_result);
+
+	auto end_d = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_d = end_d - start_d;
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| 2D grid "<< nsamples << "x"<< nsamples <<std::endl;
+	std::cout << "| Time (ms) ="<< elapsed_d.count()    <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	/*
+	 * hydra::ConvolutionFunctorND, evaluated at arbitrary points with hydra::spline2D
+	 */
+	auto convolution = hydra::make_convolution<xvar, yvar>( hydra::device::sys, fft_backend,
+			signal, kernel, min, max, nbins );
+
+	double max_deviation = 0.0;
+
+	for(double x = -4.0; x <= 5.0; x += 0.37)
+		for(double y = -6.0; y <= 4.0; y += 0.41)
+		{
+			double deviation = ::fabs(convolution(xvar(x), yvar(y)) - analytical(x, y));
+
+			max_deviation = deviation > max_deviation ? deviation : max_deviation;
+		}
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| ConvolutionFunctorND (2D)"<<std::endl;
+	std::cout << "| Value at the signal mean: "<< convolution(xvar(0.5), yvar(-1.0))
+			  << " (analytical: " << analytical(0.5, -1.0) << ")"  << std::endl;
+	std::cout << "| Maximum deviation from the analytical result: "<< max_deviation <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	/*
+	 * only the signal changes: the kernel spectrum is reused
+	 */
+	auto start_e = std::chrono::high_resolution_clock::now();
+
+	for(size_t i=0; i<10; i++){
+
+		convolution.SetParameter("mean_x", 0.5 + 0.1*i);
+		convolution.Update();
+	}
+
+	auto end_e = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_e = end_e - start_e;
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| ConvolutionFunctorND (2D): 10 updates of the signal"<<std::endl;
+	std::cout << "| Time per update (ms) ="<< elapsed_e.count()/10    <<std::endl;
+	std::cout << "| Kernel transforms  ="<< convolution.GetEngine()->GetNKernelTransforms() <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	convolution.Dispose();
+
+	//===========================
+	// 3D: Gaussian signal and resolution
+	//---------------------------
+	auto mean_z  = hydra::Parameter::Create("mean_z" ).Value(0.0).Error(0.0001);
+	auto sigma_z = hydra::Parameter::Create("sigma_z").Value(1.0).Error(0.0001);
+	auto res     = hydra::Parameter::Create("res"    ).Value(0.6).Error(0.0001);
+
+	auto signal_3d = hydra::Gaussian<xvar>(mean_z, sigma_z)*hydra::Gaussian<yvar>(mean_z, sigma_z)
+			*hydra::Gaussian<zvar>(mean_z, sigma_z);
+
+	auto kernel_3d = hydra::wrap_lambda( [] __hydra_dual__ (unsigned int npar, const hydra::Parameter* params,
+			double dx, double dy, double dz)
+	{
+		double s = params[0];
+
+		return ::exp( -0.5*(dx*dx + dy*dy + dz*dz)/(s*s) )/::pow(::sqrt(2.0*PI)*s, 3);
+
+	}, res );
+
+	size_t nsamples_3d = nsamples/4;
+
+	auto start_3d = std::chrono::high_resolution_clock::now();
+
+	auto convolution_3d = hydra::make_convolution<xvar, yvar, zvar>( hydra::device::sys, fft_backend,
+			signal_3d, kernel_3d, std::array<double,3>{-6.0, -6.0, -6.0}, std::array<double,3>{6.0, 6.0, 6.0},
+			std::array<size_t,3>{nsamples_3d, nsamples_3d, nsamples_3d} );
+
+	auto end_3d = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_3d = end_3d - start_3d;
+
+	// the variance of the result along each axis is sigma_z^2 + res^2
+	double s2 = sigma_z.GetValue()*sigma_z.GetValue() + res.GetValue()*res.GetValue();
+	double scale = ::pow(sigma_z.GetValue()*sigma_z.GetValue()/s2, 1.5);
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| 3D grid "<< nsamples_3d << "x"<< nsamples_3d << "x"<< nsamples_3d <<std::endl;
+	std::cout << "| Time (ms) ="<< elapsed_3d.count()    <<std::endl;
+	std::cout << "| Value at (0, 0, 0): "<< convolution_3d(xvar(0.0), yvar(0.0), zvar(0.0))
+			  << " (analytical: " << scale << ")"  << std::endl;
+	std::cout << "| Value at (1, -0.5, 0.7): "<< convolution_3d(xvar(1.0), yvar(-0.5), zvar(0.7))
+			  << " (analytical: " << scale*::exp(-0.5*(1.0 + 0.25 + 0.49)/s2) << ")"  << std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	convolution_3d.Dispose();
+
+	return 0;
+}
+
+
+#endif /* CONVOLUTE_FUNCTIONS_ND_INL_ */
@@ -61,7 +61,11 @@
 #endif
 
 #if HYDRA_DEVICE_SYSTEM != CUDA
+#ifdef _FFTW_AVAILABLE_
 #include <hydra/FFTW.h>
+#else
+#include <hydra/NativeFFT.h>
+#endif //_FFTW_AVAILABLE_
 #endif
 
 //functors
@@ -145,7 +149,11 @@ int main(int argv, char** argc)
 #endif
 
 #if HYDRA_DEVICE_SYSTEM!=CUDA
+#ifdef _FFTW_AVAILABLE_
 	auto fft_backend = hydra::fft::fftw_f64;
+#else
+	auto fft_backend = hydra::fft::native_f64;
+#endif //_FFTW_AVAILABLE_
 #endif
 
 	auto convolution_signal = hydra::make_convolution<xvar>( hydra::device::sys, fft_backend, bw_signal, gaussian_kernel, min, max,10112);
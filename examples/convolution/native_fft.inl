@@ -0,0 +1,285 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * native_fft.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef NATIVE_FFT_INL_
+#define NATIVE_FFT_INL_
+
+
+/**
+ * \example native_fft.inl
+ *
+ * Benchmarks the header-only FFT back-end, timing real-to-complex plus complex-to-real
+ * round trips for sizes from 2^min to 2^max and checking the round trip and, if FFTW is available,
+ * the spectra against FFTW. The spectra of a few small sizes, covering the radix-2, mixed radix
+ * and Bluestein code paths, are also checked against a direct O(n^2) DFT.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+#include <cmath>
+
+//hydra
+#include <hydra/NativeFFT.h>
+#include <hydra/device/System.h>
+#include <hydra/Complex.h>
+#include <hydra/Random.h>
+
+#ifdef _FFTW_AVAILABLE_
+#include <hydra/FFTW.h>
+#endif //_FFTW_AVAILABLE_
+
+//command line
+#include <tclap/CmdLine.h>
+
+
+typedef double FloatType;
+
+/*
+ * time per round trip, in microseconds, of `ntrials` real-to-complex plus complex-to-real transforms
+ */
+template<typename R2C, typename C2R>
+double round_trip(R2C& fft_r2c, C2R& fft_c2r, std::vector<FloatType> const& x, size_t ntrials)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for(size_t i=0; i<ntrials; i++){
+
+		fft_r2c.LoadInputData(x.size(), x.data());
+		fft_r2c.Execute();
+
+		auto r2c_out = fft_r2c.GetOutputData();
+
+		fft_c2r.LoadInputData(r2c_out.second, r2c_out.first);
+		fft_c2r.Execute();
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::micro> elapsed = end - start;
+
+	return elapsed.count()/ntrials;
+}
+
+/*
+ * maximum deviation, relative to the largest bin, between the spectrum of the real-to-complex
+ * transform of `x` and the direct DFT  X_k = sum_j x_j exp(-2 pi i j k/n), for k = 0, ..., n/2
+ */
+template<typename R2C>
+double direct_dft_deviation(R2C& fft_r2c, std::vector<FloatType> const& x)
+{
+	size_t n = x.size();
+
+	fft_r2c.LoadInputData(n, x.data());
+	fft_r2c.Execute();
+
+	auto r2c_out = fft_r2c.GetOutputData();
+
+	double max_diff = 0.0;
+	double max_abs  = 0.0;
+
+	for(size_t k=0; k<size_t(r2c_out.second); k++){
+
+		long double re = 0.0;
+		long double im = 0.0;
+
+		for(size_t j=0; j<n; j++){
+
+			// reduce j*k modulo n before computing the angle to keep the twiddles exact
+			long double angle = -2.0L*M_PI*((j*k)%n)/n;
+
+			re += x[j]*std::cos(angle);
+			im += x[j]*std::sin(angle);
+		}
+
+		auto bin = r2c_out.first.get()[k];
+
+		max_diff = std::max(max_diff, double(std::hypot(bin.real() - re, bin.imag() - im)));
+		max_abs  = std::max(max_abs , double(std::hypot(re, im)));
+	}
+
+	return max_diff/max_abs;
+}
+
+int main(int argv, char** argc)
+{
+	size_t min_log2 = 0;
+	size_t max_log2 = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> MinArg("m", "min-log2","Log2 of the smallest transform size", false, 10, "size_t");
+		cmd.add(MinArg);
+
+		TCLAP::ValueArg<size_t> MaxArg("M", "max-log2","Log2 of the largest transform size", false, 22, "size_t");
+		cmd.add(MaxArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		min_log2 = MinArg.getValue();
+		max_log2 = MaxArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	hydra::default_random_engine engine(0x9d5b1a07);
+	hydra::thrust::uniform_real_distribution<FloatType> uniform(-1.0, 1.0);
+
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+	std::cout << " log2(n)  native (us)  round-trip error"
+#ifdef _FFTW_AVAILABLE_
+	          << "   FFTW (us)   max|native - FFTW|/max|FFTW|"
+#endif //_FFTW_AVAILABLE_
+	          << std::endl;
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+
+	for(size_t p = min_log2; p <= max_log2; p++){
+
+		int nsamples = 1 << p;
+
+		// about 2^24 points transformed for each size
+		size_t ntrials = nsamples < (1 << 24) ? (size_t(1) << 24)/nsamples : 1;
+
+		std::vector<FloatType> x(nsamples);
+
+		for(auto& xi: x) xi = uniform(engine);
+
+		auto native_r2c = hydra::RealToComplexNativeFFT<FloatType>( nsamples );
+		auto native_c2r = hydra::ComplexToRealNativeFFT<FloatType>( nsamples );
+
+		double native_time = round_trip(native_r2c, native_c2r, x, ntrials);
+
+		// the transforms are not normalized
+		double error = 0.0;
+
+		auto c2r_out = native_c2r.GetOutputData();
+
+		for(int i=0; i<nsamples; i++)
+			error = std::max(error, std::fabs(c2r_out.first.get()[i]/nsamples - x[i]) );
+
+		std::cout << std::setw(8) << p
+		          << std::setw(13) << native_time
+		          << std::setw(18) << error;
+
+#ifdef _FFTW_AVAILABLE_
+
+		auto fftw_r2c = hydra::RealToComplexFFTW<FloatType>( nsamples );
+		auto fftw_c2r = hydra::ComplexToRealFFTW<FloatType>( nsamples );
+
+		double fftw_time = round_trip(fftw_r2c, fftw_c2r, x, ntrials);
+
+		auto native_out = native_r2c.GetOutputData();
+		auto fftw_out   = fftw_r2c.GetOutputData();
+
+		double max_diff = 0.0;
+		double max_abs  = 0.0;
+
+		for(int k=0; k<fftw_out.second; k++){
+
+			max_diff = std::max(max_diff, double(hydra::abs(native_out.first.get()[k] - fftw_out.first.get()[k])));
+			max_abs  = std::max(max_abs , double(hydra::abs(fftw_out.first.get()[k])));
+		}
+
+		std::cout << std::setw(12) << fftw_time
+		          << std::setw(18) << max_diff/max_abs;
+
+#endif //_FFTW_AVAILABLE_
+
+		std::cout << std::endl;
+	}
+
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+
+	/*
+	 * sizes that are not powers of two: mixed radix and Bluestein (prime factors above 13)
+	 */
+	std::cout << " n        native (us)  round-trip error" << std::endl;
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+
+	for(int nsamples : {1000, 3*5*7*11*13, 4099, 65537, 1000000} ){
+
+		size_t ntrials = (size_t(1) << 22)/nsamples + 1;
+
+		std::vector<FloatType> x(nsamples);
+
+		for(auto& xi: x) xi = uniform(engine);
+
+		auto native_r2c = hydra::RealToComplexNativeFFT<FloatType>( nsamples );
+		auto native_c2r = hydra::ComplexToRealNativeFFT<FloatType>( nsamples );
+
+		double native_time = round_trip(native_r2c, native_c2r, x, ntrials);
+
+		double error = 0.0;
+
+		auto c2r_out = native_c2r.GetOutputData();
+
+		for(int i=0; i<nsamples; i++)
+			error = std::max(error, std::fabs(c2r_out.first.get()[i]/nsamples - x[i]) );
+
+		std::cout << std::setw(8) << std::left << nsamples << std::right
+				  << std::setw(13) << native_time
+				  << std::setw(18) << error << std::endl;
+	}
+
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+
+	/*
+	 * spectra against the direct DFT: radix-2, mixed radix, primes and a size with
+	 * two prime factors above 13, the last three going through Bluestein
+	 */
+	std::cout << " n        max|native - DFT|/max|DFT|" << std::endl;
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+
+	for(int nsamples : {256, 360, 1001, 97, 2*17*19, 4099} ){
+
+		std::vector<FloatType> x(nsamples);
+
+		for(auto& xi: x) xi = uniform(engine);
+
+		auto native_r2c = hydra::RealToComplexNativeFFT<FloatType>( nsamples );
+
+		std::cout << std::setw(8) << std::left << nsamples << std::right
+				  << std::setw(18) << direct_dft_deviation(native_r2c, x) << std::endl;
+	}
+
+	std::cout << "-------------------------------------------------------------------------------" << std::endl;
+
+	return 0;
+}
+
+#endif /* NATIVE_FFT_INL_ */
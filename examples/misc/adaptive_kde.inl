@@ -0,0 +1,178 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * adaptive_kde.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef ADAPTIVE_KDE_INL_
+#define ADAPTIVE_KDE_INL_
+
+
+/**
+ * \example adaptive_kde.inl
+ *
+ * Two-dimensional kernel density estimates of a narrow peak over a broad background,
+ * with fixed and adaptive (Abramson) bandwidths, compared with the density of the sample.
+ * The adaptive estimate is then normalized analytically in a hydra::Pdf.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <array>
+#include <cmath>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/Function.h>
+#include <hydra/Random.h>
+#include <hydra/Zip.h>
+#include <hydra/Pdf.h>
+#include <hydra/functions/Gaussian.h>
+#include <hydra/functions/KDE.h>
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", false, 1e6, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	//half of the events in a peak of widths (0.5, 0.25), half in a background of width 3
+	auto peak_x       = hydra::Gaussian<double>(hydra::Parameter::Create().Value(0.0), hydra::Parameter::Create().Value(0.5));
+	auto peak_y       = hydra::Gaussian<double>(hydra::Parameter::Create().Value(0.0), hydra::Parameter::Create().Value(0.25));
+	auto background_x = hydra::Gaussian<double>(hydra::Parameter::Create().Value(0.0), hydra::Parameter::Create().Value(3.0));
+	auto background_y = hydra::Gaussian<double>(hydra::Parameter::Create().Value(0.0), hydra::Parameter::Create().Value(3.0));
+
+	auto density = [](double x, double y){
+
+		double peak       = ::exp(-0.5*(x*x/0.25 + y*y/0.0625))/(2.0*PI*0.5*0.25);
+		double background = ::exp(-0.5*(x*x + y*y)/9.0)/(2.0*PI*9.0);
+
+		return 0.5*(peak + background);
+	};
+
+	hydra::device::vector<double> x(nentries);
+	hydra::device::vector<double> y(nentries);
+
+	size_t npeak = nentries/2;
+
+	hydra::fill_random(x.begin(), x.begin() + npeak, peak_x, 0x1b873593);
+	hydra::fill_random(y.begin(), y.begin() + npeak, peak_y, 0xcc9e2d51);
+	hydra::fill_random(x.begin() + npeak, x.end(), background_x, 0x85ebca6b);
+	hydra::fill_random(y.begin() + npeak, y.end(), background_y, 0xc2b2ae35);
+
+	auto points = hydra::zip(x, y);
+
+	std::array<double, 2> min{-10.0, -10.0};
+	std::array<double, 2> max{ 10.0,  10.0};
+	std::array<size_t, 2> nbins{256, 256};
+
+	//===========================
+	// fixed and adaptive estimates, with the same global bandwidths
+	//---------------------------
+	typedef hydra::KDE<2, hydra::device::sys_t, double, double> kde_type;
+
+	std::array<double, 2> h = kde_type::Bandwidth(hydra::Silverman, points.begin(), points.end());
+
+	auto start_f = std::chrono::high_resolution_clock::now();
+
+	auto fixed = hydra::make_kde<double, double>(hydra::device::sys, min, max, nbins, h, points, 0.0, true);
+
+	auto end_f = std::chrono::high_resolution_clock::now();
+
+	auto start_a = std::chrono::high_resolution_clock::now();
+
+	auto adaptive = hydra::make_kde<double, double>(hydra::device::sys, min, max, nbins, h, points, 0.5, true);
+
+	auto end_a = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_f = end_f - start_f;
+	std::chrono::duration<double, std::milli> elapsed_a = end_a - start_a;
+
+	//integrated squared errors over [-6, 6]^2
+	double ise_fixed = 0.0, ise_adaptive = 0.0;
+	double step = 0.02;
+
+	for(size_t i=0; i<600; i++)
+		for(size_t j=0; j<600; j++)
+		{
+			double u = -6.0 + (i + 0.5)*step;
+			double v = -6.0 + (j + 0.5)*step;
+			double f = density(u, v);
+
+			ise_fixed    += (fixed(u, v) - f)*(fixed(u, v) - f)*step*step;
+			ise_adaptive += (adaptive(u, v) - f)*(adaptive(u, v) - f)*step*step;
+		}
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Sample size: " << nentries << ", global bandwidths: " << h[0] << ", " << h[1] <<std::endl;
+	std::cout << "| Fixed bandwidth,    time (ms): " << elapsed_f.count() << ", ISE: " << ise_fixed <<std::endl;
+	std::cout << "| Adaptive bandwidth, time (ms): " << elapsed_a.count() << ", ISE: " << ise_adaptive <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	//===========================
+	// analytically normalized pdf in [-1, 1]^2
+	//---------------------------
+	double lower[2]{-1.0, -1.0};
+	double upper[2]{ 1.0,  1.0};
+
+	auto pdf = hydra::make_pdf(adaptive, hydra::AnalyticalIntegral<kde_type, 2>(lower, upper));
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Fraction of the estimate in [-1, 1]^2: " << pdf.GetNorm() <<std::endl;
+	std::cout << "| Whole grid: " << adaptive.Integral(min, max) <<std::endl;
+	std::cout << "| Normalized pdf at (0, 0): " << pdf(0.0, 0.0) <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	fixed.Dispose();
+	adaptive.Dispose();
+
+	return 0;
+}
+
+
+#endif /* ADAPTIVE_KDE_INL_ */
@@ -0,0 +1,192 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * gaussian_kde.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef GAUSSIAN_KDE_INL_
+#define GAUSSIAN_KDE_INL_
+
+
+/**
+ * \example gaussian_kde.inl
+ *
+ * Gaussian kernel density estimate of a two-component Gaussian sample.
+ * The bandwidth is chosen with the Silverman and Sheather-Jones rules and the
+ * binned (linear binning + FFT) construction is compared with the direct one
+ * and with the density of the sample.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <cmath>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/Function.h>
+#include <hydra/Random.h>
+#include <hydra/functions/Gaussian.h>
+#include <hydra/functions/GaussianKDE.h>
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", false, 10e6, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	double min = -5.0;
+	double max =  5.0;
+
+	//two thirds N(0,1), one third N(2.5,0.5)
+	auto gauss1 = hydra::Gaussian<double>(hydra::Parameter::Create().Value(0.0), hydra::Parameter::Create().Value(1.0));
+	auto gauss2 = hydra::Gaussian<double>(hydra::Parameter::Create().Value(2.5), hydra::Parameter::Create().Value(0.5));
+
+	auto density = [](double x){
+
+		double u1 = x;
+		double u2 = (x - 2.5)/0.5;
+
+		return hydra::math_constants::inverse_sqrt2Pi*( 2.0*::exp(-0.5*u1*u1) + ::exp(-0.5*u2*u2)/0.5 )/3.0;
+	};
+
+	hydra::device::vector<double> data(nentries);
+
+	size_t nfirst = 2*nentries/3;
+
+	hydra::fill_random(data.begin(), data.begin() + nfirst, gauss1, 0x8ec74d);
+	hydra::fill_random(data.begin() + nfirst, data.end(), gauss2, 0x3a9c51);
+
+	//===========================
+	// automatic bandwidths
+	//---------------------------
+	typedef hydra::GaussianKDE<4096, double> kde_type;
+
+	double h_silverman = kde_type::Bandwidth(hydra::Silverman,     data.begin(), data.end());
+	double h_sj        = kde_type::Bandwidth(hydra::SheatherJones, data.begin(), data.end());
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Sample size: " << nentries <<std::endl;
+	std::cout << "| Silverman bandwidth:      " << h_silverman <<std::endl;
+	std::cout << "| Sheather-Jones bandwidth: " << h_sj <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	//===========================
+	// binned KDE of the full sample
+	//---------------------------
+	auto start_b = std::chrono::high_resolution_clock::now();
+
+	kde_type kde(min, max, hydra::SheatherJones, data.begin(), data.end());
+
+	auto end_b = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_b = end_b - start_b;
+
+	double max_deviation = 0.0;
+
+	for(size_t i=0; i<1000; i++)
+	{
+		double x = -4.0 + i*0.008;
+		double deviation = ::fabs(kde(x) - density(x));
+
+		max_deviation = deviation > max_deviation ? deviation : max_deviation;
+	}
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Binned KDE, 4096 knots, bandwidth selection included" <<std::endl;
+	std::cout << "| Time (ms): " << elapsed_b.count() <<std::endl;
+	std::cout << "| Maximum deviation from the density in [-4, 4]: " << max_deviation <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	//===========================
+	// binned versus direct construction on a subsample,
+	// the leading events, drawn from the first component
+	//---------------------------
+	size_t nsubsample = nentries < 100000 ? nentries : 100000;
+
+	hydra::device::vector<double> subsample(data.begin(), data.begin() + nsubsample);
+
+	typedef hydra::GaussianKDE<1024, double> small_kde_type;
+
+	double h = small_kde_type::Bandwidth(hydra::SheatherJones, subsample.begin(), subsample.end());
+
+	auto start_d = std::chrono::high_resolution_clock::now();
+
+	small_kde_type direct(min, max, h, subsample.begin(), subsample.end());
+
+	auto end_d = std::chrono::high_resolution_clock::now();
+
+	auto start_s = std::chrono::high_resolution_clock::now();
+
+	small_kde_type binned(min, max, h, subsample.begin(), subsample.end(), true);
+
+	auto end_s = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_d = end_d - start_d;
+	std::chrono::duration<double, std::milli> elapsed_s = end_s - start_s;
+
+	max_deviation = 0.0;
+
+	for(size_t i=0; i<1024; i++)
+	{
+		double deviation = ::fabs(direct.GetD()[i] - binned.GetD()[i]);
+
+		max_deviation = deviation > max_deviation ? deviation : max_deviation;
+	}
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| KDE of "<< nsubsample << " events, 1024 knots, h = " << h <<std::endl;
+	std::cout << "| Direct construction time (ms): " << elapsed_d.count() <<std::endl;
+	std::cout << "| Binned construction time (ms): " << elapsed_s.count() <<std::endl;
+	std::cout << "| Maximum deviation between the knots: " << max_deviation <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	return 0;
+}
+
+
+#endif /* GAUSSIAN_KDE_INL_ */
@@ -0,0 +1,187 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * spline_batch.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SPLINE_BATCH_INL_
+#define SPLINE_BATCH_INL_
+
+
+/**
+ * \example spline_batch.inl
+ *
+ * Evaluation of a Steffen spline of a Breit-Wigner line shape, tabulated on 10^5
+ * nonuniform knots denser around the peak, over a large sample of points.
+ * The points are evaluated one by one with hydra::SplineTableFunctor, which searches
+ * the interval of each point, and with the batch interface hydra::spline(first, last,
+ * measurements, begin, end, result, sort), which locates sorted points incrementally,
+ * for unsorted, sorted by the batch interface and presorted points.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <cmath>
+#include <array>
+#include <vector>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/Function.h>
+#include <hydra/Random.h>
+#include <hydra/Spline.h>
+#include <hydra/functions/UniformShape.h>
+#include <hydra/functions/SplineTableFunctor.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/sort.h>
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", false, 10e6, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	double mass  = 3.097;
+	double width = 0.0093;
+
+	auto breit_wigner = [mass, width](double m){
+
+		return 1.0/( (m*m - mass*mass)*(m*m - mass*mass) + mass*mass*width*width );
+	};
+
+	//10^5 knots in [2.5, 3.7], denser around the peak
+	size_t nknots = 100000;
+
+	std::vector<double> knots(nknots), values(nknots);
+
+	for(size_t i=0; i<nknots; i++){
+
+		double t = 2.0*i/(nknots - 1) - 1.0;
+
+		knots[i]  = mass + (t < 0 ? 0.597 : 0.603)*t*t*t;
+		values[i] = breit_wigner(knots[i]);
+	}
+
+	hydra::device::vector<double> knots_d(knots.begin(), knots.end());
+	hydra::device::vector<double> values_d(values.begin(), values.end());
+
+	auto table = hydra::make_spline_table<double>(hydra::device::sys, knots, values);
+
+	hydra::device::vector<double> masses(nentries), sorted_masses(nentries);
+
+	hydra::fill_random(masses.begin(), masses.end(), hydra::UniformShape<double>(2.5, 3.7), 0x5d1f27);
+
+	hydra::thrust::copy(masses.begin(), masses.end(), sorted_masses.begin());
+	hydra::thrust::sort(sorted_masses.begin(), sorted_masses.end());
+
+	hydra::device::vector<double> r_point(nentries), r_batch(nentries);
+
+	auto time = [](auto&& task){
+
+		auto start = std::chrono::high_resolution_clock::now();
+		task();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	};
+
+	auto max_deviation = [&](){
+
+		std::vector<double> a(r_point.begin(), r_point.end()), b(r_batch.begin(), r_batch.end());
+
+		double m = 0.0;
+		for(size_t i=0; i<a.size(); i++) m = std::max(m, ::fabs(a[i] - b[i])/a[i]);
+
+		return m;
+	};
+
+	//===========================
+	// unsorted points
+	//---------------------------
+	double t_point = time([&](){
+		hydra::thrust::transform(hydra::device::sys, masses.begin(), masses.end(), r_point.begin(), table); });
+
+	double t_batch = time([&](){
+		hydra::spline(knots_d.begin(), knots_d.end(), values_d.begin(), masses.begin(), masses.end(), r_batch.begin()); });
+
+	double t_sort = time([&](){
+		hydra::spline(knots_d.begin(), knots_d.end(), values_d.begin(), masses.begin(), masses.end(), r_batch.begin(), true); });
+
+	double deviation = max_deviation();
+
+	//===========================
+	// presorted points
+	//---------------------------
+	double t_point_sorted = time([&](){
+		hydra::thrust::transform(hydra::device::sys, sorted_masses.begin(), sorted_masses.end(), r_point.begin(), table); });
+
+	double t_batch_sorted = time([&](){
+		hydra::spline(knots_d.begin(), knots_d.end(), values_d.begin(), sorted_masses.begin(), sorted_masses.end(), r_batch.begin()); });
+
+	double deviation_sorted = max_deviation();
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Evaluations: " << nentries << ", knots: " << nknots <<std::endl;
+	std::cout << "| Unsorted points" <<std::endl;
+	std::cout << "|   Point by point time (ms):    " << t_point <<std::endl;
+	std::cout << "|   Batch time (ms):             " << t_batch <<std::endl;
+	std::cout << "|   Batch, sorting time (ms):    " << t_sort <<std::endl;
+	std::cout << "|   Maximum relative deviation:  " << deviation <<std::endl;
+	std::cout << "| Presorted points" <<std::endl;
+	std::cout << "|   Point by point time (ms):    " << t_point_sorted <<std::endl;
+	std::cout << "|   Batch time (ms):             " << t_batch_sorted <<std::endl;
+	std::cout << "|   Maximum relative deviation:  " << deviation_sorted <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	table.Dispose();
+
+	return 0;
+}
+
+
+#endif /* SPLINE_BATCH_INL_ */
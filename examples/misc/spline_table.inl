@@ -0,0 +1,188 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * spline_table.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SPLINE_TABLE_INL_
+#define SPLINE_TABLE_INL_
+
+
+/**
+ * \example spline_table.inl
+ *
+ * Steffen splines of a Gaussian in one and two dimensions, evaluated with
+ * hydra::SplineFunctor and hydra::Spline2DFunctor, which compute the slopes and
+ * coefficients of the interval at each call, and with hydra::SplineTableFunctor,
+ * which looks up the precomputed coefficients. The timings and the maximum
+ * deviation between both are printed.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <cmath>
+#include <array>
+#include <vector>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/Function.h>
+#include <hydra/Random.h>
+#include <hydra/functions/UniformShape.h>
+#include <hydra/functions/SplineFunctor.h>
+#include <hydra/functions/Spline2DFunctor.h>
+#include <hydra/functions/SplineTableFunctor.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", false, 10e6, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	auto gaussian = [](double x){ return ::exp(-0.5*x*x/9.0); };
+
+	//grid of 1000 x 800 nodes in [-10, 10]x[-10, 10]
+	size_t nx = 1000, ny = 800;
+
+	std::array<std::vector<double>, 2> nodes{ std::vector<double>(nx), std::vector<double>(ny) };
+	std::vector<double> values(nx*ny);
+
+	for(size_t i=0; i<nx; i++) nodes[0][i] = -10.0 + 20.0*i/(nx - 1);
+	for(size_t j=0; j<ny; j++) nodes[1][j] = -10.0 + 20.0*j/(ny - 1);
+
+	for(size_t j=0; j<ny; j++)
+		for(size_t i=0; i<nx; i++)
+			values[j*nx + i] = gaussian(nodes[0][i])*gaussian(nodes[1][j]);
+
+	std::vector<double> values_x(values.begin(), values.begin() + nx);
+
+	hydra::device::vector<double> x_d(nodes[0].begin(), nodes[0].end());
+	hydra::device::vector<double> y_d(nodes[1].begin(), nodes[1].end());
+	hydra::device::vector<double> z_d(values.begin(), values.end());
+	hydra::device::vector<double> zx_d(values_x.begin(), values_x.end());
+
+	//per call splines
+	auto spline1D = hydra::make_spline<double>(x_d, zx_d);
+	auto spline2D = hydra::make_spline2D<double, double>(x_d, y_d, z_d);
+
+	//precomputed coefficients
+	auto table1D = hydra::make_spline_table<double>(hydra::device::sys, nodes[0], values_x);
+	auto table2D = hydra::make_spline_table<double, double>(hydra::device::sys, nodes, values);
+
+	//points away from the last interval of each axis, where the per call splines read past the nodes
+	hydra::device::vector<double> px(nentries), py(nentries);
+
+	hydra::fill_random(px.begin(), px.end(), hydra::UniformShape<double>(nodes[0][1], nodes[0][nx-3]), 0x7b3f91);
+	hydra::fill_random(py.begin(), py.end(), hydra::UniformShape<double>(nodes[1][1], nodes[1][ny-3]), 0x51c2e8);
+
+	hydra::device::vector<double> r_call(nentries), r_table(nentries);
+
+	auto time = [](auto&& task){
+
+		auto start = std::chrono::high_resolution_clock::now();
+		task();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	};
+
+	auto max_deviation = [&](){
+
+		std::vector<double> a(r_call.begin(), r_call.end()), b(r_table.begin(), r_table.end());
+
+		double m = 0.0;
+		for(size_t i=0; i<a.size(); i++) m = std::max(m, ::fabs(a[i] - b[i]));
+
+		return m;
+	};
+
+	//===========================
+	// one dimension
+	//---------------------------
+	double t_call_1D = time([&](){
+		hydra::thrust::transform(hydra::device::sys, px.begin(), px.end(), r_call.begin(), spline1D); });
+
+	double t_table_1D = time([&](){
+		hydra::thrust::transform(hydra::device::sys, px.begin(), px.end(), r_table.begin(), table1D); });
+
+	double deviation_1D = max_deviation();
+
+	//===========================
+	// two dimensions
+	//---------------------------
+	double t_call_2D = time([&](){
+		hydra::thrust::transform(hydra::device::sys, px.begin(), px.end(), py.begin(), r_call.begin(),
+				[spline2D] __hydra_dual__ (double x, double y){ return spline2D(x, y); }); });
+
+	double t_table_2D = time([&](){
+		hydra::thrust::transform(hydra::device::sys, px.begin(), px.end(), py.begin(), r_table.begin(),
+				[table2D] __hydra_dual__ (double x, double y){ return table2D(x, y); }); });
+
+	double deviation_2D = max_deviation();
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Evaluations: " << nentries <<std::endl;
+	std::cout << "| 1D, " << nx << " nodes" <<std::endl;
+	std::cout << "|   SplineFunctor time (ms):      " << t_call_1D <<std::endl;
+	std::cout << "|   SplineTableFunctor time (ms): " << t_table_1D <<std::endl;
+	std::cout << "|   Maximum deviation:            " << deviation_1D <<std::endl;
+	std::cout << "| 2D, " << nx << " x " << ny << " nodes" <<std::endl;
+	std::cout << "|   Spline2DFunctor time (ms):    " << t_call_2D <<std::endl;
+	std::cout << "|   SplineTableFunctor time (ms): " << t_table_2D <<std::endl;
+	std::cout << "|   Maximum deviation:            " << deviation_2D <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	table1D.Dispose();
+	table2D.Dispose();
+
+	return 0;
+}
+
+
+#endif /* SPLINE_TABLE_INL_ */
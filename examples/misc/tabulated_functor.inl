@@ -0,0 +1,185 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * tabulated_functor.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef TABULATED_FUNCTOR_INL_
+#define TABULATED_FUNCTOR_INL_
+
+
+/**
+ * \example tabulated_functor.inl
+ *
+ * An Ipatia line shape, which involves Bessel functions, is served from a
+ * spline table with hydra::TabulatedFunctor. The evaluation time over a sample,
+ * the deviation from the exact line shape, the integral and the retabulation
+ * after a change of parameters are compared.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/Function.h>
+#include <hydra/Random.h>
+#include <hydra/GaussKronrodQuadrature.h>
+#include <hydra/functions/Ipatia.h>
+#include <hydra/functions/UniformShape.h>
+#include <hydra/functions/TabulatedFunctor.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", false, 10e6, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	double min = 5.20;
+	double max = 5.30;
+
+	auto mu    = hydra::Parameter::Create().Value(5.28);
+	auto sigma = hydra::Parameter::Create().Value(0.0026);
+	auto L1    = hydra::Parameter::Create().Value(0.5);
+	auto N1    = hydra::Parameter::Create().Value(2.0);
+	auto L2    = hydra::Parameter::Create().Value(1.2);
+	auto N2    = hydra::Parameter::Create().Value(9.5);
+	auto alfa  = hydra::Parameter::Create().Value(-6.5);
+	auto beta  = hydra::Parameter::Create().Value(1.0);
+
+	hydra::Ipatia<double> ipatia(mu, sigma, L1, N1, L2, N2, alfa, beta);
+
+	//===========================
+	// tabulation
+	//---------------------------
+	auto start_t = std::chrono::high_resolution_clock::now();
+
+	auto tabulated = hydra::make_tabulated<double>(hydra::device::sys, ipatia, min, max, 4096, 1.0e-4);
+
+	auto end_t = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_t = end_t - start_t;
+
+	//===========================
+	// evaluation over a sample
+	//---------------------------
+	hydra::device::vector<double> masses(nentries), r_exact(nentries), r_table(nentries);
+
+	hydra::fill_random(masses.begin(), masses.end(), hydra::UniformShape<double>(min, max), 0x6a09e6);
+
+	auto start_e = std::chrono::high_resolution_clock::now();
+
+	hydra::thrust::transform(hydra::device::sys, masses.begin(), masses.end(), r_exact.begin(), ipatia);
+
+	auto end_e = std::chrono::high_resolution_clock::now();
+
+	auto start_s = std::chrono::high_resolution_clock::now();
+
+	hydra::thrust::transform(hydra::device::sys, masses.begin(), masses.end(), r_table.begin(), tabulated);
+
+	auto end_s = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_e = end_e - start_e;
+	std::chrono::duration<double, std::milli> elapsed_s = end_s - start_s;
+
+	std::vector<double> exact(r_exact.begin(), r_exact.end()), table(r_table.begin(), r_table.end());
+
+	double max_deviation = 0.0;
+
+	for(size_t i=0; i<nentries; i++)
+		max_deviation = std::max(max_deviation, ::fabs(exact[i] - table[i]));
+
+	//===========================
+	// integrals
+	//---------------------------
+	hydra::GaussKronrodQuadrature<61,200, hydra::device::sys_t> quadrature(min, max);
+
+	auto exact_integral = quadrature(ipatia);
+
+	double table_integral = tabulated.Integral(min, max);
+
+	std::cout << "-----------------------------------------"<<std::endl;
+	std::cout << "| Ipatia tabulated on " << tabulated.GetNNodes() << " nodes in [" << min << ", " << max << "]" <<std::endl;
+	std::cout << "| Tabulation time (ms):             " << elapsed_t.count() <<std::endl;
+	std::cout << "| Maximum deviation at random points: " << tabulated.GetMaxError() <<std::endl;
+	std::cout << "| Evaluation of " << nentries << " events" <<std::endl;
+	std::cout << "|   Exact time (ms):      " << elapsed_e.count() <<std::endl;
+	std::cout << "|   Tabulated time (ms):  " << elapsed_s.count() <<std::endl;
+	std::cout << "|   Maximum deviation:    " << max_deviation <<std::endl;
+	std::cout.precision(10);
+	std::cout << "| Integral in [" << min << ", " << max << "]" <<std::endl;
+	std::cout << "|   Quadrature: " << exact_integral.first <<std::endl;
+	std::cout << "|   Tabulated:  " << table_integral <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	//===========================
+	// change of parameters
+	//---------------------------
+	tabulated.Update();
+
+	std::cout << "| Tabulations after Update() with the same parameters: " << tabulated.GetNTabulations() <<std::endl;
+
+	tabulated.GetExactFunctor().SetParameter(0, 5.285);
+	tabulated.Update();
+
+	std::cout << "| Tabulations after Update() with a new mean:          " << tabulated.GetNTabulations() <<std::endl;
+	std::cout << "| Maximum deviation at random points: " << tabulated.GetMaxError() <<std::endl;
+	std::cout << "| Value at the new mean, exact and tabulated: " << tabulated.GetExactFunctor()(5.285)
+			  << " " << tabulated(5.285) <<std::endl;
+	std::cout << "-----------------------------------------"<<std::endl;
+
+	tabulated.Dispose();
+
+	return 0;
+}
+
+
+#endif /* TABULATED_FUNCTOR_INL_ */
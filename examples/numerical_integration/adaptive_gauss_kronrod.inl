@@ -116,6 +116,7 @@ int main(int argv, char** argc)
 
     	std::cout << ">>>l [ Gauss-Kronrod 61 ]"<< std::endl;
     	std::cout << "Result: " << result.first << "  +-  " << result.second <<std::endl
+    			<< " Iterations: "<< GKAQ61_d.GetIterationNumber() <<std::endl
     			<< " Time (ms): "<< elapsed.count() <<std::endl;
     }
 
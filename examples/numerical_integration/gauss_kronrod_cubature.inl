@@ -0,0 +1,220 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * gauss_kronrod_cubature.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+#ifndef GAUSS_KRONROD_CUBATURE_INL_
+#define GAUSS_KRONROD_CUBATURE_INL_
+
+/**
+ * \example gauss_kronrod_cubature.inl
+ * This example uses hydra::GaussKronrodCubature to calculate the integral
+ * of a three dimensional Gaussian with tensor-product rules and of a six dimensional
+ * Gaussian with sparse grids of increasing level, comparing with hydra::Plain
+ * at the same number of calls.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <cmath>
+
+
+//command line arguments
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/Types.h>
+
+#include <hydra/Function.h>
+#include <hydra/FunctorArithmetic.h>
+#include <hydra/Plain.h>
+#include <hydra/GaussKronrodCubature.h>
+#include <hydra/Lambda.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+
+
+declarg(X0, double)
+declarg(X1, double)
+declarg(X2, double)
+declarg(X3, double)
+declarg(X4, double)
+declarg(X5, double)
+
+using namespace hydra::arguments;
+
+int main(int argv, char** argc)
+{
+
+	size_t  max_level  = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for Gauss-Kronrod cubature", '=');
+
+		TCLAP::ValueArg<size_t> LevelArg("l", "max-level", "Maximum sparse-grid level (up to 4).", false, 4, "size_t");
+		cmd.add(LevelArg);
+
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		max_level   = LevelArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)
+	{
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+	}
+
+	//Gaussian mean
+	double mean  = 0.0;
+
+	auto gauss = [=] __hydra_dual__ (double x, double sigma){
+
+		double m2 = (x - mean )*(x - mean );
+		double s2 = sigma*sigma;
+
+		return exp(-m2/(2.0 * s2 ))/( sqrt(2.0*s2*PI));
+	};
+
+	//----------------------------------------------------------------------
+	// three dimensional Gaussian, tensor-product rules
+	{
+		constexpr size_t N = 3;
+
+		std::array<double, N> min{-3.0, -3.0, -3.0};
+		std::array<double, N> max{ 3.0,  3.0,  3.0};
+
+		//exact result
+		double integral = std::pow(std::erf(3.0/std::sqrt(2.0)), N);
+
+		double sigma = 1.0;
+
+		auto gaussian = hydra::wrap_lambda( [=] __hydra_dual__ ( X0 x0, X1 x1, X2 x2 ){
+
+			return gauss(x0, sigma)*gauss(x1, sigma)*gauss(x2, sigma);
+		});
+
+		for(size_t nbins = 1; nbins <= 4; nbins *= 2)
+		{
+			//----------------------------------------------------------------------
+			//tensor product of composite 15 points Gauss-Kronrod rules
+			hydra::GaussKronrodCubature<15, N,  hydra::device::sys_t > GKC_d(min, max, {nbins, nbins, nbins});
+
+			auto start = std::chrono::high_resolution_clock::now();
+			auto result = GKC_d.Integrate(gaussian);
+			auto end = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double, std::milli> elapsed = end - start;
+
+			//----------------------------------------------------------------------
+			//plain mc integrator, same number of calls
+			hydra::Plain<N,  hydra::device::sys_t > PlainMC_d(min, max, GKC_d.GetNPoints());
+
+			auto mc_start = std::chrono::high_resolution_clock::now();
+			auto mc_result = PlainMC_d.Integrate(gaussian);
+			auto mc_end = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double, std::milli> mc_elapsed = mc_end - mc_start;
+
+			std::cout << std::endl;
+			std::cout << "----------------- Device ----------------"<< std::endl;
+			std::cout << ">>> Gaussian<"<< N << ">, tensor product, " << nbins << " intervals per dimension, "
+					  << GKC_d.GetNPoints() << " calls, exact result: " << integral << std::endl;
+			std::cout << "[GaussKronrod] Result: " << result.first << " +/- " << result.second
+					  << " (deviation " << result.first - integral << ")"
+					  << " Time (ms): " << elapsed.count() <<std::endl;
+			std::cout << "[Plain]        Result: " << mc_result.first << " +/- " << mc_result.second
+					  << " (deviation " << mc_result.first - integral << ")"
+					  << " Time (ms): " << mc_elapsed.count() <<std::endl;
+			std::cout << "-----------------------------------------"<< std::endl;
+		}
+	}
+
+	//----------------------------------------------------------------------
+	// six dimensional Gaussian, Smolyak sparse grids
+	{
+		constexpr size_t N = 6;
+
+		std::array<double, N> min, max;
+		min.fill(-1.0);
+		max.fill( 1.0);
+
+		//sparse grids need integrands varying slowly over the region
+		double sigma = 2.0;
+
+		//exact result
+		double integral = std::pow(std::erf(1.0/(sigma*std::sqrt(2.0))), N);
+
+		auto gaussian = hydra::wrap_lambda( [=] __hydra_dual__ ( X0 x0, X1 x1, X2 x2, X3 x3, X4 x4, X5 x5 ){
+
+			return gauss(x0, sigma)*gauss(x1, sigma)*gauss(x2, sigma)
+				  *gauss(x3, sigma)*gauss(x4, sigma)*gauss(x5, sigma);
+		});
+
+		hydra::GaussKronrodCubature<15, N,  hydra::device::sys_t > GKC_d(min, max);
+
+		for(size_t level = 1; level <= max_level; level++)
+		{
+			//----------------------------------------------------------------------
+			//sparse grid, building the node table is not timed
+			GKC_d.SetSparseGrid(level);
+
+			auto start = std::chrono::high_resolution_clock::now();
+			auto result = GKC_d.Integrate(gaussian);
+			auto end = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double, std::milli> elapsed = end - start;
+
+			//----------------------------------------------------------------------
+			//plain mc integrator, same number of calls
+			hydra::Plain<N,  hydra::device::sys_t > PlainMC_d(min, max, GKC_d.GetNPoints());
+
+			auto mc_start = std::chrono::high_resolution_clock::now();
+			auto mc_result = PlainMC_d.Integrate(gaussian);
+			auto mc_end = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double, std::milli> mc_elapsed = mc_end - mc_start;
+
+			std::cout << std::endl;
+			std::cout << "----------------- Device ----------------"<< std::endl;
+			std::cout << ">>> Gaussian<"<< N << ">, sparse grid level " << level << ", "
+					  << GKC_d.GetNPoints() << " calls, exact result: " << integral << std::endl;
+			std::cout << "[GaussKronrod] Result: " << result.first << " +/- " << result.second
+					  << " (deviation " << result.first - integral << ")"
+					  << " Time (ms): " << elapsed.count() <<std::endl;
+			std::cout << "[Plain]        Result: " << mc_result.first << " +/- " << mc_result.second
+					  << " (deviation " << mc_result.first - integral << ")"
+					  << " Time (ms): " << mc_elapsed.count() <<std::endl;
+			std::cout << "-----------------------------------------"<< std::endl;
+		}
+	}
+
+	return 0;
+}
+
+#endif /* GAUSS_KRONROD_CUBATURE_INL_ */
@@ -31,10 +31,12 @@
 
 
 /**
- * \example plain_mc.inl
- * This example show how to use the hydra::Plain
+ * \example genz_malik.inl
+ * This example show how to use the hydra::GenzMalikQuadrature
  * numerical integration algorithm to calculate
- * the integral of a five dimensional Gaussian.
+ * the integral of a three dimensional Gaussian, using a fixed
+ * grid of boxes and the adaptive mode, which bisects the boxes
+ * with the largest errors until the required tolerance is reached.
  */
 
 #include <iostream>
@@ -55,30 +57,39 @@
 
 #include <hydra/Function.h>
 #include <hydra/FunctorArithmetic.h>
-#include <hydra/Plain.h>
 #include <hydra/GenzMalikQuadrature.h>
 #include <hydra/Lambda.h>
 #include <hydra/host/System.h>
 #include <hydra/device/System.h>
 
 
+declarg(AxisX, double)
+declarg(AxisY, double)
+declarg(AxisZ, double)
+
+using namespace hydra::arguments;
 
 int main(int argv, char** argc)
 {
 
 	size_t  boxes  = 0;
+	double  relerr = 0;
 
 	try {
 
-		TCLAP::CmdLine cmd("Command line arguments for plain mc", '=');
+		TCLAP::CmdLine cmd("Command line arguments for Genz-Malik quadrature", '=');
+
+		TCLAP::ValueArg<size_t> NBoxesArg("n", "number-of-hyperboxes", "Number of hyperboxes", false, 27000, "size_t");
+		cmd.add(NBoxesArg);
 
-		TCLAP::ValueArg<size_t> NCallsArg("n", "number-of-hyperboxes", "Number of hyperboxes", true, 1, "size_t");
-		cmd.add(NCallsArg);
+		TCLAP::ValueArg<double> RelErrArg("r", "relative-error", "Relative error required in adaptive mode", false, 1.0e-8, "double");
+		cmd.add(RelErrArg);
 
 		cmd.parse(argv, argc);
 
 		// Get the value parsed by each arg.
-		boxes   = NCallsArg.getValue();
+		boxes   = NBoxesArg.getValue();
+		relerr  = RelErrArg.getValue();
 
 	}
 	catch (TCLAP::ArgException &e)
@@ -86,65 +97,89 @@ int main(int argv, char** argc)
 		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
 	}
 
-	//number of dimensions (user can change it)
-	constexpr size_t N = 2;
+	//number of dimensions
+	constexpr size_t N = 3;
 
 	//integration region limits
 	double  min[N];
 	double  max[N];
 
-    //5D Gaussian parameters
-	double mean  = 0.0;
-	double sigma = 1.0;
+	//3D Gaussian parameters
+	double mean     = 0.0;
+	double sigma[N] = {1.0, 0.5, 0.2};
 
-	//set Gaussian parameters and
-	//integration region limits
+	//set integration region limits
 	for(size_t i=0; i< N; i++){
 		min[i]   = -6.0;
 		max[i]   =  6.0;
 	}
 
 	// create functor using C++11 lambda
-	auto GAUSSIAN = [=] __hydra_dual__ (unsigned int n, double* x ){
+	auto GAUSSIAN = [=] __hydra_dual__ ( AxisX x, AxisY y, AxisZ z ){
 
 		double g = 1.0;
-		double f = 0.0;
+
+		double X[N]{x, y, z};
 
 		for(size_t i=0; i<N; i++){
-			double m2 = (x[i] - mean )*(x[i] - mean );
-			double s2 = sigma*sigma;
-			f = exp(-m2/(2.0 * s2 ))/( sqrt(2.0*s2*PI));
-			g *= f;
+			double m2 = (X[i] - mean )*(X[i] - mean );
+			double s2 = sigma[i]*sigma[i];
+			g *= exp(-m2/(2.0 * s2 ))/( sqrt(2.0*s2*PI));
 		}
 
 		return g;
 	};
 
 	//wrap the lambda
-    auto gaussian = hydra::wrap_lambda(GAUSSIAN);
+	auto gaussian = hydra::wrap_lambda(GAUSSIAN);
 
-    //device
-    {
-    	//----------------------------------------------------------------------
-    	//Genz-Malik integrator
-    	hydra::GenzMalikQuadrature<N,  hydra::device::sys_t > GM_d(min, max, boxes, 0.5);
+	//device
+	{
+		//----------------------------------------------------------------------
+		//Genz-Malik integrator, fixed grid of boxes
+		hydra::GenzMalikQuadrature<N,  hydra::device::sys_t > GM_d(min, max, boxes, 0.25, 1.0);
 
-    	auto start = std::chrono::high_resolution_clock::now();
+		auto start = std::chrono::high_resolution_clock::now();
 
-    	auto result = GM_d.Integrate(gaussian);
+		auto result = GM_d.Integrate(gaussian);
 
-    	auto end = std::chrono::high_resolution_clock::now();
+		auto end = std::chrono::high_resolution_clock::now();
 
-    	std::chrono::duration<double, std::milli> elapsed = end - start;
+		std::chrono::duration<double, std::milli> elapsed = end - start;
 
-    	std::cout << std::endl;
-    	std::cout << "----------------- Device ----------------"<< std::endl;
-    	std::cout << ">>> [Genz-Malik]: Gaussian<"<< N << ">" << std::endl;
-    	std::cout << "Result: "    << result.first << " +/- " << result.second <<std::endl
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << ">>> [Genz-Malik]: Gaussian<"<< N << ">, " << GM_d.GetBoxList().size() << " boxes" << std::endl;
+		std::cout << "Result: "    << result.first << " +/- " << result.second <<std::endl
 				  << "Time (ms): " << elapsed.count() <<std::endl;
-    	std::cout << "-----------------------------------------"<< std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+	}
+
+	//device
+	{
+		//----------------------------------------------------------------------
+		//Genz-Malik integrator, adaptive mode starting from a coarse grid
+		hydra::GenzMalikQuadrature<N,  hydra::device::sys_t > GM_d(min, max, 8, 0.25, relerr);
 
-    }
+		GM_d.SetAdaptive(true);
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		auto result = GM_d.Integrate(gaussian);
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << ">>> [Genz-Malik, adaptive]: Gaussian<"<< N << ">, relative error " << relerr << std::endl;
+		std::cout << "Result: "    << result.first << " +/- " << result.second <<std::endl
+				  << "Time (ms): " << elapsed.count() <<std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+	}
 
 
 	return 0;
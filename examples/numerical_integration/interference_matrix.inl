@@ -0,0 +1,280 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * interference_matrix.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef INTERFERENCE_MATRIX_INL_
+#define INTERFERENCE_MATRIX_INL_
+
+/**
+ * \example interference_matrix.inl
+ * This example shows how to normalize a coherent sum of amplitudes,
+ * |sum_i c_i A_i(x,y)|^2, with hydra::InterferenceMatrixIntegrator, which
+ * caches the interference matrix over a sample and recalculates only
+ * the rows of the amplitudes whose shape changed.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <initializer_list>
+
+//command line arguments
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/Function.h>
+#include <hydra/Parameter.h>
+#include <hydra/Pdf.h>
+#include <hydra/FunctorArithmetic.h>
+#include <hydra/Random.h>
+#include <hydra/InterferenceMatrixIntegrator.h>
+#include <hydra/functions/UniformShape.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+#include <hydra/detail/external/hydra_thrust/iterator/zip_iterator.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+
+declarg(AxisX, double)
+declarg(AxisY, double)
+
+using namespace hydra::arguments;
+
+/*
+ * Breit-Wigner amplitude in x and y, with complex coupling (c_re, c_im).
+ */
+class Resonance: public hydra::BaseFunctor<Resonance, hydra::complex<double>(AxisX, AxisY), 4>
+{
+	typedef hydra::BaseFunctor<Resonance, hydra::complex<double>(AxisX, AxisY), 4> super_type;
+
+	using super_type::_par;
+
+public:
+
+	Resonance() = delete;
+
+	Resonance(hydra::Parameter const& c_re, hydra::Parameter const& c_im,
+			  hydra::Parameter const& mass, hydra::Parameter const& width):
+		super_type({c_re, c_im, mass, width})
+	{}
+
+	__hydra_dual__
+	Resonance( Resonance const& other):
+		super_type(other)
+	{}
+
+	__hydra_dual__
+	inline Resonance& operator=( Resonance const& other)
+	{
+		if(this==&other) return *this;
+		super_type::operator=(other);
+		return *this;
+	}
+
+	__hydra_dual__
+	inline hydra::complex<double> Evaluate(AxisX x, AxisY y)  const {
+
+		hydra::complex<double> c(_par[0], _par[1]);
+
+		return c*( BW(x) + BW(y) );
+	}
+
+private:
+
+	__hydra_dual__
+	inline hydra::complex<double> BW(double m)  const {
+
+		double m0 = _par[2];
+		double w0 = _par[3];
+
+		return 1.0/hydra::complex<double>(m0*m0 - m*m, -m0*w0);
+	}
+};
+
+/*
+ * Squared modulus of the sum of the amplitudes.
+ */
+template<typename ...T>
+class Norm: public hydra::BaseFunctor<Norm<T...>, double(T...), 0>
+{
+	typedef hydra::BaseFunctor<Norm<T...>, double(T...), 0> super_type;
+
+public:
+
+	Norm()=default;
+
+	__hydra_dual__
+	Norm( Norm<T...> const& other):
+		super_type(other)
+	{}
+
+	__hydra_dual__
+	Norm<T...>& operator=( Norm<T...> const& other)
+	{
+		if(this==&other) return *this;
+		super_type::operator=(other);
+		return *this;
+	}
+
+	__hydra_dual__
+	inline double Evaluate( T... A ) const {
+
+		hydra::complex<double> r{};
+
+		for( auto a: {A...} ) r += a;
+
+		return hydra::norm(r);
+	}
+};
+
+template<typename ...Amplitudes>
+auto make_model( Amplitudes const& ... amplitudes)
+-> decltype(hydra::compose( std::declval<Norm<typename Amplitudes::return_type...>>(), amplitudes... ))
+{
+	return hydra::compose(Norm<typename Amplitudes::return_type...>(), amplitudes...);
+}
+
+int main(int argv, char** argc)
+{
+
+	size_t  nentries  = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for interference matrix normalization", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events", "Number of events of the normalization sample.", false, 1000000, "size_t");
+		cmd.add(EArg);
+
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)
+	{
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+	}
+
+	//six resonances
+	constexpr size_t K = 6;
+
+	std::vector<Resonance> amplitudes;
+
+	for(size_t i=0; i<K; i++)
+	{
+		std::string name = std::string("R") + std::to_string(i);
+
+		auto c_re  = hydra::Parameter::Create((name + "_re").c_str()).Value(1.0/(i+1)).Error(0.01);
+		auto c_im  = hydra::Parameter::Create((name + "_im").c_str()).Value(0.3*i).Error(0.01);
+		auto mass  = hydra::Parameter::Create((name + "_mass").c_str()).Value(0.8 + 0.25*i).Error(0.001);
+		auto width = hydra::Parameter::Create((name + "_width").c_str()).Value(0.05 + 0.02*i).Error(0.001);
+
+		amplitudes.push_back( Resonance(c_re, c_im, mass, width) );
+	}
+
+	auto build = [&](){
+		return make_model(amplitudes[0], amplitudes[1], amplitudes[2], amplitudes[3], amplitudes[4], amplitudes[5]);
+	};
+
+	//normalization sample: uniform over [0.5, 2.5]x[0.5, 2.5]
+	hydra::device::vector<double> x(nentries), y(nentries);
+
+	auto A = hydra::Parameter::Create("A").Value(0.5);
+	auto B = hydra::Parameter::Create("B").Value(2.5);
+
+	hydra::fill_random(x, hydra::UniformShape<double>(A, B), 0x1f5a9c);
+	hydra::fill_random(y, hydra::UniformShape<double>(A, B), 0x7b3e21);
+
+	auto first = hydra::thrust::make_zip_iterator(hydra::thrust::make_tuple(x.begin(), y.begin()));
+	auto last  = first + nentries;
+
+	//area of the region
+	double area = 4.0;
+
+	auto integrator = hydra::make_interference_matrix_integrator(hydra::device::sys, first, last, area);
+
+	//reference: full evaluation of the model over the same sample
+	auto full = [&](decltype(build()) const& model){
+
+		return area*hydra::thrust::transform_reduce(hydra::device::sys, first, last, model, 0.0,
+				hydra::thrust::plus<double>())/nentries;
+	};
+
+	auto step = [&](const char* label){
+
+		auto model = build();
+
+		auto start = std::chrono::high_resolution_clock::now();
+		auto norm  = integrator(model);
+		auto end   = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		start = std::chrono::high_resolution_clock::now();
+		double reference = full(model);
+		end   = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> elapsed_ref = end - start;
+
+		std::cout << "| " << label << std::endl;
+		std::cout << "|    Cached matrix  : " << norm.first << " Time (ms): " << elapsed.count()
+				  << " Rows calculated so far: " << integrator.GetNRowUpdates() << std::endl;
+		std::cout << "|    Full evaluation: " << reference  << " Time (ms): " << elapsed_ref.count() << std::endl;
+	};
+
+	std::cout << std::endl;
+	std::cout << "----------------- Device ----------------"<< std::endl;
+	std::cout << "| Coherent sum of " << K << " amplitudes, " << nentries << " events" << std::endl;
+
+	step("First call");
+
+	amplitudes[2].SetParameter(0, 0.7);
+	amplitudes[4].SetParameter(1, -0.2);
+
+	step("Couplings changed");
+
+	amplitudes[3].SetParameter(2, 1.6);
+
+	step("Mass of one resonance changed");
+
+	//as normalization strategy of a hydra::Pdf, estimating also the error
+	integrator.SetErrorEstimation(true);
+
+	auto pdf = hydra::make_pdf(build(), integrator);
+
+	std::cout << "| Pdf norm: " << pdf.GetNorm() << " +/- " << pdf.GetNormError() << std::endl;
+	std::cout << "-----------------------------------------"<< std::endl;
+
+	return 0;
+}
+
+#endif /* INTERFERENCE_MATRIX_INL_ */
@@ -0,0 +1,208 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * multi_integrand.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef MULTI_INTEGRAND_INL_
+#define MULTI_INTEGRAND_INL_
+
+/**
+ * \example multi_integrand.inl
+ * This example shows how to integrate several functors in one pass,
+ * evaluating all of them at the same points, with the MultiIntegrate(...)
+ * methods of hydra::Plain, hydra::QuasiMonteCarlo and hydra::GaussKronrodQuadrature.
+ * The integrands are the components of a two dimensional Gaussian mixture
+ * and the elements of their overlap matrix.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <cmath>
+
+//command line arguments
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/Types.h>
+#include <hydra/Function.h>
+#include <hydra/Lambda.h>
+#include <hydra/Plain.h>
+#include <hydra/QuasiMonteCarlo.h>
+#include <hydra/GaussKronrodQuadrature.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+
+declarg(AxisX, double)
+declarg(AxisY, double)
+
+using namespace hydra::arguments;
+
+int main(int argv, char** argc)
+{
+
+	size_t  calls  = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for multi-integrand integration", '=');
+
+		TCLAP::ValueArg<size_t> NCallsArg("n", "number-of-calls", "Number of calls.", false, 1<<22, "size_t");
+		cmd.add(NCallsArg);
+
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		calls   = NCallsArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)
+	{
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+	}
+
+	//integration region limits
+	double  min[2] = {-5.0, -5.0};
+	double  max[2] = { 5.0,  5.0};
+
+	//three Gaussian components
+	auto gaussian = [] __hydra_dual__ (double x, double y, double mx, double my, double s){
+
+		return exp(-0.5*((x-mx)*(x-mx) + (y-my)*(y-my))/(s*s));
+	};
+
+	auto G0 = hydra::wrap_lambda( [=] __hydra_dual__ (AxisX x, AxisY y){ return gaussian(x, y,  0.0, 0.0, 1.0); } );
+	auto G1 = hydra::wrap_lambda( [=] __hydra_dual__ (AxisX x, AxisY y){ return gaussian(x, y,  1.0, 0.5, 0.5); } );
+	auto G2 = hydra::wrap_lambda( [=] __hydra_dual__ (AxisX x, AxisY y){ return gaussian(x, y, -1.0, 1.0, 0.8); } );
+
+	//upper triangle of the overlap matrix <Gi Gj>, as a single functor returning an array
+	auto OVERLAPS = hydra::wrap_lambda( [=] __hydra_dual__ (AxisX x, AxisY y){
+
+		double g[3]{ gaussian(x, y, 0.0, 0.0, 1.0), gaussian(x, y, 1.0, 0.5, 0.5), gaussian(x, y, -1.0, 1.0, 0.8) };
+
+		return std::array<double, 6>{{ g[0]*g[0], g[0]*g[1], g[0]*g[2], g[1]*g[1], g[1]*g[2], g[2]*g[2] }};
+	});
+
+	//analytical values
+	auto overlap = [](double mx1, double my1, double s1, double mx2, double my2, double s2){
+
+		double s2sum = s1*s1 + s2*s2;
+		double d2 = (mx1-mx2)*(mx1-mx2) + (my1-my2)*(my1-my2);
+
+		return 2.0*PI*s1*s1*s2*s2/s2sum*std::exp(-0.5*d2/s2sum);
+	};
+
+	double exact[6]{ overlap(0,0,1,0,0,1), overlap(0,0,1,1,0.5,0.5), overlap(0,0,1,-1,1,0.8),
+		             overlap(1,0.5,0.5,1,0.5,0.5), overlap(1,0.5,0.5,-1,1,0.8), overlap(-1,1,0.8,-1,1,0.8) };
+
+	//---------------------------------------------------------------
+	// Plain MC: one integration per component vs. one pass
+	//---------------------------------------------------------------
+	{
+		hydra::Plain<2, hydra::device::sys_t> PlainMC_d(min, max, calls);
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		auto r0 = PlainMC_d.Integrate(G0);
+		auto r1 = PlainMC_d.Integrate(G1);
+		auto r2 = PlainMC_d.Integrate(G2);
+
+		auto end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		start = std::chrono::high_resolution_clock::now();
+
+		auto multi = PlainMC_d.MultiIntegrate( hydra::make_tuple(G0, G1, G2) );
+
+		end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> multi_elapsed = end - start;
+
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << ">>> Plain MC, "<< calls << " calls" << std::endl;
+		std::cout << "One integration per component (ms): " << elapsed.count() << std::endl;
+		std::cout << "    G0: " << r0.first << " +/- " << r0.second << std::endl;
+		std::cout << "    G1: " << r1.first << " +/- " << r1.second << std::endl;
+		std::cout << "    G2: " << r2.first << " +/- " << r2.second << std::endl;
+		std::cout << "MultiIntegrate (ms): " << multi_elapsed.count() << std::endl;
+		for(size_t k=0; k<3; k++)
+			std::cout << "    G" << k << ": " << multi[k].first << " +/- " << multi[k].second << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+	}
+
+	//---------------------------------------------------------------
+	// quasi-Monte Carlo: overlap matrix in one pass
+	//---------------------------------------------------------------
+	{
+		hydra::QuasiMonteCarlo<2, hydra::device::sys_t> QMC_d(min, max, calls);
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		auto multi = QMC_d.MultiIntegrate( OVERLAPS );
+
+		auto end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << ">>> QMC overlap matrix, "<< calls << " calls, time (ms): " << elapsed.count() << std::endl;
+		for(size_t k=0; k<6; k++)
+			std::cout << "    <GiGj>[" << k << "]: " << multi[k].first << " +/- " << multi[k].second
+			          << " exact: " << exact[k] << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+	}
+
+	//---------------------------------------------------------------
+	// Gauss-Kronrod: marginals along x in one pass
+	//---------------------------------------------------------------
+	{
+		auto M0 = hydra::wrap_lambda( [=] __hydra_dual__ (double x){ return gaussian(x, 0.0,  0.0, 0.0, 1.0); } );
+		auto M1 = hydra::wrap_lambda( [=] __hydra_dual__ (double x){ return gaussian(x, 0.0,  1.0, 0.0, 0.5); } );
+		auto M2 = hydra::wrap_lambda( [=] __hydra_dual__ (double x){ return gaussian(x, 0.0, -1.0, 0.0, 0.8); } );
+
+		hydra::GaussKronrodQuadrature<61,50, hydra::device::sys_t> GKQ_d(-5.0, 5.0);
+
+		auto multi = GKQ_d.MultiIntegrate( hydra::make_tuple(M0, M1, M2) );
+
+		double sigmas[3]{1.0, 0.5, 0.8};
+
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << ">>> Gauss-Kronrod, marginals" << std::endl;
+		for(size_t k=0; k<3; k++)
+			std::cout << "    M" << k << ": " << multi[k].first << " +/- " << multi[k].second
+			          << " exact: " << std::sqrt(2.0*PI)*sigmas[k] << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+	}
+
+	return 0;
+}
+
+#endif /* MULTI_INTEGRAND_INL_ */
@@ -34,6 +34,9 @@
  * This example show how to use the hydra::Plain
  * numerical integration algorithm to calculate
  * the integral of a five dimensional Gaussian.
+ * The integral is calculated with a fixed number of calls and
+ * in adaptive mode, where the calls are processed in batches until
+ * the required relative error is reached.
  */
 
 #include <iostream>
@@ -69,6 +72,8 @@ int main(int argv, char** argc)
 {
 
 	size_t  calls  = 0;
+	size_t  batch  = 0;
+	double  relative_error = 0;
 
 	try {
 
@@ -77,10 +82,18 @@ int main(int argv, char** argc)
 		TCLAP::ValueArg<size_t> NCallsArg("n", "number-of-calls", "Number of call.", true, 1, "size_t");
 		cmd.add(NCallsArg);
 
+		TCLAP::ValueArg<size_t> BatchArg("b", "batch-size", "Number of calls per batch in adaptive mode.", false, 1<<16, "size_t");
+		cmd.add(BatchArg);
+
+		TCLAP::ValueArg<double> RelativeErrorArg("e", "relative-error", "Relative error target in adaptive mode.", false, 1.0e-3, "double");
+		cmd.add(RelativeErrorArg);
+
 		cmd.parse(argv, argc);
 
 		// Get the value parsed by each arg.
 		calls   = NCallsArg.getValue();
+		batch   = BatchArg.getValue();
+		relative_error = RelativeErrorArg.getValue();
 
 	}
 	catch (TCLAP::ArgException &e)
@@ -144,6 +157,34 @@ int main(int argv, char** argc)
 				  << "Time (ms): " << elapsed.count() <<std::endl;
     	std::cout << "-----------------------------------------"<< std::endl;
 
+    }
+
+    //device, adaptive mode
+    {
+    	//----------------------------------------------------------------------
+    	//plain mc integrator, with at most 'calls' calls
+    	hydra::Plain<N,  hydra::device::sys_t > PlainMC_d(min, max, calls);
+
+    	PlainMC_d.SetAdaptive(true);
+    	PlainMC_d.SetBatchSize(batch);
+    	PlainMC_d.SetRelativeError(relative_error);
+
+    	auto start = std::chrono::high_resolution_clock::now();
+    	auto result = PlainMC_d.Integrate(gaussian);
+    	auto end = std::chrono::high_resolution_clock::now();
+    	std::chrono::duration<double, std::milli> elapsed = end - start;
+    	std::cout << std::endl;
+    	std::cout << "----------------- Device ----------------"<< std::endl;
+    	std::cout << ">>> [Plain, adaptive]: Gaussian<"<< N << ">, relative error target " << relative_error << std::endl;
+
+    	for(auto const& b: PlainMC_d.GetBatches())
+    		std::cout << "Calls: " << b.fNCalls << " Result: " << b.fResult << " +/- " << b.fAbsError
+    		          << " Batch time (ms): " << b.fTime << std::endl;
+
+    	std::cout << "Result: "    << result.first << " +/- " << result.second <<std::endl
+				  << "Time (ms): " << elapsed.count() <<std::endl;
+    	std::cout << "-----------------------------------------"<< std::endl;
+
     }
 
 
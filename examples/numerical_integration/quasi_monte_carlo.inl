@@ -0,0 +1,174 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * quasi_monte_carlo.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef QUASI_MONTE_CARLO_INL_
+#define QUASI_MONTE_CARLO_INL_
+
+/**
+ * \example quasi_monte_carlo.inl
+ * This example compares the hydra::Plain and hydra::QuasiMonteCarlo
+ * numerical integration algorithms, calculating the integral of a
+ * five dimensional Gaussian with increasing numbers of calls.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <cmath>
+
+
+//command line arguments
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/Types.h>
+
+#include <hydra/Function.h>
+#include <hydra/FunctorArithmetic.h>
+#include <hydra/Plain.h>
+#include <hydra/QuasiMonteCarlo.h>
+#include <hydra/Lambda.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+
+
+declarg(X0, double)
+declarg(X1, double)
+declarg(X2, double)
+declarg(X3, double)
+declarg(X4, double)
+
+using namespace hydra::arguments;
+
+int main(int argv, char** argc)
+{
+
+	size_t  calls  = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for quasi-Monte Carlo", '=');
+
+		TCLAP::ValueArg<size_t> NCallsArg("n", "number-of-calls", "Maximum number of calls.", false, 1<<22, "size_t");
+		cmd.add(NCallsArg);
+
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		calls   = NCallsArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)
+	{
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+	}
+
+	//number of dimensions
+	constexpr size_t N = 5;
+
+	//integration region limits
+	double  min[N];
+	double  max[N];
+
+	//Gaussian parameters
+	double mean  = 0.0;
+	double sigma = 1.0;
+
+	for(size_t i=0; i< N; i++){
+		min[i]   = -3.0;
+		max[i]   =  3.0;
+	}
+
+	//exact result
+	double integral = std::pow(std::erf(3.0/std::sqrt(2.0)), N);
+
+	// create functor using C++11 lambda
+	auto GAUSSIAN = [=] __hydra_dual__ ( X0 x0, X1 x1, X2 x2, X3 x3, X4 x4 ){
+
+		double g = 1.0;
+
+		double X[N]{x0, x1, x2, x3, x4};
+
+		for(size_t i=0; i<N; i++){
+			double m2 = (X[i] - mean )*(X[i] - mean );
+			double s2 = sigma*sigma;
+			g *= exp(-m2/(2.0 * s2 ))/( sqrt(2.0*s2*PI));
+		}
+
+		return g;
+	};
+
+	//wrap the lambda
+	auto gaussian = hydra::wrap_lambda(GAUSSIAN);
+
+	//device
+	for(size_t ncalls = 1<<12; ncalls <= calls; ncalls *= 16)
+	{
+		//----------------------------------------------------------------------
+		//plain mc integrator
+		hydra::Plain<N,  hydra::device::sys_t > PlainMC_d(min, max, ncalls);
+
+		auto start = std::chrono::high_resolution_clock::now();
+		auto result = PlainMC_d.Integrate(gaussian);
+		auto end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		//----------------------------------------------------------------------
+		//quasi-Monte Carlo integrator, 16 Owen-scrambled randomizations
+		hydra::QuasiMonteCarlo<N,  hydra::device::sys_t > QMC_d(min, max, ncalls);
+
+		auto qmc_start = std::chrono::high_resolution_clock::now();
+		auto qmc_result = QMC_d.Integrate(gaussian);
+		auto qmc_end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> qmc_elapsed = qmc_end - qmc_start;
+
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << ">>> Gaussian<"<< N << ">, " << ncalls << " calls, exact result: " << integral << std::endl;
+		std::cout << "[Plain]      Result: " << result.first << " +/- " << result.second
+				  << " (deviation " << result.first - integral << ")"
+				  << " Time (ms): " << elapsed.count() <<std::endl;
+		std::cout << "[QMC/Sobol]  Result: " << qmc_result.first << " +/- " << qmc_result.second
+				  << " (deviation " << qmc_result.first - integral << ")"
+				  << " Time (ms): " << qmc_elapsed.count() <<std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+	}
+
+
+	return 0;
+
+
+	}
+
+#endif /* QUASI_MONTE_CARLO_INL_ */
@@ -0,0 +1,243 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * vegas_warm_start.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef VEGAS_WARM_START_INL_
+#define VEGAS_WARM_START_INL_
+
+/**
+ * \example vegas_warm_start.inl
+ * This example shows how to store the grid adapted by hydra::Vegas,
+ * how to warm-start a new integration from the stored grid, skipping the training,
+ * and how to use the grid as importance-sampling proposal in hydra::sample.
+ */
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <limits>
+
+
+//command line arguments
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/Types.h>
+
+#include <hydra/Function.h>
+#include <hydra/FunctorArithmetic.h>
+#include <hydra/VegasState.h>
+#include <hydra/Vegas.h>
+#include <hydra/Lambda.h>
+#include <hydra/Random.h>
+#include <hydra/multiarray.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+
+
+
+int main(int argv, char** argc)
+{
+
+	size_t  calls             = 0;
+	size_t  iterations        = 0;
+	double max_error          = 0;
+	std::string grid_file;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for vegas_warm_start", '=');
+
+		TCLAP::ValueArg<size_t> NCallsArg("n", "number-of-calls", "Number of call.", false, 500000, "size_t");
+		cmd.add(NCallsArg);
+
+		TCLAP::ValueArg<double> MaxErrorArg("e", "max-error", "Maximum error.", false, 1.0e-3, "double");
+		cmd.add(MaxErrorArg);
+
+		TCLAP::ValueArg<size_t> IterationsArg("i", "max-iterations", "Maximum maximum number of iterations.",false, 10, "size_t");
+		cmd.add(IterationsArg);
+
+		TCLAP::ValueArg<std::string> GridArg("g", "grid-file", "File to store the grid.",false, "vegas_grid.bin", "string");
+		cmd.add(GridArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		calls      = NCallsArg.getValue();
+		iterations = IterationsArg.getValue();
+		max_error  = MaxErrorArg.getValue();
+		grid_file  = GridArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)
+	{
+		std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+	}
+
+	//number of dimensions (user can change it)
+	constexpr size_t N = 5;
+
+	//integration region limits
+	double  min[N];
+	double  max[N];
+
+    //5D Gaussian parameters
+	double mean  = 0.0;
+	double sigma = 1.0;
+
+	//set Gaussian parameters and
+	//integration region limits
+	for(size_t i=0; i< N; i++){
+		min[i]   = -6.0;
+		max[i]   =  6.0;
+	}
+
+	// create functor using C++11 lambda
+	auto GAUSSIAN = [=] __hydra_dual__ (double x, double y, double z, double w, double v  ){
+
+		double g = 1.0;
+		double f = 0.0;
+
+		double X[5]{x,y,z,w,v};
+
+		for(size_t i=0; i<N; i++){
+
+			double m2 = (X[i] - mean )*(X[i] - mean );
+			double s2 = sigma*sigma;
+			f = exp(-m2/(2.0 * s2 ))/( sqrt(2.0*s2*PI));
+			g *= f;
+		}
+
+		return g;
+	};
+
+	//wrap the lambda
+    auto gaussian = hydra::wrap_lambda(GAUSSIAN);
+
+    //device
+    {
+    	//----------------------------------------------------------------------
+    	//training job: adapt the grid and store it
+    	hydra::VegasState<N,  hydra::device::sys_t> State_d(min, max);
+    	State_d.SetVerbose(-2);
+    	State_d.SetAlpha(1.5);
+    	State_d.SetIterations( iterations );
+    	State_d.SetUseRelativeError(1);
+    	State_d.SetMaxError( max_error );
+    	State_d.SetCalls( calls );
+    	State_d.SetTrainingCalls( calls/10 );
+    	State_d.SetTrainingIterations(2);
+
+    	hydra::Vegas<N,  hydra::device::sys_t > Vegas_d(State_d);
+
+    	auto start = std::chrono::high_resolution_clock::now();
+    	auto result = Vegas_d.Integrate(gaussian);
+    	auto end = std::chrono::high_resolution_clock::now();
+    	std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    	Vegas_d.GetState().SaveGrid(grid_file);
+
+    	std::cout << std::endl;
+    	std::cout << "----------------- Device ----------------"<< std::endl;
+    	std::cout << ">>> [Vegas]: Gaussian<"<< N << ">, cold start" << std::endl;
+    	std::cout << "Result: "    << result.first << " +/- " << result.second <<std::endl
+				  << "Iterations: "<< Vegas_d.GetState().GetIterationResult().size() << std::endl
+				  << "Time (ms): " << elapsed.count() <<std::endl;
+    	std::cout << "Grid stored in: " << grid_file <<std::endl;
+    	std::cout << "-----------------------------------------"<< std::endl;
+
+    	//----------------------------------------------------------------------
+    	//new job: load the grid and warm-start, without training.
+    	//A single iteration on the adapted grid is enough.
+    	hydra::VegasState<N,  hydra::device::sys_t> WarmState_d(min, max);
+    	WarmState_d.SetVerbose(-2);
+    	WarmState_d.SetIterations( 1 );
+    	WarmState_d.SetUseRelativeError(1);
+    	WarmState_d.SetMaxError( max_error );
+    	WarmState_d.SetCalls( calls );
+    	WarmState_d.SetWarmStart(1);
+    	WarmState_d.LoadGrid(grid_file);
+
+    	hydra::Vegas<N,  hydra::device::sys_t > WarmVegas_d(WarmState_d);
+
+    	start = std::chrono::high_resolution_clock::now();
+    	result = WarmVegas_d.Integrate(gaussian);
+    	end = std::chrono::high_resolution_clock::now();
+    	elapsed = end - start;
+
+    	std::cout << std::endl;
+    	std::cout << "----------------- Device ----------------"<< std::endl;
+    	std::cout << ">>> [Vegas]: Gaussian<"<< N << ">, warm start" << std::endl;
+    	std::cout << "Result: "    << result.first << " +/- " << result.second <<std::endl
+				  << "Iterations: "<< WarmVegas_d.GetState().GetIterationResult().size() << std::endl
+				  << "Time (ms): " << elapsed.count() <<std::endl;
+    	std::cout << "-----------------------------------------"<< std::endl;
+
+    	//----------------------------------------------------------------------
+    	//the grid as proposal for accept-reject sampling
+    	std::array<double, N> lower, upper;
+    	for(size_t i=0; i< N; i++){ lower[i]=min[i]; upper[i]=max[i]; }
+
+    	hydra::multiarray<double, N, hydra::device::sys_t> uniform_sample(calls);
+    	hydra::multiarray<double, N, hydra::device::sys_t> vegas_sample(calls);
+
+    	start = std::chrono::high_resolution_clock::now();
+    	auto uniform_range = hydra::sample(uniform_sample.begin(), uniform_sample.end(), lower, upper, gaussian);
+    	end = std::chrono::high_resolution_clock::now();
+    	elapsed = end - start;
+
+    	std::cout << std::endl;
+    	std::cout << "----------------- Device ----------------"<< std::endl;
+    	std::cout << ">>> [sample]: uniform proposal" << std::endl;
+    	std::cout << "Accepted: "  << uniform_range.size() << " / " << calls <<std::endl
+				  << "Time (ms): " << elapsed.count() <<std::endl;
+    	std::cout << "-----------------------------------------"<< std::endl;
+
+    	start = std::chrono::high_resolution_clock::now();
+    	auto vegas_range = hydra::sample(vegas_sample.begin(), vegas_sample.end(), WarmVegas_d.GetState(), gaussian);
+    	end = std::chrono::high_resolution_clock::now();
+    	elapsed = end - start;
+
+    	std::cout << std::endl;
+    	std::cout << "----------------- Device ----------------"<< std::endl;
+    	std::cout << ">>> [sample]: Vegas grid proposal" << std::endl;
+    	std::cout << "Accepted: "  << vegas_range.size() << " / " << calls <<std::endl
+				  << "Time (ms): " << elapsed.count() <<std::endl;
+    	std::cout << "-----------------------------------------"<< std::endl;
+
+    }
+
+	return 0;
+
+}
+
+#endif /* VEGAS_WARM_START_INL_ */
@@ -0,0 +1,172 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+/*
+ * phsp_benchmark.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef PHSP_BENCHMARK_INL_
+#define PHSP_BENCHMARK_INL_
+
+
+/**
+ * \example phsp_benchmark.inl
+ * This example measures the throughput of the Hydra's
+ * phase-space generator for 3-, 5- and 8-body decays.
+ * The block-wise generation used by PhaseSpace::Generate
+ * is compared with the event-by-event reference functor.
+ * Both produce the same events, bit by bit when the compiler
+ * does not contract multiply-adds into FMAs (-ffp-contract=off),
+ * otherwise up to rounding.
+ */
+
+
+/*---------------------------------
+ * std
+ * ---------------------------------
+ */
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <vector>
+#include <array>
+#include <chrono>
+
+/*---------------------------------
+ * command line arguments
+ *---------------------------------
+ */
+#include <tclap/CmdLine.h>
+
+/*---------------------------------
+ * Include hydra classes and
+ * algorithms for
+ *--------------------------------
+ */
+#include <hydra/Types.h>
+#include <hydra/Vector4R.h>
+#include <hydra/PhaseSpace.h>
+#include <hydra/Tuple.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+#include <hydra/Decays.h>
+#include <hydra/detail/functors/DecayMother.h>
+#include <hydra/detail/external/hydra_thrust/tabulate.h>
+
+
+template<size_t N>
+void benchmark(size_t nentries, size_t nrepetitions)
+{
+	typedef typename hydra::detail::tuple_type<N, hydra::Vector4R>::type particles_type;
+
+	//B0 decaying to N pions
+	double P_mass = 5.27963;
+	double masses[N];
+
+	for(size_t i=0; i<N; i++) masses[i] = 0.13957061;
+
+	hydra::Vector4R Parent(P_mass, 0.0, 0.0, 0.0);
+
+	hydra::PhaseSpace<N> phsp{P_mass, masses};
+
+	hydra::Decays<particles_type, hydra::device::sys_t > Events(P_mass, masses, nentries);
+
+	//warm up
+	phsp.Generate(Parent, Events);
+
+	//block-wise generation
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for(size_t r=0; r<nrepetitions; r++)
+		phsp.Generate(Parent, Events);
+
+	auto end = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_block = end - start;
+
+	//event-by-event reference
+	hydra::detail::DecayMother<N, hydra::default_random_engine> decayer(Parent, masses,
+			phsp.GetMaxWeight(), phsp.GetECM(), phsp.GetSeed());
+
+	start = std::chrono::high_resolution_clock::now();
+
+	for(size_t r=0; r<nrepetitions; r++)
+		hydra::thrust::tabulate(Events.begin(), Events.end(), decayer);
+
+	end = std::chrono::high_resolution_clock::now();
+
+	std::chrono::duration<double, std::milli> elapsed_event = end - start;
+
+	std::cout << "----------------- Device ----------------"<< std::endl;
+	std::cout << "| B0 -> " << N << " pi"                     << std::endl;
+	std::cout << "| Number of events           :"<< nentries   << std::endl;
+	std::cout << "| Time per call, block (ms)  :"<< elapsed_block.count()/nrepetitions << std::endl;
+	std::cout << "| Time per call, event (ms)  :"<< elapsed_event.count()/nrepetitions << std::endl;
+	std::cout << "| Speed-up                   :"<< elapsed_event.count()/elapsed_block.count() << std::endl;
+	std::cout << "-----------------------------------------"<< std::endl;
+}
+
+int main(int argv, char** argc)
+{
+
+	size_t  nentries     = 0; // number of events to generate, to be get from command line
+	size_t  nrepetitions = 0; // number of timed calls, to be get from command line
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for PHSP benchmark", '=');
+
+		TCLAP::ValueArg<size_t> NArg("n",
+				"nevents",
+				"Number of events to generate. Default is [ 10e6 ].",
+				true, 10e6, "unsigned long");
+		cmd.add(NArg);
+
+		TCLAP::ValueArg<size_t> RArg("r",
+				"repetitions",
+				"Number of timed calls. Default is [ 5 ].",
+				false, 5, "unsigned long");
+		cmd.add(RArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries       = NArg.getValue();
+		nrepetitions   = RArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+																<< std::endl;
+	}
+
+	benchmark<3>(nentries, nrepetitions);
+	benchmark<5>(nentries, nrepetitions);
+	benchmark<8>(nentries, nrepetitions);
+
+	return 0;
+}
+
+
+#endif /* PHSP_BENCHMARK_INL_ */
@@ -0,0 +1,210 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * phsp_cached_integration.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef PHSP_CACHED_INTEGRATION_INL_
+#define PHSP_CACHED_INTEGRATION_INL_
+
+/**
+ * \example phsp_cached_integration.inl
+ *
+ * This example shows how to use the sample caching modes of
+ * hydra::PhaseSpaceIntegrator, to integrate a sequence of functors
+ * over the phase space of the decay B0 -> J/psi K pi, as happens
+ * when a model is normalized during a fit:
+ *
+ * 1) a new sample is generated in each call (default);
+ * 2) the events and weights are generated once and cached;
+ * 3) only the weights and the Dalitz plot invariants are cached.
+ */
+
+
+/*---------------------------------
+ * std
+ * ---------------------------------
+ */
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <vector>
+#include <array>
+#include <chrono>
+
+/*---------------------------------
+ * command line arguments
+ *---------------------------------
+ */
+#include <tclap/CmdLine.h>
+
+/*---------------------------------
+ * Include hydra classes and
+ * algorithms for/Containers.h
+ *--------------------------------
+ */
+#include <hydra/Types.h>
+#include <hydra/Vector4R.h>
+#include <hydra/PhaseSpace.h>
+#include <hydra/PhaseSpaceIntegrator.h>
+#include <hydra/Function.h>
+#include <hydra/Lambda.h>
+#include <hydra/Tuple.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+
+
+// Daughter particles
+
+declarg(A, hydra::Vector4R)
+declarg(B, hydra::Vector4R)
+declarg(C, hydra::Vector4R)
+
+// Dalitz plot invariants
+declarg(MSqAB, double)
+declarg(MSqBC, double)
+
+//---------------------------
+using namespace hydra::arguments;
+
+
+int main(int argv, char** argc)
+{
+
+	size_t  nentries   = 0; // number of events to generate, to be get from command line
+
+	double P_mass = 5.27955;
+	double A_mass = 3.0969;
+	double B_mass = 0.493677;
+	double C_mass = 0.13957061;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for PHSP B0 -> J/psi K pi", '=');
+
+		TCLAP::ValueArg<size_t> NArg("n",
+				"nevents",
+				"Number of events to generate. Default is [ 10e6 ].",
+				true, 10e6, "unsigned long");
+		cmd.add(NArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries       = NArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+																<< std::endl;
+	}
+
+	//number of integrations, emulating the calls of a fit
+	const size_t ncalls = 10;
+
+	//K*(892) like resonance in m(K pi), with varying mass
+	auto shape = [] __hydra_dual__ (double m2, double mass){
+
+		double width = 0.05;
+		double d = m2 - mass*mass;
+
+		return 1.0/( d*d + mass*mass*width*width );
+	};
+
+	//invariants calculated from the final state particles
+	auto kinematics = hydra::wrap_lambda( [] __hydra_dual__ ( A a, B b, C c) {
+
+		return hydra::make_tuple( MSqAB((a+b).mass2()), MSqBC((b+c).mass2()) );
+	});
+
+	hydra::Vector4R Parent(P_mass, 0.0, 0.0, 0.0);
+
+	std::array<double, 3> masses{A_mass, B_mass, C_mass };
+
+	//device
+	{
+		hydra::PhaseSpaceIntegrator<3, hydra::device::sys_t> Regenerating(P_mass, masses, nentries);
+
+		hydra::PhaseSpaceIntegrator<3, hydra::device::sys_t> CachingEvents(P_mass, masses, nentries);
+		CachingEvents.SetSampleCaching(true);
+
+		hydra::PhaseSpaceIntegrator<3, hydra::device::sys_t, hydra::default_random_engine,
+			decltype(kinematics)> CachingInvariants(P_mass, masses, nentries, kinematics);
+
+		//time of the first call, which fills the caches, and of the following ones
+		double first_call[3]{0.0, 0.0, 0.0};
+		double elapsed[3]{0.0, 0.0, 0.0};
+
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| <BW(m(K pi))>(B0 -> J/psi K pi), "<< nentries << " events" << std::endl;
+		std::cout << "| mass     regenerating     cached events     cached invariants" << std::endl;
+
+		for(size_t call=0; call<ncalls; call++)
+		{
+			double mass = 0.85 + 0.01*call;
+
+			auto on_events = hydra::wrap_lambda( [=] __hydra_dual__ ( A a, B b, C c) {
+				return shape( (b+c).mass2(), mass);
+			});
+
+			auto on_invariants = hydra::wrap_lambda( [=] __hydra_dual__ ( MSqAB, MSqBC m2_bc) {
+				return shape( m2_bc, mass);
+			});
+
+			auto start = std::chrono::high_resolution_clock::now();
+			auto r0 = Regenerating.Integrate(on_events);
+			auto end = std::chrono::high_resolution_clock::now();
+			(call ? elapsed[0] : first_call[0]) += std::chrono::duration<double, std::milli>(end - start).count();
+
+			start = std::chrono::high_resolution_clock::now();
+			auto r1 = CachingEvents.Integrate(on_events);
+			end = std::chrono::high_resolution_clock::now();
+			(call ? elapsed[1] : first_call[1]) += std::chrono::duration<double, std::milli>(end - start).count();
+
+			start = std::chrono::high_resolution_clock::now();
+			auto r2 = CachingInvariants.Integrate(on_invariants);
+			end = std::chrono::high_resolution_clock::now();
+			(call ? elapsed[2] : first_call[2]) += std::chrono::duration<double, std::milli>(end - start).count();
+
+			std::cout << "| " << mass << "     " << r0.first << " +- " << r0.second
+					  << "     " << r1.first << " +- " << r1.second
+					  << "     " << r2.first << " +- " << r2.second << std::endl;
+		}
+
+		std::cout << "| Time (ms), first call / average of the following ones" << std::endl;
+		std::cout << "|     regenerating      : " << first_call[0] << " / " << elapsed[0]/(ncalls-1) << std::endl;
+		std::cout << "|     cached events     : " << first_call[1] << " / " << elapsed[1]/(ncalls-1) << std::endl;
+		std::cout << "|     cached invariants : " << first_call[2] << " / " << elapsed[2]/(ncalls-1) << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+	}//device
+
+	return 0;
+}
+
+#endif /* PHSP_CACHED_INTEGRATION_INL_ */
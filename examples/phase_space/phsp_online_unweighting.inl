@@ -0,0 +1,294 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+/*
+ * phsp_online_unweighting.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef PHSP_ONLINE_UNWEIGHTING_INL_
+#define PHSP_ONLINE_UNWEIGHTING_INL_
+
+
+/**
+ * \example phsp_online_unweighting.inl
+ * This example shows how to use the Hydra's
+ * streaming phase-space generator together with
+ * hydra::OnlineUnweighting to produce an unweighted sample
+ * of K -> pi pi pi, distributed according to a user functor,
+ * in a single pass and using a constant amount of memory.
+ */
+
+
+/*---------------------------------
+ * std
+ * ---------------------------------
+ */
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <numeric>
+
+/*---------------------------------
+ * command line arguments
+ *---------------------------------
+ */
+#include <tclap/CmdLine.h>
+
+/*---------------------------------
+ * Include hydra classes and
+ * algorithms for
+ *--------------------------------
+ */
+#include <hydra/Types.h>
+#include <hydra/Vector4R.h>
+#include <hydra/PhaseSpace.h>
+#include <hydra/PhaseSpaceStream.h>
+#include <hydra/OnlineUnweighting.h>
+#include <hydra/Function.h>
+#include <hydra/Lambda.h>
+#include <hydra/Algorithm.h>
+#include <hydra/Tuple.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+#include <hydra/Decays.h>
+#include <hydra/DenseHistogram.h>
+#include <hydra/Range.h>
+
+/*-------------------------------------
+ * Include classes from ROOT to fill
+ * and draw histograms and plots.
+ *-------------------------------------
+ */
+#ifdef _ROOT_AVAILABLE_
+
+#include <TROOT.h>
+#include <TH1D.h>
+#include <TF1.h>
+#include <TH2D.h>
+#include <TApplication.h>
+#include <TCanvas.h>
+#include <TColor.h>
+#include <TString.h>
+#include <TStyle.h>
+
+#endif //_ROOT_AVAILABLE_
+
+//---------------------------
+// Daughter particles
+
+declarg(A, hydra::Vector4R)
+declarg(B, hydra::Vector4R)
+declarg(C, hydra::Vector4R)
+
+//---------------------------
+using namespace hydra::arguments;
+
+int main(int argv, char** argc)
+{
+
+
+	size_t  nentries   = 0; // number of events to generate, to be get from command line
+	size_t  batch_size = 0; // number of events per batch, to be get from command line
+
+	double P_mass = 0.493677;
+	double A_mass = 0.13957061;
+	double B_mass = 0.13957061;
+	double C_mass = 0.13957061;
+
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for single-pass unweighting of K -> pi pi pi", '=');
+
+		TCLAP::ValueArg<size_t> NArg("n",
+				"nevents",
+				"Number of events to generate. Default is [ 10e6 ].",
+				true, 10e6, "unsigned long");
+		cmd.add(NArg);
+
+		TCLAP::ValueArg<size_t> BArg("b",
+				"batch",
+				"Number of events per batch. Default is [ 1e6 ].",
+				false, 1e6, "unsigned long");
+		cmd.add(BArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries       = NArg.getValue();
+		batch_size     = BArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+																<< std::endl;
+	}
+
+#ifdef 	_ROOT_AVAILABLE_
+	//
+	TH2D Dalitz_d("Dalitz_d",
+			"Unweighted 3-body sample;"
+			"M^{2}(A B) [GeV^{2}/c^{4}];"
+			"M^{2}(B C) [GeV^{2}/c^{4}]",
+			100, pow(A_mass + B_mass,2), pow(P_mass - C_mass,2),
+			100, pow(B_mass + C_mass,2), pow(P_mass - A_mass,2));
+
+#endif
+
+
+	hydra::Vector4R Parent(P_mass, 0.0, 0.0, 0.0);
+
+	double masses[3]{A_mass, B_mass, C_mass };
+
+	// Create PhaseSpace object for P-> A B C
+	hydra::PhaseSpace<3> phsp{P_mass, masses};
+
+	//a model peaking at the edges of the Dalitz plot
+	auto model = hydra::wrap_lambda(
+			[] __hydra_dual__ (A a, B b, C c) {
+
+		double m2ab = (a + b).mass2();
+		double m2bc = (b + c).mass2();
+
+		return 1.0 + 500.0*(m2ab - 0.12)*(m2ab - 0.12) + 500.0*(m2bc - 0.12)*(m2bc - 0.12);
+	});
+
+	auto dalitz_calculator = hydra::wrap_lambda(
+			[] __hydra_dual__ (A a, B b, C c) {
+
+		return hydra::make_tuple( (a + b).mass2(), (b + c).mass2());
+	});
+
+
+	//device
+	{
+		hydra::DenseHistogram<double, 2, hydra::device::sys_t> Hist_Dalitz(
+				{100,100},
+				{pow(A_mass + B_mass,2), pow(B_mass + C_mass,2)},
+				{pow(P_mass - C_mass,2), pow(P_mass - A_mass,2)});
+
+		std::vector<double> dalitz_contents(100*100 + 2, 0.0);
+
+		hydra::PhaseSpaceStream<hydra::tuple<A,B,C>, hydra::device::sys_t>
+		   stream(phsp, Parent, nentries, batch_size, true);
+
+		//maximum weight estimated from the first batch: 99.99% quantile with a 10% safety margin
+		hydra::OnlineUnweighting<hydra::device::sys_t> unweighter(0.9999, 1.1);
+
+		//residual weights of the accepted events: one, or weight/max for the events
+		//above the running maximum of the unweighter
+		hydra::device::vector<double> residuals(batch_size);
+
+		size_t naccepted = 0;
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		while( stream.HasNext() ){
+
+			auto& batch = stream.Next();
+
+			//single pass: the accepted events are moved to the front of the batch
+			auto accepted = batch.Unweight(model, unweighter, residuals);
+
+			naccepted += accepted.size();
+
+			auto dalitz_variables = accepted | dalitz_calculator ;
+
+			Hist_Dalitz.Fill( dalitz_variables.begin(), dalitz_variables.end(), residuals.begin() );
+
+			//the residual weights are relative to the maximum used for this batch, which can be
+			//raised afterwards: accumulate absolute weights and rescale when all batches are done
+			double batch_max_weight = unweighter.GetBatchStats(unweighter.GetNBatches() - 1).GetMaxWeight();
+
+			for(size_t i=0; i< dalitz_contents.size(); i++)
+				dalitz_contents[i] += batch_max_weight*Hist_Dalitz.GetContents()[i];
+		}
+
+		//contents in units of events unweighted at the final maximum
+		for(size_t i=0; i< dalitz_contents.size(); i++)
+			dalitz_contents[i] /= unweighter.GetMaxWeight();
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		//output
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| P -> A B C (single-pass unweighting)"   << std::endl;
+		std::cout << "| Number of events   :"<< nentries        << std::endl;
+		std::cout << "| Accepted events    :"<< naccepted       << std::endl;
+		std::cout << "| Rescaled events    :"<< std::accumulate(dalitz_contents.begin(), dalitz_contents.end(), 0.0) << std::endl;
+		std::cout << "| Final max. weight  :"<< unweighter.GetMaxWeight() << std::endl;
+		std::cout << "| Overshoot fraction :"<< unweighter.GetStats().GetOvershootFraction() << std::endl;
+		std::cout << "| Time (ms)          :"<< elapsed.count() << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		std::cout << "\n\n|~~~~> Efficiency per batch:\n " << std::endl;
+		for( size_t k=0; k<unweighter.GetNBatches(); k++ ){
+
+			auto stats = unweighter.GetBatchStats(k);
+
+			std::cout << "| Batch " << k
+					  << " max. weight: "  << stats.GetMaxWeight()
+					  << " efficiency: "   << stats.GetEfficiency()
+					  << " overshoots: "   << stats.GetNOvershoot()
+					  << " (fraction: "    << stats.GetOvershootFraction() << ")"
+					  << std::endl;
+		}
+
+#ifdef 	_ROOT_AVAILABLE_
+
+		for(size_t i=0; i< 100; i++){
+			for(size_t j=0; j< 100; j++){
+
+				Dalitz_d.SetBinContent(i+1, j+1, dalitz_contents[i*100+j] );
+			}
+		}
+#endif
+
+	}
+
+#ifdef 	_ROOT_AVAILABLE_
+
+	TApplication *m_app=new TApplication("myapp",0,0);
+
+
+	TCanvas canvas_d("canvas_d", "Phase-space Device", 500, 500);
+	Dalitz_d.Draw("colz");
+	canvas_d.Print("plots/phsp_online_unweighting_d.png");
+
+	m_app->Run();
+
+#endif
+
+	return 0;
+}
+
+
+#endif /* PHSP_ONLINE_UNWEIGHTING_INL_ */
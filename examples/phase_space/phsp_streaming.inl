@@ -0,0 +1,261 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+/*
+ * phsp_streaming.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef PHSP_STREAMING_INL_
+#define PHSP_STREAMING_INL_
+
+
+/**
+ * \example phsp_streaming.inl
+ * This example shows how to use the Hydra's
+ * streaming phase-space generator to
+ * produce a large sample of K -> pi pi pi
+ * in fixed-size batches and accumulate the Dalitz plot
+ * using a constant amount of memory.
+ */
+
+
+/*---------------------------------
+ * std
+ * ---------------------------------
+ */
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <vector>
+#include <array>
+#include <chrono>
+
+/*---------------------------------
+ * command line arguments
+ *---------------------------------
+ */
+#include <tclap/CmdLine.h>
+
+/*---------------------------------
+ * Include hydra classes and
+ * algorithms for
+ *--------------------------------
+ */
+#include <hydra/Types.h>
+#include <hydra/Vector4R.h>
+#include <hydra/PhaseSpace.h>
+#include <hydra/PhaseSpaceStream.h>
+#include <hydra/Function.h>
+#include <hydra/Lambda.h>
+#include <hydra/Algorithm.h>
+#include <hydra/Tuple.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+#include <hydra/Decays.h>
+#include <hydra/DenseHistogram.h>
+#include <hydra/Range.h>
+
+/*-------------------------------------
+ * Include classes from ROOT to fill
+ * and draw histograms and plots.
+ *-------------------------------------
+ */
+#ifdef _ROOT_AVAILABLE_
+
+#include <TROOT.h>
+#include <TH1D.h>
+#include <TF1.h>
+#include <TH2D.h>
+#include <TApplication.h>
+#include <TCanvas.h>
+#include <TColor.h>
+#include <TString.h>
+#include <TStyle.h>
+
+#endif //_ROOT_AVAILABLE_
+
+//---------------------------
+// Daughter particles
+
+declarg(A, hydra::Vector4R)
+declarg(B, hydra::Vector4R)
+declarg(C, hydra::Vector4R)
+
+//---------------------------
+using namespace hydra::arguments;
+
+int main(int argv, char** argc)
+{
+
+
+	size_t  nentries   = 0; // number of events to generate, to be get from command line
+	size_t  batch_size = 0; // number of events per batch, to be get from command line
+
+	double P_mass = 0.493677;
+	double A_mass = 0.13957061;
+	double B_mass = 0.13957061;
+	double C_mass = 0.13957061;
+
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for streaming PHSP K -> pi pi pi", '=');
+
+		TCLAP::ValueArg<size_t> NArg("n",
+				"nevents",
+				"Number of events to generate. Default is [ 10e6 ].",
+				true, 10e6, "unsigned long");
+		cmd.add(NArg);
+
+		TCLAP::ValueArg<size_t> BArg("b",
+				"batch",
+				"Number of events per batch. Default is [ 1e6 ].",
+				false, 1e6, "unsigned long");
+		cmd.add(BArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries       = NArg.getValue();
+		batch_size     = BArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+																<< std::endl;
+	}
+
+#ifdef 	_ROOT_AVAILABLE_
+	//
+	TH2D Dalitz_d("Dalitz_d",
+			"3-body phase-space;"
+			"M^{2}(A B) [GeV^{2}/c^{4}];"
+			"M^{2}(B C) [GeV^{2}/c^{4}]",
+			100, pow(A_mass + B_mass,2), pow(P_mass - C_mass,2),
+			100, pow(B_mass + C_mass,2), pow(P_mass - A_mass,2));
+
+#endif
+
+
+	hydra::Vector4R Parent(P_mass, 0.0, 0.0, 0.0);
+
+	double masses[3]{A_mass, B_mass, C_mass };
+
+	// Create PhaseSpace object for P-> A B C
+	hydra::PhaseSpace<3> phsp{P_mass, masses};
+
+
+	auto dalitz_calculator = hydra::wrap_lambda(
+			[] __hydra_dual__ (A a, B b, C c) {
+
+		return hydra::make_tuple( (a + b).mass2(), (b + c).mass2());
+	});
+
+
+	//device
+	for(bool double_buffering : {false, true} )
+	{
+		//the Dalitz plot is accumulated batch by batch
+		hydra::DenseHistogram<double, 2, hydra::device::sys_t> Hist_Dalitz(
+				{100,100},
+				{pow(A_mass + B_mass,2), pow(B_mass + C_mass,2)},
+				{pow(P_mass - C_mass,2), pow(P_mass - A_mass,2)});
+
+		std::vector<double> dalitz_contents(100*100 + 2, 0.0);
+
+		hydra::PhaseSpaceStream<hydra::tuple<A,B,C>, hydra::device::sys_t>
+		   stream(phsp, Parent, nentries, batch_size, double_buffering);
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		stream.ForEach( [&]( size_t , hydra::PhaseSpaceStream<hydra::tuple<A,B,C>,
+				hydra::device::sys_t>::decays_type const& batch ){
+
+			auto dalitz_variables = batch | dalitz_calculator ;
+
+			auto dalitz_weights   = batch | batch.GetEventWeightFunctor();
+
+			Hist_Dalitz.Fill( dalitz_variables.begin(), dalitz_variables.end(),
+					dalitz_weights.begin() );
+
+			for(size_t i=0; i< dalitz_contents.size(); i++)
+				dalitz_contents[i] += Hist_Dalitz.GetContents()[i];
+		});
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		//output
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| P -> A B C (streaming)"                 << std::endl;
+		std::cout << "| Number of events :"<< nentries          << std::endl;
+		std::cout << "| Batch size       :"<< batch_size        << std::endl;
+		std::cout << "| Number of batches:"<< stream.GetNBatches()<< std::endl;
+		std::cout << "| Double buffering :"<< double_buffering  << std::endl;
+		std::cout << "| Time (ms)        :"<< elapsed.count()   << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		//any batch can be regenerated in isolation
+		auto const& last = stream.GetBatch(stream.GetNBatches()-1);
+
+		std::cout << "\n\n|~~~~> Last batch (Vector4R, Vector4R, Vector4R):\n " << std::endl;
+		for( size_t i=0; i<5 && i<last.size(); i++ )
+			std::cout << last[i] << std::endl;
+
+#ifdef 	_ROOT_AVAILABLE_
+
+		if(double_buffering){
+
+			for(size_t i=0; i< 100; i++){
+				for(size_t j=0; j< 100; j++){
+
+					Dalitz_d.SetBinContent(i+1, j+1, dalitz_contents[i*100+j] );
+				}
+			}
+		}
+#endif
+
+	}
+
+#ifdef 	_ROOT_AVAILABLE_
+
+	TApplication *m_app=new TApplication("myapp",0,0);
+
+
+	TCanvas canvas_d("canvas_d", "Phase-space Device", 500, 500);
+	Dalitz_d.Draw("colz");
+	canvas_d.Print("plots/phsp_streaming_d.png");
+
+	m_app->Run();
+
+#endif
+
+	return 0;
+}
+
+
+#endif /* PHSP_STREAMING_INL_ */
@@ -0,0 +1,222 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * alias_sampling.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef ALIAS_SAMPLING_INL_
+#define ALIAS_SAMPLING_INL_
+
+
+/**
+ * \example alias_sampling.inl
+ * \brief This example shows how to sample a histogram-defined
+ * distribution using hydra::AliasTable, and compares the timing
+ * with the accept-reject method implemented in hydra::sample.
+ */
+
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/host/System.h>
+#include <hydra/Random.h>
+#include <hydra/AliasTable.h>
+#include <hydra/Algorithm.h>
+#include <hydra/Tuple.h>
+#include <hydra/functions/Gaussian.h>
+#include <hydra/DenseHistogram.h>
+/*-------------------------------------
+ * Include classes from ROOT to fill
+ * and draw histograms and plots.
+ *-------------------------------------
+ */
+#ifdef _ROOT_AVAILABLE_
+
+#include <TROOT.h>
+#include <TH1D.h>
+#include <TApplication.h>
+#include <TCanvas.h>
+
+#endif //_ROOT_AVAILABLE_
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", true, 10e6, "size_t");
+		cmd.add(EArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries = EArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	unsigned nrbins = 1000;
+	double min     =  0.0;
+	double max     = 10.0;
+	double mean    =  5.0;
+	double sigma   =  0.05;
+
+	//------------------------
+#ifdef _ROOT_AVAILABLE_
+
+	TH1D histo_template("template", "template", nrbins, min, max);
+	TH1D histo_alias("alias", "alias table sample", nrbins, min, max);
+	TH1D histo_ar("accept_reject", "accept-reject sample", nrbins, min, max);
+
+#endif //_ROOT_AVAILABLE_
+
+	//Gaussian distribution with a large peak-to-average ratio
+	auto Mean  = hydra::Parameter::Create("mean" ).Value(mean);
+	auto Sigma = hydra::Parameter::Create("sigma").Value(sigma);
+	auto gauss = hydra::Gaussian<double>(Mean, Sigma);
+
+	//device
+	{
+		//build a template histogram, as it would be obtained from data or simulation
+		hydra::device::vector<double> data(nentries);
+
+		hydra::sample(data, min, max, gauss);
+
+		auto Hist_Template = hydra::make_dense_histogram<double>( hydra::device::sys, nrbins, min, max, data);
+
+		//------------------
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		auto table = hydra::make_alias_table(hydra::device::sys, Hist_Template);
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		//output
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Alias table building                   "<< std::endl;
+		std::cout << "| Number of bins   :"<< table.GetNBins()  << std::endl;
+		std::cout << "| Time (ms)        :"<< elapsed.count()   << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		//------------------
+
+		hydra::device::vector<double> alias_sample(nentries);
+
+		start = std::chrono::high_resolution_clock::now();
+
+		table.Sample(alias_sample, 0x8ec74d321e6b5a27);
+
+		end = std::chrono::high_resolution_clock::now();
+
+		elapsed = end - start;
+
+		//output
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Alias table sampling                   "<< std::endl;
+		std::cout << "| Number of events :"<< nentries          << std::endl;
+		std::cout << "| Time (ms)        :"<< elapsed.count()   << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		auto Hist_Alias = hydra::make_dense_histogram<double>( hydra::device::sys, nrbins, min, max, alias_sample);
+
+		//------------------
+
+		hydra::device::vector<double> ar_sample(nentries);
+
+		start = std::chrono::high_resolution_clock::now();
+
+		auto range_ar = hydra::sample(ar_sample, min, max, gauss, 0x8ec74d321e6b5a27);
+
+		end = std::chrono::high_resolution_clock::now();
+
+		elapsed = end - start;
+
+		//output
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Accept-reject sampling                 "<< std::endl;
+		std::cout << "| Number of trials :"<< nentries          << std::endl;
+		std::cout << "| Number of events :"<< range_ar.size()   << std::endl;
+		std::cout << "| Time (ms)        :"<< elapsed.count()   << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		auto Hist_AR = hydra::make_dense_histogram<double>( hydra::device::sys, nrbins, min, max, range_ar);
+
+#ifdef _ROOT_AVAILABLE_
+		for(size_t i=0; i< nrbins; ++i){
+			histo_template.SetBinContent(i+1, Hist_Template.GetBinContent(i) );
+			histo_alias.SetBinContent(i+1, Hist_Alias.GetBinContent(i) );
+			histo_ar.SetBinContent(i+1, Hist_AR.GetBinContent(i) );
+		}
+#endif //_ROOT_AVAILABLE_
+
+	}
+
+#ifdef _ROOT_AVAILABLE_
+	TApplication *myapp=new TApplication("myapp",0,0);
+
+	//draw histograms
+	TCanvas canvas1("template" ,"", 1000, 1000);
+	histo_template.Draw("hist");
+
+	TCanvas canvas2("alias" ,"", 1000, 1000);
+	histo_alias.Draw("hist");
+
+	TCanvas canvas3("accept_reject" ,"", 1000, 1000);
+	histo_ar.Draw("hist");
+
+	myapp->Run();
+
+#endif //_ROOT_AVAILABLE_
+
+	return 0;
+
+}
+
+#endif /* ALIAS_SAMPLING_INL_ */
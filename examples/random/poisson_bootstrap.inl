@@ -0,0 +1,279 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * poisson_bootstrap.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef POISSON_BOOTSTRAP_INL_
+#define POISSON_BOOTSTRAP_INL_
+
+
+/**
+ * \example poisson_bootstrap.inl
+ * \brief This example shows how to estimate the uncertainties of a mean, a histogram
+ * and a log-likelihood with hydra::PoissonBootstrap, processing all replicas in a single pass,
+ * and compares the timing with the resampling of the dataset replica by replica using hydra::boost_strapped_range.
+ */
+
+
+#include <iostream>
+#include <assert.h>
+#include <time.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+//command line
+#include <tclap/CmdLine.h>
+
+//this lib
+#include <hydra/device/System.h>
+#include <hydra/host/System.h>
+#include <hydra/Random.h>
+#include <hydra/Range.h>
+#include <hydra/Algorithm.h>
+#include <hydra/PoissonBootstrap.h>
+#include <hydra/functions/Gaussian.h>
+#include <hydra/detail/external/hydra_thrust/reduce.h>
+/*-------------------------------------
+ * Include classes from ROOT to fill
+ * and draw histograms and plots.
+ *-------------------------------------
+ */
+#ifdef _ROOT_AVAILABLE_
+
+#include <TROOT.h>
+#include <TH1D.h>
+#include <TApplication.h>
+#include <TCanvas.h>
+
+#endif //_ROOT_AVAILABLE_
+
+
+int main(int argv, char** argc)
+{
+	size_t nentries  = 0;
+	size_t nreplicas = 0;
+
+	try {
+
+		TCLAP::CmdLine cmd("Command line arguments for ", '=');
+
+		TCLAP::ValueArg<size_t> EArg("n", "number-of-events","Number of events", true, 1e6, "size_t");
+		cmd.add(EArg);
+
+		TCLAP::ValueArg<size_t> BArg("b", "number-of-replicas","Number of bootstrap replicas", false, 200, "size_t");
+		cmd.add(BArg);
+
+		// Parse the argv array.
+		cmd.parse(argv, argc);
+
+		// Get the value parsed by each arg.
+		nentries  = EArg.getValue();
+		nreplicas = BArg.getValue();
+
+	}
+	catch (TCLAP::ArgException &e)  {
+		std::cerr << "error: " << e.error() << " for arg " << e.argId()
+														<< std::endl;
+	}
+
+	unsigned nbins = 50;
+	double min     = -5.0;
+	double max     =  5.0;
+	double mean    =  0.0;
+	double sigma   =  1.0;
+
+	auto Mean  = hydra::Parameter::Create("mean" ).Value(mean);
+	auto Sigma = hydra::Parameter::Create("sigma").Value(sigma);
+	auto gauss = hydra::Gaussian<double>(Mean, Sigma);
+
+	//------------------------
+#ifdef _ROOT_AVAILABLE_
+
+	TH1D histo_means("means", "bootstrap distribution of the mean", 100, -5.0*sigma/std::sqrt(nentries), 5.0*sigma/std::sqrt(nentries));
+	TH1D histo_data("data", "data with bootstrap uncertainties", nbins, min, max);
+
+#endif //_ROOT_AVAILABLE_
+
+	//device
+	{
+		hydra::device::vector<double> data(nentries);
+
+		hydra::fill_random(data, gauss);
+
+		hydra::PoissonBootstrap<hydra::device::sys_t> bootstrap(nreplicas);
+
+		//------------------
+		// all replicas of the mean in one pass
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		auto means = bootstrap.Mean(data, [] __hydra_dual__ (double x){ return x; });
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::chrono::duration<double, std::milli> elapsed = end - start;
+
+		double sum=0, sum2=0;
+
+		for(auto m: means){ sum += m; sum2 += m*m; }
+
+		double bs_mean  = sum/nreplicas;
+		double bs_error = std::sqrt(sum2/nreplicas - bs_mean*bs_mean);
+
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Poisson bootstrap of the mean           "<< std::endl;
+		std::cout << "| Number of events   :"<< nentries           << std::endl;
+		std::cout << "| Number of replicas :"<< nreplicas          << std::endl;
+		std::cout << "| Mean               :"<< bs_mean << " +- " << bs_error << std::endl;
+		std::cout << "| Expected error     :"<< sigma/std::sqrt(nentries)  << std::endl;
+		std::cout << "| Time (ms)          :"<< elapsed.count()    << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		//------------------
+		// same, resampling the dataset replica by replica
+
+		start = std::chrono::high_resolution_clock::now();
+
+		std::vector<double> resampled_means(nreplicas);
+
+		for(size_t b=0; b<nreplicas; b++){
+
+			auto resampled = hydra::boost_strapped_range( data, b );
+
+			resampled_means[b] = hydra::thrust::reduce(hydra::device::sys,
+					resampled.begin(), resampled.end(), 0.0)/resampled.size();
+		}
+
+		end = std::chrono::high_resolution_clock::now();
+
+		elapsed = end - start;
+
+		sum=0; sum2=0;
+
+		for(auto m: resampled_means){ sum += m; sum2 += m*m; }
+
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Resampling bootstrap of the mean        "<< std::endl;
+		std::cout << "| Number of replicas :"<< nreplicas          << std::endl;
+		std::cout << "| Mean               :"<< sum/nreplicas << " +- "
+				  << std::sqrt(sum2/nreplicas - sum*sum/(nreplicas*nreplicas)) << std::endl;
+		std::cout << "| Time (ms)          :"<< elapsed.count()    << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		//------------------
+		// bin-by-bin uncertainties of a histogram
+
+		start = std::chrono::high_resolution_clock::now();
+
+		auto histograms = bootstrap.Histogram(data, nbins, min, max);
+
+		end = std::chrono::high_resolution_clock::now();
+
+		elapsed = end - start;
+
+		std::vector<double> bin_mean(nbins, 0.0), bin_error(nbins, 0.0);
+
+		for(size_t k=0; k<nbins; k++){
+
+			double s=0, s2=0;
+
+			for(size_t b=0; b<nreplicas; b++){ s += histograms[b][k]; s2 += histograms[b][k]*histograms[b][k]; }
+
+			bin_mean[k]  = s/nreplicas;
+			bin_error[k] = std::sqrt(s2/nreplicas - bin_mean[k]*bin_mean[k]);
+		}
+
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Poisson bootstrap of a histogram        "<< std::endl;
+		std::cout << "| Central bin        :"<< bin_mean[nbins/2] << " +- " << bin_error[nbins/2] << std::endl;
+		std::cout << "| Expected error     :"<< std::sqrt(bin_mean[nbins/2])  << std::endl;
+		std::cout << "| Time (ms)          :"<< elapsed.count()    << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+		//------------------
+		// log-likelihood of all replicas, at fixed parameters
+
+		start = std::chrono::high_resolution_clock::now();
+
+		auto logL = bootstrap.Sum(data, [=] __hydra_dual__ (double x){
+
+			return -0.5*(x-mean)*(x-mean)/(sigma*sigma) - ::log(sigma*::sqrt(2.0*PI));
+		});
+
+		end = std::chrono::high_resolution_clock::now();
+
+		elapsed = end - start;
+
+		sum=0; sum2=0;
+
+		for(auto l: logL){ sum += l; sum2 += l*l; }
+
+		std::cout << std::endl;
+		std::cout << std::endl;
+		std::cout << "----------------- Device ----------------"<< std::endl;
+		std::cout << "| Poisson bootstrap of a log-likelihood   "<< std::endl;
+		std::cout << "| Log-likelihood     :"<< sum/nreplicas << " +- "
+				  << std::sqrt(sum2/nreplicas - sum*sum/(nreplicas*nreplicas)) << std::endl;
+		std::cout << "| Time (ms)          :"<< elapsed.count()    << std::endl;
+		std::cout << "-----------------------------------------"<< std::endl;
+
+#ifdef _ROOT_AVAILABLE_
+		for(auto m: means) histo_means.Fill(m - mean);
+
+		for(size_t k=0; k< nbins; ++k){
+			histo_data.SetBinContent(k+1, bin_mean[k] );
+			histo_data.SetBinError(k+1, bin_error[k] );
+		}
+#endif //_ROOT_AVAILABLE_
+
+	}
+
+#ifdef _ROOT_AVAILABLE_
+	TApplication *myapp=new TApplication("myapp",0,0);
+
+	//draw histograms
+	TCanvas canvas1("means" ,"", 1000, 1000);
+	histo_means.Draw("hist");
+
+	TCanvas canvas2("data" ,"", 1000, 1000);
+	histo_data.Draw("E1");
+
+	myapp->Run();
+
+#endif //_ROOT_AVAILABLE_
+
+	return 0;
+
+}
+
+#endif /* POISSON_BOOTSTRAP_INL_ */
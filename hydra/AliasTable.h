@@ -0,0 +1,353 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * AliasTable.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef ALIASTABLE_H_
+#define ALIASTABLE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/detail/Dimensionality.h>
+#include <hydra/detail/Iterable_traits.h>
+#include <hydra/detail/HistogramTraits.h>
+#include <hydra/detail/PRNGTypedefs.h>
+#include <hydra/detail/functors/AliasSampler.h>
+#include <hydra/DenseHistogram.h>
+#include <hydra/Range.h>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace hydra {
+
+/**
+ * \ingroup random
+ */
+template<size_t N, typename BACKEND, typename GRND=hydra::default_random_engine>
+class AliasTable;
+
+/**
+ * \ingroup random
+ * \brief Walker/Vose alias table for O(1) sampling of discrete and histogram-defined distributions.
+ *
+ * The table is built once from a set of non-negative weights, or from the contents of a
+ * hydra::DenseHistogram, and stored in the memory space of BACKEND. Each draw costs two random numbers
+ * and two table lookups, independently of the shape of the distribution, so that
+ * the sampling time does not depend on the peak-to-average ratio of the weights, as it does in accept-reject.
+ *
+ * Two sampling modes are provided:
+ *
+ *  - AliasTable::SampleIndexes(...) : fills a range with global bin indexes (discrete sampling).
+ *  - AliasTable::Sample(...) : fills a range with points distributed uniformly inside
+ *  the selected bins (piecewise-uniform sampling of histograms).
+ *
+ * Sample `i` uses the block of random numbers starting at (i+rng_jump)*(N+2) of the counter-based generator,
+ * so the same seed produces the same bins in both modes and any subrange can be regenerated in isolation.
+ *
+ * \tparam N number of dimensions of the histogram.
+ * \tparam BACKEND memory space where the table is allocated.
+ * \tparam GRND underlying random number engine.
+ */
+template<size_t N, hydra::detail::Backend BACKEND, typename GRND>
+class AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND>    system_t;
+
+	typedef typename system_t::template container<double> probability_storage_t;
+	typedef typename system_t::template container<size_t> alias_storage_t;
+
+	typedef typename probability_storage_t::const_iterator probability_iterator;
+	typedef typename alias_storage_t::const_iterator alias_iterator;
+
+public:
+
+	typedef detail::AliasIndex<GRND, probability_iterator, alias_iterator, N+2> index_sampler_type;
+	typedef detail::AliasSampler<N, GRND, probability_iterator, alias_iterator> point_sampler_type;
+
+	AliasTable()=delete;
+
+	/**
+	 * \brief Build a table for discrete sampling from the weights [wbegin, wend).
+	 * The bins are the unit intervals [i, i+1), with i the position of the weight in the range.
+	 */
+	template<typename Iterator, size_t M=N, typename = typename std::enable_if<M==1, void>::type>
+	AliasTable(Iterator wbegin, Iterator wend):
+		fNBins(hydra::thrust::distance(wbegin, wend)),
+		fNorm(0)
+	{
+		fGrid[0]=fNBins;
+		fLowerLimits[0]=0.0;
+		fUpperLimits[0]=double(fNBins);
+
+		Build(wbegin);
+	}
+
+	/**
+	 * \brief Build a table from the weights of a N-dimensional regular grid.
+	 * The weights are indexed as k = i_1*(dim_2*...*dim_n) + ... + i_n, as in hydra::DenseHistogram.
+	 */
+	template<typename Iterator>
+	AliasTable(std::array<size_t, N> const& grid,
+			std::array<double, N> const& lowerlimits, std::array<double, N> const& upperlimits,
+			Iterator wbegin):
+		fNBins(1),
+		fNorm(0)
+	{
+		for( size_t i=0; i<N; i++){
+			fGrid[i]=grid[i];
+			fLowerLimits[i]=lowerlimits[i];
+			fUpperLimits[i]=upperlimits[i];
+			fNBins *=grid[i];
+		}
+
+		Build(wbegin);
+	}
+
+	/**
+	 * \brief Build a table from the contents of a N-dimensional dense histogram.
+	 * Underflow and overflow bins are ignored.
+	 */
+	template<typename T, hydra::detail::Backend BACKEND2>
+	AliasTable(DenseHistogram<T, N, hydra::detail::BackendPolicy<BACKEND2>, detail::multidimensional> const& histogram):
+		fNBins(histogram.GetNBins()),
+		fNorm(0)
+	{
+		for( size_t i=0; i<N; i++){
+			fGrid[i]=histogram.GetGrid(i);
+			fLowerLimits[i]=histogram.GetLowerLimits(i);
+			fUpperLimits[i]=histogram.GetUpperLimits(i);
+		}
+
+		Build(histogram.begin());
+	}
+
+	/**
+	 * \brief Build a table from the contents of a one-dimensional dense histogram.
+	 * Underflow and overflow bins are ignored.
+	 */
+	template<typename T, hydra::detail::Backend BACKEND2>
+	AliasTable(DenseHistogram<T, 1, hydra::detail::BackendPolicy<BACKEND2>, detail::unidimensional> const& histogram):
+		fNBins(histogram.GetNBins()),
+		fNorm(0)
+	{
+		fGrid[0]=histogram.GetGrid();
+		fLowerLimits[0]=histogram.GetLowerLimits();
+		fUpperLimits[0]=histogram.GetUpperLimits();
+
+		Build(histogram.begin());
+	}
+
+	AliasTable(AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND> const& other):
+		fNBins(other.GetNBins()),
+		fNorm(other.GetNorm()),
+		fProbabilities(other.GetProbabilities()),
+		fAliases(other.GetAliases())
+	{
+		for( size_t i=0; i<N; i++){
+			fGrid[i]=other.GetGrid(i);
+			fLowerLimits[i]=other.GetLowerLimits(i);
+			fUpperLimits[i]=other.GetUpperLimits(i);
+		}
+	}
+
+	AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>&
+	operator=(AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND> const& other)
+	{
+		if(this==&other) return *this;
+
+		fNBins = other.GetNBins();
+		fNorm  = other.GetNorm();
+		fProbabilities = other.GetProbabilities();
+		fAliases = other.GetAliases();
+
+		for( size_t i=0; i<N; i++){
+			fGrid[i]=other.GetGrid(i);
+			fLowerLimits[i]=other.GetLowerLimits(i);
+			fUpperLimits[i]=other.GetUpperLimits(i);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * \brief Fill the range [begin, end) with global bin indexes distributed according to the weights.
+	 */
+	template<typename Iterator>
+	inline Range<Iterator>
+	SampleIndexes(Iterator begin, Iterator end, size_t seed=0x8ec74d321e6b5a27, size_t rng_jump=0) const;
+
+	/**
+	 * \brief Fill the range [begin, end) with points distributed according to the weights,
+	 * uniformly inside each bin. For N>1 the range value type should be a tuple of N elements.
+	 */
+	template<typename Iterator>
+	inline Range<Iterator>
+	Sample(Iterator begin, Iterator end, size_t seed=0x8ec74d321e6b5a27, size_t rng_jump=0) const;
+
+	template<typename Iterable>
+	inline typename std::enable_if< hydra::detail::is_iterable<Iterable>::value,
+	Range<decltype(std::declval<Iterable>().begin())>>::type
+	SampleIndexes(Iterable&& output, size_t seed=0x8ec74d321e6b5a27, size_t rng_jump=0) const
+	{
+		return SampleIndexes(std::forward<Iterable>(output).begin(),
+				std::forward<Iterable>(output).end(), seed, rng_jump);
+	}
+
+	template<typename Iterable>
+	inline typename std::enable_if< hydra::detail::is_iterable<Iterable>::value,
+	Range<decltype(std::declval<Iterable>().begin())>>::type
+	Sample(Iterable&& output, size_t seed=0x8ec74d321e6b5a27, size_t rng_jump=0) const
+	{
+		return Sample(std::forward<Iterable>(output).begin(),
+				std::forward<Iterable>(output).end(), seed, rng_jump);
+	}
+
+	/**
+	 * \brief Get the functor that draws the global bin index of the sample `i`.
+	 */
+	inline index_sampler_type
+	GetIndexSampler(size_t seed=0x8ec74d321e6b5a27, size_t rng_jump=0) const {
+
+		return index_sampler_type(seed, rng_jump, fNBins,
+				fProbabilities.begin(), fAliases.begin());
+	}
+
+	/**
+	 * \brief Get the functor that draws the point of the sample `i`.
+	 */
+	inline point_sampler_type
+	GetPointSampler(size_t seed=0x8ec74d321e6b5a27, size_t rng_jump=0) const {
+
+		std::array<size_t, N> grid;
+		std::array<double, N> lower;
+		std::array<double, N> upper;
+
+		for( size_t i=0; i<N; i++){
+			grid[i]=fGrid[i];
+			lower[i]=fLowerLimits[i];
+			upper[i]=fUpperLimits[i];
+		}
+
+		return point_sampler_type(seed, rng_jump, fNBins,
+				fProbabilities.begin(), fAliases.begin(), grid, lower, upper);
+	}
+
+	inline size_t GetNBins() const {
+		return fNBins;
+	}
+
+	/**
+	 * \brief Sum of the weights used to build the table.
+	 */
+	inline double GetNorm() const {
+		return fNorm;
+	}
+
+	inline size_t GetGrid(size_t i) const {
+		return fGrid[i];
+	}
+
+	inline double GetLowerLimits(size_t i) const {
+		return fLowerLimits[i];
+	}
+
+	inline double GetUpperLimits(size_t i) const {
+		return fUpperLimits[i];
+	}
+
+	inline const probability_storage_t& GetProbabilities() const {
+		return fProbabilities;
+	}
+
+	inline const alias_storage_t& GetAliases() const {
+		return fAliases;
+	}
+
+private:
+
+	template<typename Iterator>
+	void Build(Iterator wbegin);
+
+	double fUpperLimits[N];
+	double fLowerLimits[N];
+	size_t fGrid[N];
+	size_t fNBins;
+	double fNorm;
+	probability_storage_t fProbabilities;
+	alias_storage_t fAliases;
+	system_t fSystem;
+
+};
+
+/**
+ * \ingroup random
+ * \brief Function to make an alias table from the weights [wbegin, wend), for discrete sampling.
+ *
+ * @param backend memory space where the table will be allocated.
+ * @param wbegin iterator pointing to the begin of the range of weights.
+ * @param wend iterator pointing to the end of the range of weights.
+ * @return
+ */
+template<typename GRND=hydra::default_random_engine, typename Iterator, hydra::detail::Backend BACKEND>
+AliasTable<1, hydra::detail::BackendPolicy<BACKEND>, GRND>
+make_alias_table( hydra::detail::BackendPolicy<BACKEND> const& backend, Iterator wbegin, Iterator wend);
+
+/**
+ * \ingroup random
+ * \brief Function to make an alias table from a iterable storing weights, for discrete sampling.
+ *
+ * @param backend memory space where the table will be allocated.
+ * @param weights the range of weights.
+ * @return
+ */
+template<typename GRND=hydra::default_random_engine, typename Iterable, hydra::detail::Backend BACKEND>
+inline typename std::enable_if< hydra::detail::is_iterable<Iterable>::value &&
+!hydra::detail::is_hydra_dense_histogram<typename std::decay<Iterable>::type>::value,
+AliasTable<1, hydra::detail::BackendPolicy<BACKEND>, GRND>>::type
+make_alias_table( hydra::detail::BackendPolicy<BACKEND> const& backend, Iterable&& weights);
+
+/**
+ * \ingroup random
+ * \brief Function to make an alias table from a N-dimensional dense histogram.
+ *
+ * @param backend memory space where the table will be allocated.
+ * @param histogram the histogram.
+ * @return
+ */
+template<typename GRND=hydra::default_random_engine, typename T, size_t N, typename D,
+hydra::detail::Backend BACKEND, hydra::detail::Backend BACKEND2>
+AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>
+make_alias_table( hydra::detail::BackendPolicy<BACKEND> const& backend,
+		DenseHistogram<T, N, hydra::detail::BackendPolicy<BACKEND2>, D> const& histogram);
+
+}  // namespace hydra
+
+#include <hydra/detail/AliasTable.inl>
+
+#endif /* ALIASTABLE_H_ */
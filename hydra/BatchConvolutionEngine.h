@@ -0,0 +1,295 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * BatchConvolutionEngine.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef BATCHCONVOLUTIONENGINE_H_
+#define BATCHCONVOLUTIONENGINE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/FFTPolicy.h>
+#include <hydra/detail/Convolution.inl>
+#include <hydra/detail/BatchFFT.h>
+#include <hydra/detail/Iterable_traits.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+
+#include <map>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hydra {
+
+template<typename FFTPolicy>
+class BatchConvolutionEngine;
+
+/**
+ * \ingroup generic
+ * \brief FFT convolution of a batch of M functor/kernel pairs sampled over the same range and number of points.
+ *
+ * Each call samples all functors and kernels in one pass, runs the forward and backward transforms of the whole batch
+ * and writes the M results in one pass, so the fixed cost of a call is paid once per batch and not once per problem,
+ * which dominates when M is large and the number of samples small, as in simultaneous fits with one resolution model
+ * per category.
+ *
+ * The real samples are packed two by two in complex sequences, of length 2*nsamples, whose spectra are separated using the
+ * Hermitian symmetry of the spectra of real sequences. The forward pass transforms one sequence per problem,
+ * packing its functor and kernel, or one sequence per two problems when the kernel spectra are cached, and
+ * the backward pass one sequence per two problems. The batch is processed by one batched plan: the native plans run it in the same
+ * passes, FFTW through its advanced interface and cuFFT through a batched plan.
+ *
+ * The results are the same as ConvolutionEngine::Convolute for each problem, with the same sampling conventions and
+ * normalization. The kernel spectra are cached, and the kernel transforms skipped, while the keys of the parameters of all kernels,
+ * the sampling step and the number of samples do not change. The engine is not copyable and not thread-safe.
+ *
+ * \tparam FFTPolicy hydra::detail::FFTPolicy<T, FFTCalculator>, which sets the precision and the FFT library.
+ */
+template<typename T, detail::FFTCalculator FFTBackend>
+class BatchConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>
+{
+	typedef hydra::complex<T> complex_type;
+	typedef detail::convolution::BatchFFT<T, FFTBackend> batch_fft_type;
+	typedef typename detail::FFTPolicy<T, FFTBackend>::device_backend_type::template container<complex_type> complex_storage_type;
+
+	/*
+	 * forward and backward plans for sequences of `size` points
+	 */
+	struct plans_t
+	{
+		plans_t(size_t size):
+			fForward(size, -1),
+			fBackward(size, +1)
+		{}
+
+		batch_fft_type fForward;
+		batch_fft_type fBackward;
+	};
+
+public:
+
+	BatchConvolutionEngine():
+		fKernelCaching(true),
+		fKernelValid(false),
+		fKernelDelta(0),
+		fKernelNSamples(0),
+		fNKernelTransforms(0)
+	{}
+
+	BatchConvolutionEngine(BatchConvolutionEngine<detail::FFTPolicy<T, FFTBackend>> const&)=delete;
+
+	BatchConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>&
+	operator=(BatchConvolutionEngine<detail::FFTPolicy<T, FFTBackend>> const&)=delete;
+
+	/**
+	 * @brief Samples the convolutions of functors[m] and kernels[m], m in [0, M), in [min, max).
+	 * @param policy back end used to sample the functors and combine the spectra.
+	 * @param functors signals.
+	 * @param kernels convolution kernels, one per signal.
+	 * @param min lower limit of the sampling region.
+	 * @param max upper limit of the sampling region.
+	 * @param nsamples number of samples of each convolution.
+	 * @param output container with at least M*nsamples elements, receiving the convolution m in [m*nsamples, (m+1)*nsamples).
+	 */
+	template<detail::Backend BACKEND, typename Functor, typename Kernel, typename Iterable>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, void>::type
+	Convolute(detail::BackendPolicy<BACKEND> policy,
+			std::vector<Functor> const& functors, std::vector<Kernel> const& kernels,
+			T min, T max, size_t nsamples, Iterable&& output);
+
+	/**
+	 * @brief Forgets the spectra of the kernels, which are recomputed in the next call.
+	 */
+	inline void ResetKernel() {
+		fKernelValid = false;
+	}
+
+	/**
+	 * @brief Releases all plans and buffers.
+	 */
+	inline void Reset()
+	{
+		fPlans.clear();
+
+		fSamples.clear();   fSamples.shrink_to_fit();
+		fSpectra.clear();   fSpectra.shrink_to_fit();
+		fKernels.clear();   fKernels.shrink_to_fit();
+		fProducts.clear();  fProducts.shrink_to_fit();
+		fResults.clear();   fResults.shrink_to_fit();
+
+		fKernelValid = false;
+	}
+
+	inline bool IsKernelCaching() const {
+		return fKernelCaching;
+	}
+
+	inline void SetKernelCaching(bool kernelCaching) {
+		fKernelCaching = kernelCaching;
+	}
+
+	/**
+	 * @brief Number of sizes with allocated plans.
+	 */
+	inline size_t GetNPlans() const {
+		return fPlans.size();
+	}
+
+	/**
+	 * @brief Number of times the kernels of the batch were sampled and transformed.
+	 */
+	inline size_t GetNKernelTransforms() const {
+		return fNKernelTransforms;
+	}
+
+private:
+
+	inline plans_t& GetPlans(size_t size)
+	{
+		auto& plans = fPlans[size];
+
+		if( !plans ) plans.reset(new plans_t(size));
+
+		return *plans;
+	}
+
+	inline complex_type* Reserve(complex_storage_type& storage, size_t size)
+	{
+		if( storage.size() < size ) storage.resize(size);
+
+		return hydra::thrust::raw_pointer_cast(storage.data());
+	}
+
+	bool   fKernelCaching;
+	bool   fKernelValid;
+	T      fKernelDelta;
+	size_t fKernelNSamples;
+	size_t fNKernelTransforms;
+	std::vector<size_t> fKernelKeys;
+	std::map<size_t, std::unique_ptr<plans_t>> fPlans;
+	complex_storage_type fSamples;
+	complex_storage_type fSpectra;
+	complex_storage_type fKernels;
+	complex_storage_type fProducts;
+	complex_storage_type fResults;
+};
+
+template<typename T, detail::FFTCalculator FFTBackend>
+template<detail::Backend BACKEND, typename Functor, typename Kernel, typename Iterable>
+inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, void>::type
+BatchConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>::Convolute(detail::BackendPolicy<BACKEND> policy,
+		std::vector<Functor> const& functors, std::vector<Kernel> const& kernels,
+		T min, T max, size_t nsamples, Iterable&& output)
+{
+	size_t nproblems = functors.size();
+
+	if( nproblems == 0 )
+		throw std::invalid_argument("[hydra::BatchConvolutionEngine]: Empty batch. (functors.size()==0)");
+
+	if( kernels.size() != nproblems )
+		throw std::invalid_argument("[hydra::BatchConvolutionEngine]: Number of kernels and functors differ. (kernels.size() != functors.size())");
+
+	if( nsamples == 0 )
+		throw std::invalid_argument("[hydra::BatchConvolutionEngine]: Number of samples is zero. (nsamples==0)");
+
+	if( std::forward<Iterable>(output).size() < nproblems*nsamples )
+		throw std::invalid_argument("[hydra::BatchConvolutionEngine]: Output smaller than the batch. (output.size() < functors.size()*nsamples)");
+
+	T delta = (max - min)/nsamples;
+
+	size_t length = 2*nsamples;
+	size_t npairs = (nproblems + 1)/2;
+
+	plans_t& plans = GetPlans(length);
+
+	// check the kernel spectra
+	std::vector<size_t> kernel_keys(nproblems);
+
+	for(size_t m=0; m<nproblems; m++)
+		kernel_keys[m] = Kernel(kernels[m]).GetParametersKey();
+
+	bool with_kernels = !( fKernelCaching && fKernelValid && fKernelDelta == delta
+			&& fKernelNSamples == nsamples && fKernelKeys == kernel_keys );
+
+	// functors and kernels in the memory of the back end, filled and then copied, as the range constructors fail across systems
+	typename detail::BackendPolicy<BACKEND>::template container<Functor> functors_d(nproblems, functors[0]);
+	typename detail::BackendPolicy<BACKEND>::template container<Kernel>  kernels_d(nproblems, kernels[0]);
+
+	hydra::thrust::copy(functors.begin(), functors.end(), functors_d.begin());
+	hydra::thrust::copy(kernels.begin(), kernels.end(), kernels_d.begin());
+
+	size_t nsequences = with_kernels ? nproblems : npairs;
+
+	complex_type* samples  = Reserve(fSamples,  nproblems*length);
+	complex_type* spectra  = Reserve(fSpectra,  nproblems*length);
+	complex_type* spectra_k= Reserve(fKernels,  nproblems*length);
+	complex_type* products = Reserve(fProducts, npairs*length);
+	complex_type* results  = Reserve(fResults,  npairs*length);
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+
+	// sample and transform
+	hydra::thrust::transform(policy, first, first + nsequences*length, samples,
+			detail::convolution::BatchSampler<Functor, Kernel, T>(
+					hydra::thrust::raw_pointer_cast(functors_d.data()),
+					hydra::thrust::raw_pointer_cast(kernels_d.data()),
+					nproblems, nsamples, min, delta, with_kernels) );
+
+	plans.fForward.Execute(policy, samples, spectra, nsequences);
+
+	if( with_kernels )
+	{
+		hydra::thrust::transform(policy, first, first + nproblems*length, spectra_k,
+				detail::convolution::BatchKernelSpectrum<T>(spectra, length) );
+
+		fKernelKeys     = kernel_keys;
+		fKernelDelta    = delta;
+		fKernelNSamples = nsamples;
+		fKernelValid    = true;
+
+		++fNKernelTransforms;
+	}
+
+	// products, two problems per sequence, and backward transform
+	hydra::thrust::transform(policy, first, first + npairs*length, products,
+			detail::convolution::BatchProduct<T>(spectra, spectra_k, nproblems, length, with_kernels) );
+
+	plans.fBackward.Execute(policy, products, results, npairs);
+
+	hydra::thrust::transform(policy, first, first + nproblems*nsamples, std::forward<Iterable>(output).begin(),
+			detail::convolution::BatchExtract<T>(results, nsamples) );
+}
+
+}  // namespace hydra
+
+#endif /* BATCHCONVOLUTIONENGINE_H_ */
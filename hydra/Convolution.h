@@ -39,6 +39,7 @@
 #include <hydra/Zip.h>
 #include <hydra/Complex.h>
 #include <hydra/detail/Convolution.inl>
+#include <hydra/ConvolutionEngine.h>
 #include <hydra/detail/ArgumentTraits.h>
 #include <hydra/detail/external/hydra_thrust/transform.h>
 #include <hydra/detail/external/hydra_thrust/reduce.h>
@@ -47,6 +48,7 @@
 #if HYDRA_DEVICE_SYSTEM == CUDA
 #include <hydra/detail/external/hydra_thrust/system/cuda/detail/execution_policy.h>
 #endif
+#include <array>
 #include <utility>
 #include <type_traits>
 
@@ -74,99 +76,52 @@ convolute(detail::BackendPolicy<BACKEND> policy, detail::FFTPolicy<T, FFTBackend
 		  T min,  T max, Iterable&& output, bool power_up=true ){
 
 
-	typedef hydra::complex<double> complex_type;
-	typedef typename detail::FFTPolicy<T, FFTBackend>::R2C _RealToComplexFFT;
-	typedef typename detail::FFTPolicy<T, FFTBackend>::C2R _ComplexToRealFFT;
+	ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>> engine;
 
+	engine.Convolute(policy, functor, kernel, min, max, std::forward<Iterable>(output), power_up);
+}
 
-	if(power_up) {
-		std::forward<Iterable>(output).resize(
-				hydra::detail::convolution::upper_power_of_two(std::forward<Iterable>(output).size()));
-	}
-
-	int nsamples = std::forward<Iterable>(output).size();
-
-	T delta = (max - min)/(nsamples);
-
-	auto complex_buffer  = hydra::thrust::get_temporary_buffer<complex_type>(policy, nsamples+1);
-	auto kernel_samples  = hydra::thrust::get_temporary_buffer<T>(policy, 2*nsamples);
-	auto functor_samples = hydra::thrust::get_temporary_buffer<T>(policy, 2*nsamples);
-
-	//
-
-	auto counting_samples = range(0, 2*nsamples);
-
-	// sample kernel
-	auto kernel_sampler = hydra::detail::convolution::KernelSampler<Kernel>(kernel, nsamples, delta);
-
-	hydra::thrust::transform(policy, counting_samples.begin(), counting_samples.end(),
-			kernel_samples.first , kernel_sampler);
-
-
-	//auto norm_factor = hydra::thrust::reduce(policy, kernel_samples.first, kernel_samples.first + kernel_samples.second );
-
-
-	// sample function
-	auto functor_sampler = hydra::detail::convolution::FunctorSampler<Functor>(functor, nsamples,  min, delta);
-
-	hydra::thrust::transform( policy, counting_samples.begin(), counting_samples.end(),
-			functor_samples.first, functor_sampler);
-
-	//norm_factor *= hydra::thrust::reduce(policy, functor_samples.first, functor_samples.first + functor_samples.second );
-
-	//transform kernel
-	auto fft_kernel = _RealToComplexFFT( kernel_samples.second );
-
-	fft_kernel.LoadInputData( kernel_samples.second, kernel_samples.first);
-	fft_kernel.Execute();
-
-	auto fft_kernel_output =  fft_kernel.GetOutputData();
-	auto fft_kernel_range  = make_range( fft_kernel_output.first,
-			fft_kernel_output.first + fft_kernel_output.second);
-
-	//transform functor
-	auto fft_functor = _RealToComplexFFT( functor_samples.second );
-
-	fft_functor.LoadInputData(functor_samples.second,functor_samples.first);
-	fft_functor.Execute();
-
-	auto fft_functor_output =  fft_functor.GetOutputData();
-	auto fft_functor_range  = make_range( fft_functor_output.first,
-			fft_functor_output.first + fft_functor_output.second);
-
-	//element wise product
-	auto ffts = hydra::zip(fft_functor_range,  fft_kernel_range );
-
-
-	hydra::thrust::transform( policy, ffts.begin(),  ffts.end(),
-			complex_buffer.first, detail::convolution::MultiplyFFT<T>());
-
-	//transform product back to real
-
-
-	auto fft_product = _ComplexToRealFFT( 2*complex_buffer.second-2 );
-
-
-	fft_product.LoadInputData(complex_buffer.second, complex_buffer.first);
-	fft_product.Execute();
-
-	auto fft_product_output =  fft_product.GetOutputData();
-
+/**
+ * Samples the convolution of functor and kernel in [min, max), reusing the FFT plans, the buffers and the
+ * kernel spectrum kept by a hydra::ConvolutionEngine across calls.
+ */
+template<detail::Backend BACKEND, detail::FFTCalculator FFTBackend,  typename Functor, typename Kernel, typename Iterable,
+     typename T = typename detail::stripped_type<typename hydra::thrust::iterator_traits<decltype(std::declval<Iterable>().begin())>::value_type>::type>
+inline typename std::enable_if<std::is_floating_point<T>::value  && hydra::detail::is_iterable<Iterable>::value, void>::type
+convolute(detail::BackendPolicy<BACKEND> policy, ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>& engine,
+		  Functor const& functor, Kernel const& kernel,
+		  T min,  T max, Iterable&& output, bool power_up=true ){
 
-	T n = 2*complex_buffer.second-2;
+	engine.Convolute(policy, functor, kernel, min, max, std::forward<Iterable>(output), power_up);
+}
 
-	auto normalize_fft =  detail::convolution::NormalizeFFT<T>(n);
+/**
+ * Samples the convolution of two functors of N variables over the grid with nsamples[a] points along
+ * the axis a, spanning [min[a], max[a]). The output is filled with the axis 0 running fastest.
+ * See ConvolutionEngine::Convolute for the conventions.
+ */
+template<detail::Backend BACKEND, detail::FFTCalculator FFTBackend,  typename Functor, typename Kernel, typename T, size_t N, typename Iterable>
+inline typename std::enable_if<std::is_floating_point<T>::value  && hydra::detail::is_iterable<Iterable>::value, void>::type
+convolute(detail::BackendPolicy<BACKEND> policy, detail::FFTPolicy<T, FFTBackend> fft_policy,
+		  Functor const& functor, Kernel const& kernel,
+		  std::array<T,N> const& min, std::array<T,N> const& max, std::array<size_t,N> const& nsamples, Iterable&& output ){
 
-    	auto first = hydra::thrust::make_transform_iterator( fft_product_output.first,normalize_fft);
-    	auto last  = hydra::thrust::make_transform_iterator(fft_product_output.first + nsamples+1,normalize_fft);
+	ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>> engine;
 
-	auto fft_product_range = make_range(first, last);
+	engine.Convolute(policy, functor, kernel, min, max, nsamples, std::forward<Iterable>(output));
+}
 
-	hydra::copy(fft_product_range,  std::forward<Iterable>(output));
+/**
+ * Samples the convolution of two functors of N variables over a grid, reusing the plans, the buffers and
+ * the kernel spectrum kept by a hydra::ConvolutionEngine across calls.
+ */
+template<detail::Backend BACKEND, detail::FFTCalculator FFTBackend,  typename Functor, typename Kernel, typename T, size_t N, typename Iterable>
+inline typename std::enable_if<std::is_floating_point<T>::value  && hydra::detail::is_iterable<Iterable>::value, void>::type
+convolute(detail::BackendPolicy<BACKEND> policy, ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>& engine,
+		  Functor const& functor, Kernel const& kernel,
+		  std::array<T,N> const& min, std::array<T,N> const& max, std::array<size_t,N> const& nsamples, Iterable&& output ){
 
-	hydra::thrust::return_temporary_buffer( policy,  complex_buffer.first ,  complex_buffer.second );
-	hydra::thrust::return_temporary_buffer( policy,  kernel_samples.first  ,  kernel_samples.second );
-	hydra::thrust::return_temporary_buffer( policy, functor_samples.first  , functor_samples.second );
+	engine.Convolute(policy, functor, kernel, min, max, nsamples, std::forward<Iterable>(output));
 }
 
 
@@ -0,0 +1,494 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * ConvolutionEngine.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef CONVOLUTIONENGINE_H_
+#define CONVOLUTIONENGINE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Range.h>
+#include <hydra/Zip.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/FFTPolicy.h>
+#include <hydra/detail/BatchFFT.h>
+#include <hydra/detail/Convolution.inl>
+#include <hydra/detail/Iterable_traits.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/functional.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+
+#include <array>
+#include <map>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+
+namespace hydra {
+
+template<typename FFTPolicy>
+class ConvolutionEngine;
+
+/**
+ * \ingroup generic
+ * \brief Persistent workspace for the FFT convolution of functors.
+ *
+ * hydra::convolute builds the FFT plans and buffers on each call. ConvolutionEngine keeps, for each
+ * number of samples, the plans of the two forward transforms and of the backward transform, which
+ * also own the buffers used to sample the functor and the kernel and to multiply the spectra. The samples and
+ * the product are written directly in the input buffers of the plans, so no temporary storage is allocated after
+ * the first call with a given number of samples.
+ *
+ * The spectrum of the kernel is kept in the output buffer of its plan, together with the key of the parameters of the
+ * kernel (`Kernel::GetParametersKey()`) and the sampling step. When they do not change between calls, as in a fit that only
+ * moves the parameters of the signal, the sampling and the transform of the kernel are skipped.
+ * The key only depends on the values of the parameters, so kernels with other state must call
+ * ConvolutionEngine::ResetKernel() or disable the caching with ConvolutionEngine::SetKernelCaching(false).
+ *
+ * Functors of N = 2, 3... variables are convoluted over regular grids with ConvolutionEngine::Convolute(policy, functor, kernel,
+ * min, max, nsamples, output). The grid is zero-padded to 2*nsamples[a] points along each axis and transformed
+ * axis by axis with batches of one dimensional complex transforms, whose plans are cached by length and shared by all axes and grids.
+ * The lines of an axis are gathered in one pass, transformed as one batch and scattered back in one pass, and the
+ * lines entirely in the padding are left out. The spectrum of the kernel is cached per grid shape, as above.
+ *
+ * The engine owns FFT plans, which are not copyable, and is not thread-safe.
+ *
+ * \tparam FFTPolicy hydra::detail::FFTPolicy<T, FFTCalculator>, which sets the precision and the FFT library.
+ */
+template<typename T, detail::FFTCalculator FFTBackend>
+class ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>
+{
+	typedef hydra::complex<T> complex_type;
+	typedef typename detail::FFTPolicy<T, FFTBackend>::R2C _RealToComplexFFT;
+	typedef typename detail::FFTPolicy<T, FFTBackend>::C2R _ComplexToRealFFT;
+	typedef detail::convolution::BatchFFT<T, FFTBackend> batch_fft_type;
+	typedef typename detail::FFTPolicy<T, FFTBackend>::device_backend_type::template container<complex_type> complex_storage_type;
+
+	/*
+	 * plans for 2*nsamples points and the status of the kernel spectrum
+	 */
+	struct plans_t
+	{
+		plans_t(int size):
+			fKernel(size),
+			fFunctor(size),
+			fProduct(size),
+			fKernelKey(0),
+			fKernelDelta(0),
+			fKernelValid(false)
+		{}
+
+		_RealToComplexFFT fKernel;
+		_RealToComplexFFT fFunctor;
+		_ComplexToRealFFT fProduct;
+		size_t fKernelKey;
+		T      fKernelDelta;
+		bool   fKernelValid;
+	};
+
+	/*
+	 * forward and backward plans for lines of `size` points
+	 */
+	struct lines_t
+	{
+		lines_t(size_t size):
+			fForward(size, -1),
+			fBackward(size, +1)
+		{}
+
+		batch_fft_type fForward;
+		batch_fft_type fBackward;
+	};
+
+	/*
+	 * zero-padded grid, with the axis 0 running fastest, and the status of the kernel spectrum
+	 */
+	struct grid_t
+	{
+		grid_t(std::vector<size_t> const& nsamples):
+			fNSamples(nsamples),
+			fLengths(nsamples.size()),
+			fStrides(nsamples.size()),
+			fSize(1),
+			fKernelKey(0),
+			fKernelValid(false)
+		{
+			for(size_t a=0; a<nsamples.size(); a++){
+				fLengths[a] = 2*nsamples[a];
+				fStrides[a] = fSize;
+				fSize      *= fLengths[a];
+			}
+
+			fData.resize(fSize);
+			fKernel.resize(fSize);
+			fLines.resize(fSize);
+			fSpectra.resize(fSize);
+		}
+
+		std::vector<size_t> fNSamples;
+		std::vector<size_t> fLengths;
+		std::vector<size_t> fStrides;
+		size_t fSize;
+		complex_storage_type fData;
+		complex_storage_type fKernel;
+		complex_storage_type fLines;
+		complex_storage_type fSpectra;
+		size_t fKernelKey;
+		std::vector<T> fKernelDelta;
+		bool   fKernelValid;
+	};
+
+public:
+
+	ConvolutionEngine():
+		fKernelCaching(true),
+		fNKernelTransforms(0)
+	{}
+
+	ConvolutionEngine(ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>> const&)=delete;
+
+	ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>&
+	operator=(ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>> const&)=delete;
+
+	/**
+	 * @brief Samples the convolution of functor and kernel in [min, max), with the same conventions as hydra::convolute.
+	 * @param policy back end used to sample the functors and multiply the spectra.
+	 * @param functor signal.
+	 * @param kernel convolution kernel.
+	 * @param min lower limit of the sampling region.
+	 * @param max upper limit of the sampling region.
+	 * @param output container receiving the samples of the convolution.
+	 * @param power_up resize the output to the next power of two.
+	 */
+	template<detail::Backend BACKEND, typename Functor, typename Kernel, typename Iterable>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, void>::type
+	Convolute(detail::BackendPolicy<BACKEND> policy, Functor const& functor, Kernel const& kernel,
+			T min, T max, Iterable&& output, bool power_up=true);
+
+	/**
+	 * @brief Samples the convolution of two functors of N variables over a regular grid.
+	 *
+	 * The output receives, for the grid point m = (m_0, ..., m_{N-1}) with x_a = min[a] + m_a*(max[a]-min[a])/nsamples[a],
+	 * the Riemann sum approximating the integral of functor(y)*kernel(x - y) over the sampling region, at the position
+	 * m_0 + nsamples[0]*(m_1 + nsamples[1]*(m_2 + ...)). This is the layout expected by hydra::spline2D and hydra::spline3D.
+	 * Differently from the one dimensional method, the samples include the volume of the grid cell.
+	 *
+	 * @param policy back end used to sample the functors and multiply the spectra.
+	 * @param functor signal, function of N variables.
+	 * @param kernel convolution kernel, function of the N displacements.
+	 * @param min lower limits of the sampling region.
+	 * @param max upper limits of the sampling region.
+	 * @param nsamples number of samples along each axis.
+	 * @param output container with at least nsamples[0]*...*nsamples[N-1] elements.
+	 */
+	template<detail::Backend BACKEND, typename Functor, typename Kernel, size_t N, typename Iterable>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, void>::type
+	Convolute(detail::BackendPolicy<BACKEND> policy, Functor const& functor, Kernel const& kernel,
+			std::array<T,N> const& min, std::array<T,N> const& max, std::array<size_t,N> const& nsamples,
+			Iterable&& output);
+
+	/**
+	 * @brief Forgets the spectra of the kernels, which are recomputed in the next call.
+	 */
+	inline void ResetKernel()
+	{
+		for(auto& plans: fPlans)
+			plans.second->fKernelValid = false;
+
+		for(auto& grid: fGrids)
+			grid.second->fKernelValid = false;
+	}
+
+	/**
+	 * @brief Releases all plans and buffers.
+	 */
+	inline void Reset()
+	{
+		fPlans.clear();
+		fLines.clear();
+		fGrids.clear();
+	}
+
+	inline bool IsKernelCaching() const {
+		return fKernelCaching;
+	}
+
+	inline void SetKernelCaching(bool kernelCaching) {
+		fKernelCaching = kernelCaching;
+	}
+
+	/**
+	 * @brief Number of sizes with allocated plans.
+	 */
+	inline size_t GetNPlans() const {
+		return fPlans.size();
+	}
+
+	/**
+	 * @brief Number of multidimensional grids with allocated buffers.
+	 */
+	inline size_t GetNGrids() const {
+		return fGrids.size();
+	}
+
+	/**
+	 * @brief Number of times the kernel was sampled and transformed.
+	 */
+	inline size_t GetNKernelTransforms() const {
+		return fNKernelTransforms;
+	}
+
+private:
+
+	inline plans_t& GetPlans(int size)
+	{
+		auto& plans = fPlans[size];
+
+		if( !plans ) plans.reset(new plans_t(size));
+
+		return *plans;
+	}
+
+	inline lines_t& GetLines(size_t size)
+	{
+		auto& lines = fLines[size];
+
+		if( !lines ) lines.reset(new lines_t(size));
+
+		return *lines;
+	}
+
+	inline grid_t& GetGrid(std::vector<size_t> const& nsamples)
+	{
+		auto& grid = fGrids[nsamples];
+
+		if( !grid ) grid.reset(new grid_t(nsamples));
+
+		return *grid;
+	}
+
+	/*
+	 * Transforms the grid `data` along all axes, in ascending order for the forward transform
+	 * and in descending order for the backward one. For each axis, the lines are gathered
+	 * contiguously in one parallel pass, transformed as one batch and scattered back in one pass.
+	 * With skip_padding, the lines lying in the padding of the axes not yet transformed (forward),
+	 * or not needed in the result (backward), are left out of the batch.
+	 */
+	template<size_t N, detail::Backend BACKEND>
+	void TransformGrid(detail::BackendPolicy<BACKEND> policy, grid_t& grid,
+			complex_type* data, bool forward, bool skip_padding);
+
+	bool   fKernelCaching;
+	size_t fNKernelTransforms;
+	std::map<int, std::unique_ptr<plans_t>> fPlans;
+	std::map<size_t, std::unique_ptr<lines_t>> fLines;
+	std::map<std::vector<size_t>, std::unique_ptr<grid_t>> fGrids;
+};
+
+template<typename T, detail::FFTCalculator FFTBackend>
+template<detail::Backend BACKEND, typename Functor, typename Kernel, typename Iterable>
+inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, void>::type
+ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>::Convolute(detail::BackendPolicy<BACKEND> policy,
+		Functor const& functor, Kernel const& kernel, T min, T max, Iterable&& output, bool power_up)
+{
+	if(power_up) {
+		std::forward<Iterable>(output).resize(
+				hydra::detail::convolution::upper_power_of_two(std::forward<Iterable>(output).size()));
+	}
+
+	int nsamples = std::forward<Iterable>(output).size();
+
+	T delta = (max - min)/(nsamples);
+
+	plans_t& plans = GetPlans(2*nsamples);
+
+	hydra::thrust::counting_iterator<int> first(0);
+	hydra::thrust::counting_iterator<int> last = first + 2*nsamples;
+
+	// sample and transform the kernel, if its spectrum is not available
+	size_t kernel_key = Kernel(kernel).GetParametersKey();
+
+	if( !( fKernelCaching && plans.fKernelValid && plans.fKernelKey == kernel_key && plans.fKernelDelta == delta) )
+	{
+		auto kernel_sampler = hydra::detail::convolution::KernelSampler<Kernel>(kernel, nsamples, delta);
+
+		hydra::thrust::transform(policy, first, last,
+				plans.fKernel.GetInputData().first.get(), kernel_sampler);
+
+		plans.fKernel.Execute();
+
+		plans.fKernelKey   = kernel_key;
+		plans.fKernelDelta = delta;
+		plans.fKernelValid = true;
+
+		++fNKernelTransforms;
+	}
+
+	// sample and transform the functor
+	auto functor_sampler = hydra::detail::convolution::FunctorSampler<Functor>(functor, nsamples,  min, delta);
+
+	hydra::thrust::transform(policy, first, last,
+			plans.fFunctor.GetInputData().first.get(), functor_sampler);
+
+	plans.fFunctor.Execute();
+
+	// element wise product, written in the input of the backward transform
+	auto fft_kernel  = plans.fKernel.GetOutputData();
+	auto fft_functor = plans.fFunctor.GetOutputData();
+
+	auto ffts = hydra::zip(make_range(fft_functor.first.get(), fft_functor.first.get() + fft_functor.second),
+			make_range(fft_kernel.first.get(), fft_kernel.first.get() + fft_kernel.second));
+
+	hydra::thrust::transform(policy, ffts.begin(), ffts.end(),
+			plans.fProduct.GetInputData().first.get(), detail::convolution::MultiplyFFT<T>());
+
+	// transform the product back and normalize
+	plans.fProduct.Execute();
+
+	auto fft_product = plans.fProduct.GetOutputData();
+
+	hydra::thrust::transform(policy, fft_product.first.get(), fft_product.first.get() + nsamples,
+			std::forward<Iterable>(output).begin(), detail::convolution::NormalizeFFT<T>(2*nsamples));
+}
+
+template<typename T, detail::FFTCalculator FFTBackend>
+template<size_t N, detail::Backend BACKEND>
+void ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>::TransformGrid(detail::BackendPolicy<BACKEND> policy,
+		grid_t& grid, complex_type* data, bool forward, bool skip_padding)
+{
+	complex_type* lines_data   = hydra::thrust::raw_pointer_cast(grid.fLines.data());
+	complex_type* spectra_data = hydra::thrust::raw_pointer_cast(grid.fSpectra.data());
+
+	for(size_t step=0; step<N; step++)
+	{
+		size_t axis   = forward ? step : N - 1 - step;
+		size_t length = grid.fLengths[axis];
+
+		lines_t& lines = GetLines(length);
+		batch_fft_type& fft = forward ? lines.fForward : lines.fBackward;
+
+		// extents of the lines on the other axes, leaving out the padding if possible
+		std::vector<size_t> extents(grid.fLengths);
+
+		if(skip_padding)
+			for(size_t a=axis+1; a<N; a++) extents[a] = grid.fNSamples[a];
+
+		size_t nlines = 1;
+		for(size_t a=0; a<N; a++) if(a != axis) nlines *= extents[a];
+
+		hydra::thrust::counting_iterator<size_t> first(0);
+
+		hydra::thrust::for_each(policy, first, first + nlines,
+				detail::convolution::GridLineCopy<T, N>(data, lines_data, axis, extents, grid.fStrides, true));
+
+		fft.Execute(policy, lines_data, spectra_data, nlines);
+
+		hydra::thrust::for_each(policy, first, first + nlines,
+				detail::convolution::GridLineCopy<T, N>(data, spectra_data, axis, extents, grid.fStrides, false));
+	}
+}
+
+template<typename T, detail::FFTCalculator FFTBackend>
+template<detail::Backend BACKEND, typename Functor, typename Kernel, size_t N, typename Iterable>
+inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, void>::type
+ConvolutionEngine<detail::FFTPolicy<T, FFTBackend>>::Convolute(detail::BackendPolicy<BACKEND> policy,
+		Functor const& functor, Kernel const& kernel,
+		std::array<T,N> const& min, std::array<T,N> const& max, std::array<size_t,N> const& nsamples,
+		Iterable&& output)
+{
+	size_t nvalues = 1;
+
+	std::array<T,N> delta;
+	std::vector<T>  deltas(N);
+	T volume = 1.0;
+
+	for(size_t a=0; a<N; a++)
+	{
+		if( nsamples[a] == 0 )
+			throw std::invalid_argument("[hydra::ConvolutionEngine]: Number of samples is zero. (nsamples[a]==0)");
+
+		if( !(max[a] > min[a]) )
+			throw std::invalid_argument("[hydra::ConvolutionEngine]: Empty sampling region. (max[a] <= min[a])");
+
+		nvalues  *= nsamples[a];
+		delta[a]  = (max[a] - min[a])/nsamples[a];
+		deltas[a] = delta[a];
+		volume   *= delta[a];
+	}
+
+	if( std::forward<Iterable>(output).size() < nvalues )
+		throw std::invalid_argument("[hydra::ConvolutionEngine]: Output smaller than the grid. (output.size() < nsamples[0]*...*nsamples[N-1])");
+
+	grid_t& grid = GetGrid(std::vector<size_t>(nsamples.begin(), nsamples.end()));
+
+	complex_type* data        = hydra::thrust::raw_pointer_cast(grid.fData.data());
+	complex_type* kernel_data = hydra::thrust::raw_pointer_cast(grid.fKernel.data());
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + grid.fSize;
+
+	// sample and transform the kernel, if its spectrum is not available
+	size_t kernel_key = Kernel(kernel).GetParametersKey();
+
+	if( !( fKernelCaching && grid.fKernelValid && grid.fKernelKey == kernel_key && grid.fKernelDelta == deltas) )
+	{
+		hydra::thrust::transform(policy, first, last, kernel_data,
+				detail::convolution::GridKernelSampler<Kernel, T, N>(kernel, nsamples, delta));
+
+		TransformGrid<N>(policy, grid, kernel_data, true, false);
+
+		grid.fKernelKey   = kernel_key;
+		grid.fKernelDelta = deltas;
+		grid.fKernelValid = true;
+
+		++fNKernelTransforms;
+	}
+
+	// sample and transform the functor
+	hydra::thrust::transform(policy, first, last, data,
+			detail::convolution::GridFunctorSampler<Functor, T, N>(functor, nsamples, min, delta));
+
+	TransformGrid<N>(policy, grid, data, true, true);
+
+	// element wise product and backward transform
+	hydra::thrust::transform(policy, data, data + grid.fSize, kernel_data, data,
+			hydra::thrust::multiplies<complex_type>());
+
+	TransformGrid<N>(policy, grid, data, false, true);
+
+	hydra::thrust::transform(policy, first, first + nvalues, std::forward<Iterable>(output).begin(),
+			detail::convolution::GridExtract<T, N>(data, nsamples, volume/grid.fSize));
+}
+
+}  // namespace hydra
+
+#endif /* CONVOLUTIONENGINE_H_ */
@@ -37,6 +37,7 @@
 #include<hydra/detail/cufft/ComplexToRealCuFFT.h>
 #include<hydra/detail/cufft/RealToComplexCuFFT.h>
 #include<hydra/detail/cufft/ComplexToComplexCuFFT.h>
+#include<hydra/detail/cufft/BatchCuFFT.h>
 #include<hydra/device/System.h>
 #include<hydra/host/System.h>
 #include<hydra/cuda/System.h>
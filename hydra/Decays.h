@@ -37,6 +37,7 @@
 #include <hydra/Tuple.h>
 #include <hydra/Function.h>
 #include <hydra/PhaseSpace.h>
+#include <hydra/OnlineUnweighting.h>
 #include <hydra/detail/FunctorTraits.h>
 #include <hydra/detail/CompositeTraits.h>
 
@@ -260,6 +261,59 @@ public :
 	 hydra::Range<iterator>>::type
 	 Unweight( Functor  const& functor, double weight=-1.0, size_t seed=0x39abdc4529b1661c);
 
+	 /**
+	  * Unweight the decays in place, in a single pass, using the phase-space weights
+	  * and the running maximum weight of @param unweighter .
+	  * The accepted events are meant to have unit weight. Events with weight above the running maximum
+	  * are accepted with residual weight weight/max > 1, which is not kept by this overload: only their number
+	  * and sum are available from the statistics of @param unweighter (e.g. GetOvershootFraction()).
+	  * Use the overload taking the residual weights to keep them.
+	  */
+	 template<typename GRND>
+	 hydra::Range<iterator>
+	 Unweight( OnlineUnweighting<system_type, GRND>& unweighter);
+
+	 /**
+	  * Unweight the decays in place, in a single pass, using the phase-space weights times @param functor
+	  * and the running maximum weight of @param unweighter .
+	  * As above, the residual weights of the overshooting events are only reported in the statistics
+	  * of @param unweighter .
+	  */
+	 template<typename Functor, typename GRND>
+	 typename std::enable_if<
+	 detail::is_hydra_functor<Functor>::value ||
+	 detail::is_hydra_lambda<Functor>::value  ||
+	 detail::is_hydra_composite_functor<Functor>::value ,
+	 hydra::Range<iterator>>::type
+	 Unweight( Functor  const& functor, OnlineUnweighting<system_type, GRND>& unweighter);
+
+	 /**
+	  * Unweight the decays in place, in a single pass, using the phase-space weights
+	  * and the running maximum weight of @param unweighter , storing the residual weights in @param residuals .
+	  * The residual weights are aligned with the reordered decays: one for regular accepted events,
+	  * weight/max for events above the running maximum and zero for rejected events. They are relative
+	  * to the maximum used for this batch: scale them with unweighter.GetWeightScale(k) before merging
+	  * batches processed with different maxima.
+	  * @param residuals must hold at least size() elements.
+	  */
+	 template<typename GRND, typename Iterable>
+	 typename std::enable_if<detail::is_iterable<Iterable>::value, hydra::Range<iterator>>::type
+	 Unweight( OnlineUnweighting<system_type, GRND>& unweighter, Iterable&& residuals);
+
+	 /**
+	  * Unweight the decays in place, in a single pass, using the phase-space weights times @param functor
+	  * and the running maximum weight of @param unweighter , storing the residual weights in @param residuals .
+	  * @param residuals must hold at least size() elements.
+	  */
+	 template<typename Functor, typename GRND, typename Iterable>
+	 typename std::enable_if<
+	 (detail::is_hydra_functor<Functor>::value ||
+	 detail::is_hydra_lambda<Functor>::value  ||
+	 detail::is_hydra_composite_functor<Functor>::value) &&
+	 detail::is_iterable<Iterable>::value,
+	 hydra::Range<iterator>>::type
+	 Unweight( Functor  const& functor, OnlineUnweighting<system_type, GRND>& unweighter, Iterable&& residuals);
+
 	/**
 	 * Add a decay to the container, increasing
 	 * its size by one element.
@@ -38,6 +38,7 @@
 #include<hydra/detail/fftw/ComplexToRealFFTW.h>
 #include<hydra/detail/fftw/RealToComplexFFTW.h>
 #include<hydra/detail/fftw/ComplexToComplexFFTW.h>
+#include<hydra/detail/fftw/BatchFFTW.h>
 #include<hydra/host/System.h>
 #include<hydra/device/System.h>
 
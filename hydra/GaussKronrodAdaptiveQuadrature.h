@@ -98,6 +98,15 @@ the corresponding Gauss rule is of order \f$2n-1\f$. These extra points are the
 This allows for computing higher-order estimates while reusing the function values of a lower-order estimate.
 The difference between a Gauss quadrature rule and its Kronrod extension are often used as an estimate of the approximation error.
 
+###Subdivision strategy###
+
+The integration region is initially divided in NBIN intervals. The evaluated intervals are kept in a host-side heap, ordered by error.
+In each iteration, the intervals with the largest errors are removed from the heap and bisected, while the error of the
+remaining ones is still above the tolerance, up to GaussKronrodAdaptiveQuadrature::GetBatchSize() intervals.
+Only the newly created intervals are evaluated on the back end, in a single parallel call, and are then pushed into the heap.
+The iterations stop when the error is below the required relative error or when the number of intervals reaches
+GaussKronrodAdaptiveQuadrature::GetMaxNodes().
+
  */
 template<size_t NRULE, size_t NBIN, hydra::detail::Backend BACKEND>
 class GaussKronrodAdaptiveQuadrature<NRULE,NBIN, hydra::detail::BackendPolicy<BACKEND>>:
@@ -118,7 +127,7 @@ public Integral< GaussKronrodAdaptiveQuadrature<NRULE, NBIN, hydra::detail::Back
 			double   // error
 			> node_t;
 
-	typedef hydra::thrust::host_vector<node_t>   node_list_h;
+	typedef std::vector<node_t>   node_list_h;
 	//typedef multivector<node_list_h> node_table_h;
 	typedef multivector<node_t, hydra::host::sys_t> node_table_h;
 	/*
@@ -170,13 +179,19 @@ public:
 	 * Self-adaptive Gauss-Kronrod quadrature constructor taking the integration region and the tolerance as parameters.
 	 * @param xlower - lower range limit
 	 * @param xupper - upper range limit
-	 * @param tolerance - maximum absolute error
+	 * @param tolerance - maximum relative error
+	 * @param batch_size - maximum number of intervals split per iteration
+	 * @param max_nodes - maximum number of intervals
 	 */
-	GaussKronrodAdaptiveQuadrature(GReal_t xlower, GReal_t xupper, GReal_t tolerance=1e-15):
+	GaussKronrodAdaptiveQuadrature(GReal_t xlower, GReal_t xupper, GReal_t tolerance=1e-15,
+			size_t batch_size=32, size_t max_nodes=(1<<16)):
 		fIterationNumber(0),
 		fXLower(xlower),
 		fXUpper(xupper),
 		fMaxRelativeError( tolerance ),
+		fBatchSize( batch_size ),
+		fMaxNodes( max_nodes ),
+		fHeapSize(0),
 		fRule(GaussKronrodRuleSelector<NRULE>().fRule)
 	{ InitNodes(); }
 
@@ -191,6 +206,9 @@ public:
 			fXLower(other.GetXLower() ),
 			fXUpper(other.GetXUpper()),
 			fMaxRelativeError(other.GetMaxRelativeError() ),
+			fBatchSize(other.GetBatchSize() ),
+			fMaxNodes(other.GetMaxNodes() ),
+			fHeapSize(0),
 			fRule(other.GetRule())
 		{
 			InitNodes();
@@ -207,6 +225,9 @@ public:
 				fXLower(other.GetXLower() ),
 				fXUpper(other.GetXUpper()),
 				fMaxRelativeError(other.GetMaxRelativeError() ),
+				fBatchSize(other.GetBatchSize() ),
+				fMaxNodes(other.GetMaxNodes() ),
+				fHeapSize(0),
 				fRule(other.GetRule())
 			{
 				InitNodes();
@@ -227,6 +248,8 @@ public:
 		this->fXLower = other.GetXLower() ;
 		this->fXUpper = other.GetXUpper();
 		this->fMaxRelativeError = other.GetMaxRelativeError() ;
+		this->fBatchSize = other.GetBatchSize() ;
+		this->fMaxNodes = other.GetMaxNodes() ;
 		this->fRule=other.GetRule();
 		this->InitNodes();
 
@@ -249,6 +272,8 @@ public:
 			this->fXLower = other.GetXLower() ;
 			this->fXUpper = other.GetXUpper();
 			this->fMaxRelativeError = other.GetMaxRelativeError() ;
+			this->fBatchSize = other.GetBatchSize() ;
+			this->fMaxNodes = other.GetMaxNodes() ;
 			this->fRule=other.GetRule();
 			this->InitNodes();
 
@@ -328,18 +353,47 @@ public:
 		InitNodes();
 	}
 
+	/**
+	 * @brief Maximum number of intervals split per iteration.
+	 */
+	size_t GetBatchSize() const
+	{
+		return fBatchSize;
+	}
+
+	void SetBatchSize(size_t batchSize)
+	{
+		fBatchSize = batchSize;
+	}
+
+	/**
+	 * @brief Maximum number of intervals.
+	 */
+	size_t GetMaxNodes() const
+	{
+		return fMaxNodes;
+	}
+
+	void SetMaxNodes(size_t maxNodes)
+	{
+		fMaxNodes = maxNodes;
+	}
+
 	const GaussKronrodRule<NRULE>& GetRule() const
 	{
 		return fRule;
 	}
 
-private:
-
+	/**
+	 * @brief Number of iterations, i.e. of parallel evaluations, in the last call to Integrate.
+	 */
 	GUInt_t GetIterationNumber() const
 	{
 		return fIterationNumber;
 	}
 
+private:
+
 	std::pair<GReal_t, GReal_t> Accumulate();
 
 	GReal_t GetError( GReal_t delta)
@@ -353,10 +407,11 @@ private:
 	{
 		GReal_t delta = (fXUpper - fXLower)/NBIN;
 		fNodesTable.resize(NBIN);
+		fHeapSize = 0;
 
 		for(size_t i=0; i<NBIN; i++ )
 		{
-			auto node = this->fNodesTable[i];
+			auto& node = this->fNodesTable[i];
 			hydra::thrust::get<0>(node) = 	1;
 			hydra::thrust::get<1>(node) = 	i;
 			hydra::thrust::get<2>(node) = 	this->fXLower + i*delta;
@@ -367,21 +422,14 @@ private:
 
 	}
 
-	size_t CountNodesToProcess()
-	{
-		auto begin = fNodesTable.begin( placeholders::_0);
-		auto end   = fNodesTable.end( placeholders::_0);
-
-	    size_t n=0;
-		for(auto i = begin; i!=end; i++)
-		if(*i)n++;
-		return n;
-	}
-
+	/*
+	 * the parameters are set only for the nodes waiting for evaluation,
+	 * stored after the heap, in [fHeapSize, fNodesTable.size())
+	 */
 	void SetParametersTable( )
 	{
 
-		size_t nNodes =  CountNodesToProcess();
+		size_t nNodes =  fNodesTable.size() - fHeapSize;
 
 		fParametersTable.clear();
 		fParametersTable.resize(nNodes*(NRULE+1)/2);
@@ -389,10 +437,9 @@ private:
 
 		//for(size_t i=0; i<nNodes; i++)
 		size_t i=0;
-		for(auto node : fNodesTable)
+		for(size_t n=fHeapSize; n<fNodesTable.size(); n++)
 		{
-
-			if(!hydra::thrust::get<0>(node)) 	continue;
+			auto const& node = fNodesTable[n];
 
 			for(size_t call=0; call<(NRULE+1)/2; call++)
 			{
@@ -410,7 +457,7 @@ private:
 
 				size_t index = call*nNodes + i;
 
-				temp_table[index]= parameters_t(hydra::thrust::get<1>(node), abscissa_X_P, abscissa_X_M,
+				temp_table[index]= parameters_t(i, abscissa_X_P, abscissa_X_M,
 						jacobian, rule_GaussKronrod_Weight, rule_Gauss_Weight);
 			}
 
@@ -423,13 +470,16 @@ private:
 
 	}
 
-	void UpdateNodes();
+	void UpdateNodes(std::pair<GReal_t, GReal_t> const& result);
 
 	GUInt_t fIterationNumber;
 	GReal_t fXLower;
 	GReal_t fXUpper;
 	GReal_t fMaxRelativeError;
-	node_table_h  fNodesTable;
+	size_t  fBatchSize;
+	size_t  fMaxNodes;
+	size_t  fHeapSize;
+	node_list_h  fNodesTable;
 	parameters_table_d fParametersTable;
 	call_table_h fCallTableHost;
 	call_table_d fCallTableDevice;
@@ -0,0 +1,309 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * GaussKronrodCubature.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+#ifndef GAUSSKRONRODCUBATURE_H_
+#define GAUSSKRONRODCUBATURE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/GaussKronrodRules.h>
+#include <hydra/Integrator.h>
+#include <hydra/detail/functors/ProcessGaussKronrodQuadrature.h>
+#include <hydra/detail/functors/ProcessGaussKronrodCubature.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+#include <stdexcept>
+
+namespace hydra {
+
+template<size_t NRULE, size_t N, typename BACKEND>
+class GaussKronrodCubature;
+
+/**
+ * \ingroup numerical_integration
+ *
+ * \brief Multidimensional Gauss-Kronrod quadrature, on tensor-product or sparse grids.
+ *
+ * In the default tensor-product mode, the dimension j of the integration region is split in grid[j] intervals,
+ * each one integrated with the Gauss-Kronrod rule with NRULE nodes, and the integral is computed
+ * with the tensor product of the N one-dimensional composite rules, which takes \f$\prod_j grid_j NRULE \f$ calls.
+ * This is the method of choice for smooth integrands in two to four dimensions.
+ *
+ * For more dimensions, GaussKronrodCubature::SetSparseGrid(level) switches to the Smolyak sparse-grid construction,
+ * \f[ A(L, N) = \sum_{max(0,L-N+1) \le |l| \le L} (-1)^{L-|l|} \binom{N-1}{L-|l|} Q_{l_1}\otimes \dots \otimes Q_{l_N}, \f]
+ * where \f$Q_0, \dots, Q_4\f$ are the midpoint rule, the 7 points Gauss rule and the Gauss-Kronrod rules with 15, 31 and 61 nodes.
+ * The nodes shared by several terms, as the center of the region, are merged. Sparse grids converge quickly
+ * for integrands that vary slowly compared to the size of the region, otherwise the tensor-product mode
+ * with a finer grid is more reliable.
+ *
+ * In tensor-product mode, the error is estimated from the difference to the tensor product
+ * of the embedded Gauss rules, whose nodes are a subset of the Gauss-Kronrod ones.
+ * In sparse-grid mode, the embedded rule is the sparse grid of level \f$L-1\f$ and the error is the difference
+ * between both. The integrand is evaluated once on the union of the nodes of the two grids. Only the first three
+ * one-dimensional rules are nested (the Gauss-Kronrod rules with 15, 31 and 61 nodes share only the center),
+ * so the grid of level \f$L-1\f$ is a subset of the one of level \f$L\f$ for \f$N \ge 2\f$, where the
+ * error estimate costs no extra calls, but not for \f$N = 1\f$ at levels 3 and 4, where the union takes
+ * 45 and 91 calls instead of 31 and 61. GetNPoints() returns the actual number of calls.
+ * In both modes, the nodes and weights are computed once, when the geometry is set,
+ * and stored in the memory of the back end.
+ *
+ * \tparam NRULE number of nodes of the Gauss-Kronrod rule used in tensor-product mode (15, 21, 31, 41, 51 or 61).
+ * \tparam N number of dimensions.
+ * \tparam BACKEND parallel back end.
+ */
+template<size_t NRULE, size_t N, hydra::detail::Backend BACKEND>
+class GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>:
+public Integral<GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND> system_t;
+	typedef typename system_t::template container<GReal_t> vector_t;
+
+public:
+
+	GaussKronrodCubature()=delete;
+
+	/**
+	 * @brief Tensor-product Gauss-Kronrod quadrature constructor.
+	 * @param LowerLimit std::array with the lower limits of integration.
+	 * @param UpperLimit std::array with the upper limits of integration.
+	 * @param grid std::array with the number of intervals per dimension.
+	 */
+	GaussKronrodCubature(std::array<GReal_t,N> const& LowerLimit,
+			std::array<GReal_t,N> const& UpperLimit,
+			std::array<size_t,N> const& grid):
+		fLowerLimits(LowerLimit),
+		fUpperLimits(UpperLimit),
+		fGrid(grid),
+		fLevel(0),
+		fSparseGrid(false),
+		fNPoints(0)
+	{
+		SetCallTable();
+	}
+
+	/**
+	 * @brief Tensor-product Gauss-Kronrod quadrature constructor, with one interval per dimension.
+	 * @param LowerLimit std::array with the lower limits of integration.
+	 * @param UpperLimit std::array with the upper limits of integration.
+	 */
+	GaussKronrodCubature(std::array<GReal_t,N> const& LowerLimit,
+			std::array<GReal_t,N> const& UpperLimit):
+		fLowerLimits(LowerLimit),
+		fUpperLimits(UpperLimit),
+		fLevel(0),
+		fSparseGrid(false),
+		fNPoints(0)
+	{
+		fGrid.fill(1);
+		SetCallTable();
+	}
+
+	GaussKronrodCubature(GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>> const& other):
+		fLowerLimits(other.GetLowerLimits()),
+		fUpperLimits(other.GetUpperLimits()),
+		fGrid(other.GetGrid()),
+		fLevel(other.GetSparseGridLevel()),
+		fSparseGrid(other.IsSparseGrid()),
+		fNPoints(other.GetNPoints()),
+		fNodes(other.GetNodes()),
+		fKronrodWeights(other.GetKronrodWeights()),
+		fGaussWeights(other.GetGaussWeights())
+	{}
+
+	template<hydra::detail::Backend BACKEND2>
+	GaussKronrodCubature(GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND2>> const& other):
+		fLowerLimits(other.GetLowerLimits()),
+		fUpperLimits(other.GetUpperLimits()),
+		fGrid(other.GetGrid()),
+		fLevel(other.GetSparseGridLevel()),
+		fSparseGrid(other.IsSparseGrid()),
+		fNPoints(other.GetNPoints()),
+		fNodes(other.GetNodes()),
+		fKronrodWeights(other.GetKronrodWeights()),
+		fGaussWeights(other.GetGaussWeights())
+	{}
+
+	GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>&
+	operator=(GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>> const& other)
+	{
+		if(this==&other) return *this;
+
+		fLowerLimits    = other.GetLowerLimits();
+		fUpperLimits    = other.GetUpperLimits();
+		fGrid           = other.GetGrid();
+		fLevel          = other.GetSparseGridLevel();
+		fSparseGrid     = other.IsSparseGrid();
+		fNPoints        = other.GetNPoints();
+		fNodes          = other.GetNodes();
+		fKronrodWeights = other.GetKronrodWeights();
+		fGaussWeights   = other.GetGaussWeights();
+
+		return *this;
+	}
+
+	template<hydra::detail::Backend BACKEND2>
+	GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>&
+	operator=(GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND2>> const& other)
+	{
+		fLowerLimits    = other.GetLowerLimits();
+		fUpperLimits    = other.GetUpperLimits();
+		fGrid           = other.GetGrid();
+		fLevel          = other.GetSparseGridLevel();
+		fSparseGrid     = other.IsSparseGrid();
+		fNPoints        = other.GetNPoints();
+		fNodes          = other.GetNodes();
+		fKronrodWeights = other.GetKronrodWeights();
+		fGaussWeights   = other.GetGaussWeights();
+
+		return *this;
+	}
+
+	/**
+	 * @brief This method performs the actual integration.
+	 * @param functor functor (integrand).
+	 * @return std::pair<GReal_t, GReal_t> with the integration result and error.
+	 */
+	template<typename FUNCTOR>
+	std::pair<GReal_t, GReal_t> Integrate(FUNCTOR const& functor);
+
+	/**
+	 * @brief Switches to the tensor-product mode.
+	 * @param grid std::array with the number of intervals per dimension.
+	 */
+	inline void SetTensorProduct(std::array<size_t,N> const& grid)
+	{
+		fGrid       = grid;
+		fSparseGrid = false;
+		SetCallTable();
+	}
+
+	/**
+	 * @brief Switches to the sparse-grid mode.
+	 * @param level level of the Smolyak construction, from 0 (single node at the center) to 4.
+	 */
+	inline void SetSparseGrid(size_t level)
+	{
+		fLevel      = level;
+		fSparseGrid = true;
+		SetCallTable();
+	}
+
+	inline bool IsSparseGrid() const {
+		return fSparseGrid;
+	}
+
+	inline size_t GetSparseGridLevel() const {
+		return fLevel;
+	}
+
+	inline std::array<size_t,N> const& GetGrid() const {
+		return fGrid;
+	}
+
+	inline std::array<GReal_t,N> const& GetLowerLimits() const {
+		return fLowerLimits;
+	}
+
+	inline void SetLowerLimits(std::array<GReal_t,N> const& lowerLimits)
+	{
+		fLowerLimits = lowerLimits;
+		SetCallTable();
+	}
+
+	inline std::array<GReal_t,N> const& GetUpperLimits() const {
+		return fUpperLimits;
+	}
+
+	inline void SetUpperLimits(std::array<GReal_t,N> const& upperLimits)
+	{
+		fUpperLimits = upperLimits;
+		SetCallTable();
+	}
+
+	/**
+	 * @brief Number of calls of the integrand per integration, including
+	 * the nodes used only by the embedded rule.
+	 */
+	inline size_t GetNPoints() const {
+		return fNPoints;
+	}
+
+	/**
+	 * @brief Abscissas. In tensor-product mode, the abscissas of the one-dimensional rules,
+	 * concatenated. In sparse-grid mode, the coordinates of the nodes, stored as [dimension*GetNPoints() + node].
+	 */
+	inline vector_t const& GetNodes() const {
+		return fNodes;
+	}
+
+	inline vector_t const& GetKronrodWeights() const {
+		return fKronrodWeights;
+	}
+
+	/**
+	 * @brief Weights of the embedded rule: the Gauss rule in tensor-product mode
+	 * and the sparse grid of the previous level in sparse-grid mode.
+	 */
+	inline vector_t const& GetGaussWeights() const {
+		return fGaussWeights;
+	}
+
+private:
+
+	void SetCallTable();
+
+	void SetTensorProductTable();
+
+	void SetSparseGridTable();
+
+	std::array<GReal_t,N> fLowerLimits;
+	std::array<GReal_t,N> fUpperLimits;
+	std::array<size_t,N>  fGrid;
+	size_t   fLevel;
+	bool     fSparseGrid;
+	size_t   fNPoints;
+	vector_t fNodes;
+	vector_t fKronrodWeights;
+	vector_t fGaussWeights;
+
+};
+
+}  // namespace hydra
+
+#include <hydra/detail/GaussKronrodCubature.inl>
+
+#endif /* GAUSSKRONRODCUBATURE_H_ */
@@ -36,6 +36,7 @@
 #include <hydra/Types.h>
 #include <hydra/GaussKronrodRules.h>
 #include <hydra/detail/functors/ProcessGaussKronrodQuadrature.h>
+#include <hydra/detail/functors/MultiIntegrand.h>
 #include <hydra/multivector.h>
 #include <hydra/Integrator.h>
 
@@ -165,6 +166,25 @@ public:
 	template<typename FUNCTOR>
 	std::pair<GReal_t, GReal_t> Integrate(FUNCTOR const& functor);
 
+	/**
+	 * @brief Integrates several functors in one pass, evaluating all of them at the same abscissas.
+	 * @param functors hydra::tuple with the integrands.
+	 * @return std::array with one std::pair<GReal_t, GReal_t> (result, error) per integrand.
+	 */
+	template<typename ...FUNCTORS>
+	inline std::array<std::pair<GReal_t, GReal_t>, sizeof...(FUNCTORS)>
+	MultiIntegrate(hydra::thrust::tuple<FUNCTORS...> const& functors){
+		return MultiIntegrate(detail::MultiIntegrand<FUNCTORS...>(functors));
+	}
+
+	/**
+	 * @brief Integrates each component of a functor returning std::array<GReal_t,K>, in one pass.
+	 * @param functor functor returning the K integrands at a point.
+	 * @return std::array with one std::pair<GReal_t, GReal_t> (result, error) per integrand.
+	 */
+	template<typename FUNCTOR>
+	detail::multi_integral_t<FUNCTOR> MultiIntegrate(FUNCTOR const& functor);
+
 	void Print()
 	{
 		HYDRA_CALLER ;
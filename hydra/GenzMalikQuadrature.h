@@ -55,10 +55,18 @@ class  GenzMalikQuadrature;
 
 /**
  * \ingroup numerical_integration
- * \brief Non-adaptive Genz-Malik multidimensional quadrature
+ * \brief Genz-Malik multidimensional quadrature
+ *
+ * Genz-Malik multidimensional quadrature. By default, the integration region is divided in a grid of boxes,
+ * and a fraction of the boxes with the largest errors is bisected in each iteration, until the required relative error is reached.
+ *
+ * In adaptive mode (GenzMalikQuadrature::SetAdaptive(true)), the subdivision strategy follows the original paper
+ * and the hcubature algorithm: the boxes are kept in a heap ordered by error and, in each iteration, the boxes with the largest
+ * errors are removed from the heap and bisected along the axis with the largest fourth difference. Only the newly created boxes
+ * are evaluated, in parallel batches of up to GenzMalikQuadrature::GetBatchSize() boxes. The iterations stop
+ * when the total error is below max(absolute_error, relative_error*|integral|) or the number of boxes reaches
+ * GenzMalikQuadrature::GetMaxBoxes().
  *
- * Non-adaptive Genz-Malik multidimensional quadrature. This algorithm follows the original paper prescription
- * but does not implement the subdivision strategy yet.
  * A. C. Genz and A. A. Malik, "An adaptive algorithm for numeric integration over an N-dimensional rectangular region," J. Comput. Appl. Math. 6 (4), 295–302 (1980).
  * J. Berntsen, T. O. Espelid, and A. Genz, "An adaptive algorithm for the approximate calculation of multiple integrals," ACM Trans. Math. Soft. 17 (4), 437–451 (1991)
  */
@@ -101,7 +109,11 @@ public:
 			GReal_t fraction=0.25,
 			GReal_t relative_error=0.001):
 				fRelativeError(relative_error),
-				fFraction(fraction)
+				fAbsoluteError(0.0),
+				fFraction(fraction),
+				fMaxBoxes(1<<18),
+				fBatchSize(512),
+				fAdaptive(false)
 	{
 		SetGeometry(LowerLimit, UpperLimit, grid);
 	}
@@ -121,7 +133,11 @@ public:
 			GReal_t fraction=0.25,
 			GReal_t relative_error=0.001):
 				fRelativeError(relative_error),
-				fFraction(fraction)
+				fAbsoluteError(0.0),
+				fFraction(fraction),
+				fMaxBoxes(1<<18),
+				fBatchSize(512),
+				fAdaptive(false)
 	{ SetGeometry(LowerLimit, UpperLimit, nboxes); }
 
 	/**
@@ -138,7 +154,11 @@ public:
 			GReal_t fraction=0.25,
 			GReal_t relative_error=0.001):
 				fRelativeError(relative_error),
-				fFraction(fraction)
+				fAbsoluteError(0.0),
+				fFraction(fraction),
+				fMaxBoxes(1<<18),
+				fBatchSize(512),
+				fAdaptive(false)
 	{ SetGeometry(LowerLimit, UpperLimit, grid); }
 
 
@@ -156,7 +176,11 @@ public:
 			GReal_t fraction=0.25,
 			GReal_t relative_error=0.001):
 				fRelativeError(relative_error),
-				fFraction(fraction)
+				fAbsoluteError(0.0),
+				fFraction(fraction),
+				fMaxBoxes(1<<18),
+				fBatchSize(512),
+				fAdaptive(false)
 	{ SetGeometry(LowerLimit, UpperLimit, nboxes); }
 
 
@@ -225,6 +249,60 @@ public:
 		fGenzMalikRule = genzMalikRule;
 	}
 
+	GReal_t GetRelativeError() const {
+		return fRelativeError;
+	}
+
+	void SetRelativeError(GReal_t relativeError) {
+		fRelativeError = relativeError;
+	}
+
+	GReal_t GetAbsoluteError() const {
+		return fAbsoluteError;
+	}
+
+	void SetAbsoluteError(GReal_t absoluteError) {
+		fAbsoluteError = absoluteError;
+	}
+
+	GReal_t GetFraction() const {
+		return fFraction;
+	}
+
+	void SetFraction(GReal_t fraction) {
+		fFraction = fraction;
+	}
+
+	/**
+	 * Maximum number of boxes in adaptive mode.
+	 */
+	size_t GetMaxBoxes() const {
+		return fMaxBoxes;
+	}
+
+	void SetMaxBoxes(size_t maxBoxes) {
+		fMaxBoxes = maxBoxes;
+	}
+
+	/**
+	 * Maximum number of boxes bisected per iteration in adaptive mode.
+	 */
+	size_t GetBatchSize() const {
+		return fBatchSize;
+	}
+
+	void SetBatchSize(size_t batchSize) {
+		fBatchSize = batchSize;
+	}
+
+	bool IsAdaptive() const {
+		return fAdaptive;
+	}
+
+	void SetAdaptive(bool adaptive) {
+		fAdaptive = adaptive;
+	}
+
 
 
 
@@ -233,6 +311,9 @@ private:
 	template<typename FUNCTOR, typename Vector>
 	void AdaptiveIntegration(FUNCTOR const& functor, Vector& BoxList);
 
+	template<typename FUNCTOR>
+	std::pair<GReal_t, GReal_t> HeapIntegration(FUNCTOR const& functor);
+
 	template<typename Vector>
 	std::pair<GReal_t, GReal_t> CalculateIntegral( Vector const& BoxList);
 
@@ -261,7 +342,11 @@ private:
 
 
 	GReal_t fRelativeError;
+	GReal_t fAbsoluteError;
 	GReal_t fFraction;
+	size_t  fMaxBoxes;
+	size_t  fBatchSize;
+	bool    fAdaptive;
 	GenzMalikRule<  N,  hydra::detail::BackendPolicy<BACKEND>> fGenzMalikRule;
 	box_list_type fBoxList;
 
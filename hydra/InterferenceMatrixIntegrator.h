@@ -0,0 +1,329 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * InterferenceMatrixIntegrator.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+#ifndef INTERFERENCEMATRIXINTEGRATOR_H_
+#define INTERFERENCEMATRIXINTEGRATOR_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/Integrator.h>
+#include <hydra/detail/Hash.h>
+#include <hydra/detail/TypeTraits.h>
+#include <hydra/detail/utility/Generic.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
+#include <hydra/detail/functors/MultiIntegrand.h>
+#include <hydra/detail/functors/InterferenceMatrix.h>
+#include <hydra/detail/functors/ProcessCallsPlain.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <stdexcept>
+
+namespace hydra {
+
+template<typename BACKEND, typename Iterator>
+class InterferenceMatrixIntegrator;
+
+/**
+ * \ingroup numerical_integration
+ *
+ * \brief Normalization of coherent sums of amplitudes, \f$ |\sum_i c_i A_i(x)|^2 \f$, from a cached interference matrix.
+ *
+ * This integrator normalizes models built as `hydra::compose(norm, A_0, ..., A_{K-1})`, where `norm` returns the
+ * squared modulus of the sum of the complex amplitudes, as the isobar models of Dalitz plot analyses.
+ * Each amplitude is the product of a complex coupling \f$c_i\f$, stored in two of its parameters (the real and
+ * imaginary parts, by default the parameters 0 and 1), and a shape \f$s_i(x)\f$, depending on the other parameters.
+ * Over a sample of events \f$x_e\f$ with weights \f$w_e\f$, the normalization is
+ * \f[ I = \frac{S}{n} \sum_e w_e |\sum_i c_i s_i(x_e)|^2 = S \sum_{ij} c_i M_{ij} c^*_j, \qquad
+ *    M_{ij} = \frac{1}{n} \sum_e w_e s_i(x_e) s^*_j(x_e), \f]
+ * where \f$S\f$ is a constant scale, for example the volume of the phase-space.
+ *
+ * The values of the shapes at the events and the matrix \f$M\f$ are cached. When Integrate(...) is called,
+ * only the shapes whose parameters changed since the last call are evaluated again, followed by the update
+ * of the corresponding rows and columns of \f$M\f$. When only couplings change, the normalization costs
+ * \f$K^2\f$ operations. The cache needs \f$K n\f$ complex numbers and is shared among copies of the integrator.
+ *
+ * \tparam BACKEND back end where the cache lives and the calculations are performed.
+ * \tparam Iterator iterator over the events of the sample, which must stay valid while the integrator is used.
+ */
+template<hydra::detail::Backend BACKEND, typename Iterator>
+class InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>:
+public Integral<InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND> system_t;
+	typedef typename system_t::template container<GReal_t> vector_t;
+	typedef typename system_t::template container<hydra::complex<GReal_t>> complex_vector_t;
+
+	struct cache_t
+	{
+		size_t fNAmplitudes{0};
+		size_t fNRowUpdates{0};
+		complex_vector_t fShapes;
+		std::vector<hydra::complex<GReal_t>> fMatrix;
+		std::vector<size_t> fShapeKeys;
+		std::vector<bool> fValid;
+	};
+
+public:
+
+	InterferenceMatrixIntegrator()=delete;
+
+	/**
+	 * @brief Constructor for unweighted samples.
+	 * @param begin iterator pointing to the first event of the sample.
+	 * @param end iterator pointing to the past-the-end event of the sample.
+	 * @param scale constant factor applied to the sample average, e.g. the phase-space volume.
+	 */
+	InterferenceMatrixIntegrator(Iterator begin, Iterator end, GReal_t scale=1.0):
+		fBegin(begin),
+		fEnd(end),
+		fNEvents(hydra::thrust::distance(begin, end)),
+		fCouplingRe(0),
+		fCouplingIm(1),
+		fScale(scale),
+		fErrorEstimation(false),
+		fWeights(hydra::thrust::distance(begin, end), 1.0),
+		fCache(std::make_shared<cache_t>())
+	{
+		if(fNEvents < 2)
+			throw std::invalid_argument("[hydra::InterferenceMatrixIntegrator]: Sample needs at least two events. (fNEvents < 2)");
+	}
+
+	/**
+	 * @brief Constructor for weighted samples, as phase-space events.
+	 * @param begin iterator pointing to the first event of the sample.
+	 * @param end iterator pointing to the past-the-end event of the sample.
+	 * @param weights iterator pointing to the weight of the first event.
+	 * @param scale constant factor applied to the sample average, e.g. the phase-space volume.
+	 */
+	template<typename WeightIterator,
+		typename=typename std::enable_if<detail::is_iterator<WeightIterator>::value>::type>
+	InterferenceMatrixIntegrator(Iterator begin, Iterator end, WeightIterator weights, GReal_t scale=1.0):
+		fBegin(begin),
+		fEnd(end),
+		fNEvents(hydra::thrust::distance(begin, end)),
+		fCouplingRe(0),
+		fCouplingIm(1),
+		fScale(scale),
+		fErrorEstimation(false),
+		fWeights(weights, weights + hydra::thrust::distance(begin, end)),
+		fCache(std::make_shared<cache_t>())
+	{
+		if(fNEvents < 2)
+			throw std::invalid_argument("[hydra::InterferenceMatrixIntegrator]: Sample needs at least two events. (fNEvents < 2)");
+	}
+
+	/**
+	 * @brief Copy constructor. The copy shares the cache with other.
+	 */
+	InterferenceMatrixIntegrator(InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator> const& other):
+		Integral<InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>>(),
+		fBegin(other.GetBegin()),
+		fEnd(other.GetEnd()),
+		fNEvents(other.GetNEvents()),
+		fCouplingRe(other.GetCouplingIndexes().first),
+		fCouplingIm(other.GetCouplingIndexes().second),
+		fScale(other.GetScale()),
+		fErrorEstimation(other.IsErrorEstimation()),
+		fWeights(other.GetWeights()),
+		fCache(other.fCache)
+	{}
+
+	InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>&
+	operator=(InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator> const& other)
+	{
+		if(this==&other) return *this;
+
+		fBegin           = other.GetBegin();
+		fEnd             = other.GetEnd();
+		fNEvents         = other.GetNEvents();
+		fCouplingRe      = other.GetCouplingIndexes().first;
+		fCouplingIm      = other.GetCouplingIndexes().second;
+		fScale           = other.GetScale();
+		fErrorEstimation = other.IsErrorEstimation();
+		fWeights         = other.GetWeights();
+		fCache           = other.fCache;
+
+		return *this;
+	}
+
+	/**
+	 * @brief Normalization of the model.
+	 * @param functor model, built as hydra::compose(norm, amplitudes...).
+	 * @return std::pair<GReal_t, GReal_t> with the normalization and its statistical error,
+	 * which is zero unless the error estimation is enabled.
+	 */
+	template<typename FUNCTOR>
+	std::pair<GReal_t, GReal_t> Integrate(FUNCTOR const& functor);
+
+	/**
+	 * @brief Drop the cached shapes and matrix.
+	 */
+	inline void Reset() {
+		fCache = std::make_shared<cache_t>();
+	}
+
+	/**
+	 * @brief Interference matrix, stored as [i*K + j].
+	 */
+	inline const std::vector<hydra::complex<GReal_t>>& GetMatrix() const {
+		return fCache->fMatrix;
+	}
+
+	/**
+	 * @brief Number of rows of the matrix calculated so far.
+	 */
+	inline size_t GetNRowUpdates() const {
+		return fCache->fNRowUpdates;
+	}
+
+	/**
+	 * @brief Indexes of the parameters of each amplitude holding the real and imaginary parts of its coupling.
+	 */
+	inline std::pair<size_t, size_t> GetCouplingIndexes() const {
+		return std::make_pair(fCouplingRe, fCouplingIm);
+	}
+
+	inline void SetCouplingIndexes(size_t re, size_t im) {
+		fCouplingRe = re;
+		fCouplingIm = im;
+		Reset();
+	}
+
+	/**
+	 * @brief If true, the statistical error of the normalization is estimated, in one pass over the cached shapes.
+	 */
+	inline bool IsErrorEstimation() const {
+		return fErrorEstimation;
+	}
+
+	inline void SetErrorEstimation(bool errorEstimation) {
+		fErrorEstimation = errorEstimation;
+	}
+
+	inline GReal_t GetScale() const {
+		return fScale;
+	}
+
+	inline void SetScale(GReal_t scale) {
+		fScale = scale;
+	}
+
+	inline Iterator GetBegin() const {
+		return fBegin;
+	}
+
+	inline Iterator GetEnd() const {
+		return fEnd;
+	}
+
+	inline size_t GetNEvents() const {
+		return fNEvents;
+	}
+
+	inline const vector_t& GetWeights() const {
+		return fWeights;
+	}
+
+private:
+
+	template<typename Amplitudes, size_t ...I>
+	inline void UpdateShapes(Amplitudes const& amplitudes, std::vector<bool>& changed, detail::index_sequence<I...>);
+
+	template<typename Amplitude>
+	bool UpdateShape(size_t i, Amplitude const& amplitude);
+
+	template<size_t K>
+	void UpdateRow(size_t i);
+
+	template<typename Amplitude>
+	inline hydra::complex<GReal_t> GetCoupling(Amplitude const& amplitude) const {
+		return hydra::complex<GReal_t>(amplitude.GetParameter(fCouplingRe).GetValue(),
+				amplitude.GetParameter(fCouplingIm).GetValue());
+	}
+
+	template<typename Amplitudes, size_t ...I>
+	inline std::array<hydra::complex<GReal_t>, sizeof...(I)>
+	GetCouplings(Amplitudes const& amplitudes, detail::index_sequence<I...>) const {
+		return std::array<hydra::complex<GReal_t>, sizeof...(I)>{{ GetCoupling(hydra::thrust::get<I>(amplitudes))... }};
+	}
+
+	template<typename Amplitude>
+	size_t GetShapeKey(Amplitude const& amplitude) const;
+
+	Iterator fBegin;
+	Iterator fEnd;
+	size_t   fNEvents;
+	size_t   fCouplingRe;
+	size_t   fCouplingIm;
+	GReal_t  fScale;
+	bool     fErrorEstimation;
+	vector_t fWeights;
+	std::shared_ptr<cache_t> fCache;
+};
+
+/**
+ * \ingroup numerical_integration
+ * \brief Build a hydra::InterferenceMatrixIntegrator for an unweighted sample.
+ */
+template<hydra::detail::Backend BACKEND, typename Iterator>
+inline InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>
+make_interference_matrix_integrator(hydra::detail::BackendPolicy<BACKEND> const&,
+		Iterator begin, Iterator end, GReal_t scale=1.0)
+{
+	return InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>(begin, end, scale);
+}
+
+/**
+ * \ingroup numerical_integration
+ * \brief Build a hydra::InterferenceMatrixIntegrator for a weighted sample.
+ */
+template<hydra::detail::Backend BACKEND, typename Iterator, typename WeightIterator>
+inline typename std::enable_if<detail::is_iterator<WeightIterator>::value,
+	InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>>::type
+make_interference_matrix_integrator(hydra::detail::BackendPolicy<BACKEND> const&,
+		Iterator begin, Iterator end, WeightIterator weights, GReal_t scale=1.0)
+{
+	return InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>(begin, end, weights, scale);
+}
+
+}  // namespace hydra
+
+#include <hydra/detail/InterferenceMatrixIntegrator.inl>
+
+#endif /* INTERFERENCEMATRIXINTEGRATOR_H_ */
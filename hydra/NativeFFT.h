@@ -0,0 +1,81 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * NativeFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef HYDRA_NATIVEFFT_H_
+#define HYDRA_NATIVEFFT_H_
+
+/**
+ * Header-only FFT back-end, for the builds without FFTW or cuFFT. It implements the interface of the
+ * FFTW wrappers, so hydra::convolute and hydra::ConvolutionFunctor accept hydra::fft::native_f64 and
+ * hydra::fft::native_f32 in place of hydra::fft::fftw_f64 and hydra::fft::fftw_f32.
+ */
+#include <hydra/detail/FFTPolicy.h>
+#include<hydra/detail/native_fft/NativeFFTPlan.h>
+#include<hydra/detail/native_fft/BaseNativeFFT.h>
+#include<hydra/detail/native_fft/ComplexToRealNativeFFT.h>
+#include<hydra/detail/native_fft/RealToComplexNativeFFT.h>
+#include<hydra/detail/native_fft/ComplexToComplexNativeFFT.h>
+#include<hydra/host/System.h>
+#include<hydra/device/System.h>
+
+namespace hydra {
+
+	namespace detail {
+
+		template<typename T>
+		struct FFTPolicy<T, detail::Native>
+		{
+			typedef ComplexToComplexNativeFFT<T> C2C;
+			typedef    RealToComplexNativeFFT<T> R2C;
+			typedef    ComplexToRealNativeFFT<T> C2R;
+			typedef    hydra::host::sys_t host_backend_type;
+#if HYDRA_DEVICE_SYSTEM!=CUDA
+			typedef       hydra::device::sys_t device_backend_type;
+#else
+			typedef       hydra::host::sys_t device_backend_type;
+#endif
+		};
+
+	}  // namespace detail
+
+
+	namespace fft {
+
+		typedef detail::FFTPolicy<double, detail::Native> native_f64_t;
+		typedef detail::FFTPolicy< float, detail::Native> native_f32_t;
+
+		static const native_f32_t native_f32=native_f32_t();
+
+		static const native_f64_t native_f64=native_f64_t();
+
+
+	}  // namespace fft
+
+}  // namespace hydra
+
+#endif /* HYDRA_NATIVEFFT_H_ */
@@ -0,0 +1,332 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * OnlineUnweighting.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef ONLINEUNWEIGHTING_H_
+#define ONLINEUNWEIGHTING_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Range.h>
+#include <hydra/detail/Iterable_traits.h>
+#include <hydra/detail/TypeTraits.h>
+#include <hydra/detail/PRNGTypedefs.h>
+#include <hydra/detail/functors/UnweightingFlag.h>
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+namespace hydra {
+
+/**
+ * \ingroup random
+ * \brief Efficiency statistics of one unweighting batch.
+ */
+class UnweightingStats
+{
+public:
+
+	UnweightingStats()=default;
+
+	UnweightingStats(detail::StatsUnweighting const& stats, double max_weight):
+		fStats(stats),
+		fMaxWeight(max_weight)
+	{}
+
+	/**
+	 * Number of weighted events processed.
+	 */
+	inline size_t GetNTrials() const {
+		return fStats.fNTrials;
+	}
+
+	/**
+	 * Number of accepted events.
+	 */
+	inline size_t GetNAccepted() const {
+		return fStats.fNAccepted;
+	}
+
+	/**
+	 * Number of accepted events with weight above the maximum weight in use.
+	 * These events carry a residual weight (weight/max) greater than one.
+	 */
+	inline size_t GetNOvershoot() const {
+		return fStats.fNOvershoot;
+	}
+
+	/**
+	 * Maximum weight used in the accept-reject decisions.
+	 */
+	inline double GetMaxWeight() const {
+		return fMaxWeight;
+	}
+
+	/**
+	 * Largest weight found in the batch.
+	 */
+	inline double GetLargestWeight() const {
+		return fStats.fMaxWeight;
+	}
+
+	inline double GetSumWeights() const {
+		return fStats.fSumW;
+	}
+
+	inline double GetSumWeights2() const {
+		return fStats.fSumW2;
+	}
+
+	/**
+	 * Sum of the residual weights of the accepted events.
+	 */
+	inline double GetSumResiduals() const {
+		return fStats.fSumResidual;
+	}
+
+	/**
+	 * Fraction of accepted events.
+	 */
+	inline double GetEfficiency() const {
+		return fStats.fNTrials > 0 ? double(fStats.fNAccepted)/fStats.fNTrials : 0.0;
+	}
+
+	/**
+	 * Fraction of the accepted events with residual weight greater than one.
+	 */
+	inline double GetOvershootFraction() const {
+		return fStats.fNAccepted > 0 ? double(fStats.fNOvershoot)/fStats.fNAccepted : 0.0;
+	}
+
+private:
+
+	detail::StatsUnweighting fStats;
+	double fMaxWeight{0.0};
+};
+
+/**
+ * \ingroup random
+ */
+template<typename Backend, typename GRND=hydra::default_random_engine>
+class OnlineUnweighting;
+
+/**
+ * \ingroup random
+ * \brief Single-pass unweighting of weighted samples, with on-the-fly estimation of the maximum weight.
+ *
+ * The weighted sample is processed in batches, which are not required to stay in memory
+ * after being processed. The maximum weight is estimated from a pilot sample as the
+ * weight quantile `quantile`, inflated by `safety_factor`. If no pilot is provided, the first batch is used.
+ * The events of each batch are accepted with probability weight/max. Events with weight above the running
+ * maximum are always accepted and receive the residual weight weight/max, so that the sum of residual weights
+ * is an unbiased estimator of the weighted sample. Afterwards, the running maximum is raised to the largest weight
+ * found, so that subsequent batches are unweighted with the corrected bound.
+ *
+ * Since the maximum can rise between batches, an accepted event of the batch k stands for max_k/max events
+ * of a sample unweighted at the final maximum: batches processed with a lower maximum are over-represented
+ * if their events are simply merged. The absolute weight of an accepted event is its residual weight times
+ * GetBatchStats(k).GetMaxWeight(), and GetWeightScale(k) gives the factor bringing the residual weights of
+ * the batch k to the current maximum. Apply it once all batches are processed.
+ *
+ * The random numbers used for the event with global index i (counting all processed events) are drawn from the
+ * position i of the sequence produced by the seed, so the result does not depend on how the sample is split.
+ *
+ * \tparam Backend memory space to allocate the temporary storage.
+ * \tparam GRND underlying random number generator.
+ */
+template<hydra::detail::Backend BACKEND, typename GRND>
+class OnlineUnweighting<hydra::detail::BackendPolicy<BACKEND>, GRND>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND>  system_type;
+
+public:
+
+	/**
+	 * @brief OnlineUnweighting ctor.
+	 * @param quantile weight quantile of the pilot sample used as maximum weight.
+	 * @param safety_factor factor applied to the quantile.
+	 * @param seed seed for the underlying pseudo-random number generator.
+	 */
+	OnlineUnweighting(double quantile=0.9999, double safety_factor=1.1, size_t seed=0x6c8e9cf570932bd5):
+		fQuantile(quantile),
+		fSafetyFactor(safety_factor),
+		fMaxWeight(0.0),
+		fSeed(seed),
+		fJump(0)
+	{
+		if( !(quantile > 0.0 && quantile <= 1.0) )
+			throw std::invalid_argument("[hydra::OnlineUnweighting]: Quantile out of range. (quantile <= 0 || quantile > 1)");
+
+		if( !(safety_factor >= 1.0) )
+			throw std::invalid_argument("[hydra::OnlineUnweighting]: Safety factor smaller than one. (safety_factor < 1)");
+	}
+
+	/**
+	 * @brief Estimate the maximum weight from the pilot sample [wbegin, wend).
+	 * @return the estimated maximum weight.
+	 */
+	template<typename Iterator>
+	double Pilot(Iterator wbegin, Iterator wend);
+
+	template<typename Iterable>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, double>::type
+	Pilot(Iterable&& weights){
+		return Pilot(std::forward<Iterable>(weights).begin(), std::forward<Iterable>(weights).end());
+	}
+
+	/**
+	 * @brief Unweight the batch [data_begin, data_end) in place, in a single pass.
+	 * The accepted events are moved to the front of the range, keeping their relative order.
+	 * @param data_begin iterator pointing to the begin of the data.
+	 * @param data_end iterator pointing to the end of the data.
+	 * @param weights_begin iterator pointing to the begin of the weights.
+	 * @return hydra::Range object pointing to the accepted events.
+	 */
+	template<typename IteratorData, typename IteratorWeight>
+	typename std::enable_if<hydra::detail::is_iterator<IteratorData>::value, Range<IteratorData>>::type
+	Unweight(IteratorData data_begin, IteratorData data_end, IteratorWeight weights_begin);
+
+	/**
+	 * @brief Unweight the batch [data_begin, data_end) in place, in a single pass, storing the residual weights.
+	 * The residual weights, aligned with the reordered data, are written to the range starting at residuals_begin:
+	 * one for regular accepted events, weight/max for overshooting events and zero for rejected events.
+	 * @return hydra::Range object pointing to the accepted events.
+	 */
+	template<typename IteratorData, typename IteratorWeight, typename IteratorResidual>
+	typename std::enable_if<hydra::detail::is_iterator<IteratorData>::value, Range<IteratorData>>::type
+	Unweight(IteratorData data_begin, IteratorData data_end, IteratorWeight weights_begin,
+			IteratorResidual residuals_begin);
+
+	template<typename IterableData, typename IterableWeight>
+	inline typename std::enable_if<hydra::detail::is_iterable<IterableData>::value &&
+	hydra::detail::is_iterable<IterableWeight>::value,
+	Range< decltype(std::declval<IterableData>().begin())> >::type
+	Unweight(IterableData&& data, IterableWeight&& weights){
+
+		return Unweight(std::forward<IterableData>(data).begin(), std::forward<IterableData>(data).end(),
+				std::forward<IterableWeight>(weights).begin());
+	}
+
+	template<typename IterableData, typename IterableWeight, typename IterableResidual>
+	inline typename std::enable_if<hydra::detail::is_iterable<IterableData>::value &&
+	hydra::detail::is_iterable<IterableWeight>::value &&
+	hydra::detail::is_iterable<IterableResidual>::value,
+	Range< decltype(std::declval<IterableData>().begin())> >::type
+	Unweight(IterableData&& data, IterableWeight&& weights, IterableResidual&& residuals){
+
+		return Unweight(std::forward<IterableData>(data).begin(), std::forward<IterableData>(data).end(),
+				std::forward<IterableWeight>(weights).begin(), std::forward<IterableResidual>(residuals).begin());
+	}
+
+	/**
+	 * @brief Forget the maximum weight and the statistics.
+	 */
+	inline void Reset() {
+		fMaxWeight = 0.0;
+		fJump = 0;
+		fBatchStats.clear();
+		fStats = detail::StatsUnweighting();
+	}
+
+	/**
+	 * @brief Statistics of the batch k.
+	 */
+	inline UnweightingStats GetBatchStats(size_t k) const {
+		return fBatchStats.at(k);
+	}
+
+	/**
+	 * @brief Cumulative statistics of all processed batches.
+	 */
+	inline UnweightingStats GetStats() const {
+		return UnweightingStats(fStats, fMaxWeight);
+	}
+
+	inline size_t GetNBatches() const {
+		return fBatchStats.size();
+	}
+
+	/**
+	 * @brief Factor bringing the residual weights of the batch k to the current maximum weight,
+	 * the ratio between the maximum weight used for the batch k and the current one. It is one for
+	 * all batches processed after the last raise of the maximum, and below one for the earlier ones.
+	 */
+	inline double GetWeightScale(size_t k) const {
+		return fBatchStats.at(k).GetMaxWeight()/fMaxWeight;
+	}
+
+	/**
+	 * @brief Current maximum weight. Zero if neither a pilot nor a batch was processed.
+	 */
+	inline double GetMaxWeight() const {
+		return fMaxWeight;
+	}
+
+	/**
+	 * @brief Set the maximum weight, skipping the pilot.
+	 */
+	inline void SetMaxWeight(double max_weight) {
+		fMaxWeight = max_weight;
+	}
+
+	inline double GetQuantile() const {
+		return fQuantile;
+	}
+
+	inline double GetSafetyFactor() const {
+		return fSafetyFactor;
+	}
+
+	inline size_t GetSeed() const {
+		return fSeed;
+	}
+
+	inline void SetSeed(size_t seed) {
+		fSeed = seed;
+	}
+
+private:
+
+	template<typename Pointer>
+	double Quantile(Pointer wbegin, size_t n) const;
+
+	double fQuantile;
+	double fSafetyFactor;
+	double fMaxWeight;
+	size_t fSeed;
+	size_t fJump;
+	detail::StatsUnweighting fStats;
+	std::vector<UnweightingStats> fBatchStats;
+};
+
+}  // namespace hydra
+
+#include <hydra/detail/OnlineUnweighting.inl>
+
+#endif /* ONLINEUNWEIGHTING_H_ */
@@ -251,6 +251,20 @@ public:
 	template<typename Iterator1, typename Iterator2, hydra::detail::Backend BACKEND>
 	void Generate(hydra::detail::BackendPolicy<BACKEND> const& exec_policy , Iterator1 begin, Iterator1 end, Iterator2 daughters_begin);
 
+	/**
+	 * @brief Generate the slice [offset, offset + (end-begin) ) of the sequence of events
+	 * produced by Generate(mother, ...), given a mother particle and a output range.
+	 * The events depend only on their global index, so any slice can be regenerated in isolation.
+	 * @param exec_policy Back-end.
+	 * @param mother Mother particle.
+	 * @param begin Iterator pointing to the begin output range.
+	 * @param end Iterator pointing to the end output range.
+	 * @param offset Global index of the first event of the slice.
+	 */
+	template<typename Iterator, hydra::detail::Backend BACKEND>
+	void Generate(hydra::detail::BackendPolicy<BACKEND> const& exec_policy, Vector4R const& mother,
+			Iterator begin, Iterator end, size_t offset);
+
 	// Generate range semantics ------------------------------------------------
 	/**
 	 * @brief Generate a phase-space  given a mother particle and a output range.
@@ -282,13 +296,13 @@ public:
 	 * @brief Get seed of the underlying generator;
 	 * @return
 	 */
-	inline GInt_t GetSeed() const;
+	inline size_t GetSeed() const;
 
 	/**
 	 * @brief Set seed of the underlying generator;
 	 * @param _seed
 	 */
-	inline void SetSeed(GInt_t _seed) ;
+	inline void SetSeed(size_t _seed) ;
 
 	const GReal_t* GetMasses() const {
 		return fMasses;
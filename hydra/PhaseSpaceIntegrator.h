@@ -34,29 +34,123 @@
 #include <hydra/Types.h>
 #include <hydra/Integrator.h>
 #include <hydra/PhaseSpace.h>
+#include <hydra/Decays.h>
+#include <hydra/multivector.h>
 #include <hydra/detail/Print.h>
+#include <hydra/detail/functors/StatsPHSP.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
 #include <tuple>
+#include <memory>
+#include <type_traits>
 #include <hydra/Random.h>
 
 namespace hydra {
 
+namespace detail {
+
+namespace phase_space_integrator {
+
+/*
+ * Storage of the per-event invariants calculated by the functor Kinematics,
+ * which returns a hydra::tuple. Nothing is stored if Kinematics is void.
+ */
+template<typename Kinematics, typename Backend>
+struct invariants_storage
+{
+	typedef multivector<typename Kinematics::return_type, Backend> type;
+};
+
+template<typename Backend>
+struct invariants_storage<void, Backend>
+{
+	typedef void* type;
+};
+
+/*
+ * Packs w*f(x) of a cached event, given as the tuple (w, x), in a StatsPHSP.
+ */
+template<typename Functor>
+struct WeightedCall
+{
+	WeightedCall(Functor const& functor):
+		fFunctor(functor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	WeightedCall(WeightedCall<Functor> const& other):
+		fFunctor(other.fFunctor)
+	{}
+
+	template<typename T>
+	__hydra_host__ __hydra_device__ inline
+	StatsPHSP operator()(T event)
+	{
+		StatsPHSP result;
+
+		result.fMean = fFunctor(hydra::thrust::get<1>(event));
+		result.fW    = hydra::thrust::get<0>(event);
+		result.fM2   = 0.0;
+
+		return result;
+	}
+
+	Functor fFunctor;
+};
+
+}  // namespace phase_space_integrator
+
+}  // namespace detail
+
 /**
  * \ingroup phsp
  *
  */
-template <size_t N, typename Backend,  typename GRND=hydra::default_random_engine>
+template <size_t N, typename Backend,  typename GRND=hydra::default_random_engine, typename Kinematics=void>
 class PhaseSpaceIntegrator;
 
 /**
  * \ingroup phsp numerical integration for Pdfs evaluated over a N-particle phase-space.
- * \tparam BACKEND to perform the calculation.
+ *
+ * By default, each call to Integrate(...) generates a new sample of fNSamples events.
+ * With SetSampleCaching(true), the events and their weights are generated once, stored with SoA layout
+ * in a hydra::Decays container, and reused by the following calls, which only evaluate the functor.
+ * If a functor Kinematics is provided, the integrand is evaluated on the invariants calculated from
+ * each cached event, e.g. the squared invariant masses and helicity angles, which are stored instead of
+ * the events. In this case, the integrand's signature must match the tuple returned by Kinematics.
+ * The cache is shared among copies of the integrator.
+ *
  * \tparam N is the number of particles in final state.
+ * \tparam BACKEND to perform the calculation.
  * \tparam GRND underlying random number generator. See the options in hydra::thrust::random namespace.
+ * \tparam Kinematics functor taking the N final state particles and returning a hydra::tuple with the invariants to cache, or void.
  */
-template <size_t N, hydra::detail::Backend BACKEND,  typename GRND>
-class PhaseSpaceIntegrator<N,  hydra::detail::BackendPolicy<BACKEND>, GRND>:
-public Integral< PhaseSpaceIntegrator<N,  hydra::detail::BackendPolicy<BACKEND>, GRND> >
+template <size_t N, hydra::detail::Backend BACKEND,  typename GRND, typename Kinematics>
+class PhaseSpaceIntegrator<N,  hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>:
+public Integral< PhaseSpaceIntegrator<N,  hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics> >
 {
+	typedef hydra::detail::BackendPolicy<BACKEND> system_t;
+	typedef typename system_t::template container<GReal_t> vector_t;
+	typedef Decays<typename hydra::detail::tuple_type<N, Vector4R>::type, system_t> events_t;
+	typedef typename detail::phase_space_integrator::invariants_storage<Kinematics, system_t>::type invariants_t;
+
+	struct cache_t
+	{
+		cache_t(GReal_t motherMass, const GReal_t* masses):
+			fEvents(motherMass, ArrayMasses(masses))
+		{}
+
+		static std::array<GReal_t, N> ArrayMasses(const GReal_t* masses)
+		{
+			std::array<GReal_t, N> result;
+			for(size_t i=0; i<N; i++) result[i] = masses[i];
+			return result;
+		}
+
+		events_t     fEvents;
+		vector_t     fWeights;
+		invariants_t fInvariants{};
+	};
+
 public:
 	//tag
 	typedef void hydra_integrator_tag;
@@ -65,14 +159,16 @@ public:
 	PhaseSpaceIntegrator(const GReal_t motherMass, const GReal_t (&daughtersMasses)[N], size_t n):
 		fGenerator(motherMass,  daughtersMasses),
 		fMother(motherMass,0,0,0),
-		fNSamples(n)
+		fNSamples(n),
+		fSampleCaching(false)
 	{}
 
 
 	PhaseSpaceIntegrator(const GReal_t motherMass, std::array<GReal_t,N> const& daughtersMasses, size_t n):
 		fGenerator(motherMass, daughtersMasses),
 		fMother(motherMass,0,0,0),
-		fNSamples(n)
+		fNSamples(n),
+		fSampleCaching(false)
 	{}
 
 
@@ -80,43 +176,66 @@ public:
 	PhaseSpaceIntegrator(const GReal_t motherMass, std::initializer_list<GReal_t> const& daughtersMasses, size_t n):
 		fGenerator(motherMass, daughtersMasses),
 		fMother(motherMass,0,0,0),
-		fNSamples(n)
+		fNSamples(n),
+		fSampleCaching(false)
 	{}
 
-	PhaseSpaceIntegrator( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND>const& other):
+	/**
+	 * @brief Constructor caching the invariants calculated by kinematics for each event. Enables the sample caching.
+	 */
+	template<typename K=Kinematics, typename=typename std::enable_if<!std::is_void<K>::value>::type>
+	PhaseSpaceIntegrator(const GReal_t motherMass, std::array<GReal_t,N> const& daughtersMasses, size_t n,
+			K const& kinematics):
+		fGenerator(motherMass, daughtersMasses),
+		fMother(motherMass,0,0,0),
+		fNSamples(n),
+		fSampleCaching(true),
+		fKinematics(std::make_shared<K>(kinematics))
+	{}
+
+	PhaseSpaceIntegrator( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>const& other):
 		fGenerator( other.GetGenerator()),
 		fMother( other. GetMother()  ),
-		fNSamples(other.GetNSamples())
+		fNSamples(other.GetNSamples()),
+		fSampleCaching(other.IsSampleCaching()),
+		fKinematics(other.fKinematics),
+		fCache(other.fCache)
 	{}
 
 	template < hydra::detail::Backend BACKEND2,  typename GRND2>
-	PhaseSpaceIntegrator( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND2>, GRND2>const& other):
+	PhaseSpaceIntegrator( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND2>, GRND2, Kinematics>const& other):
 	fGenerator( other.GetGenerator()),
 	fMother( other. GetMother()  ),
-	fNSamples(other.GetNSamples())
+	fNSamples(other.GetNSamples()),
+	fSampleCaching(other.IsSampleCaching()),
+	fKinematics(other.GetKinematics())
 	{}
 
-	PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND>&
-	operator=( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND>const& other)
+	PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>&
+	operator=( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>const& other)
 	{
 		if(this==&other) return *this;
 
 		fGenerator = other.GetGenerator() ;
 		fMother      =  other. GetMother()  ;
 		fNSamples  = other.GetNSamples() ;
+		fSampleCaching = other.IsSampleCaching();
+		fKinematics = other.fKinematics;
+		fCache = other.fCache;
 
 		return *this;
 	}
 
 	template < hydra::detail::Backend  BACKEND2,  typename GRND2>
-	PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND>&
-	operator=( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND2>, GRND2>const& other)
+	PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>&
+	operator=( PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND2>, GRND2, Kinematics>const& other)
 	{
-		if(this==&other) return *this;
-
 		fGenerator = other.GetGenerator() ;
 		fMother =  other. GetMother()  ;
 		fNSamples  = other.GetNSamples() ;
+		fSampleCaching = other.IsSampleCaching();
+		fKinematics = other.GetKinematics();
+		fCache.reset();
 
 		return *this;
 	}
@@ -132,6 +251,7 @@ public:
 
 	void SetGenerator(const PhaseSpace<N, GRND>& generator) {
 		fGenerator = generator;
+		fCache.reset();
 	}
 
 	const Vector4R& GetMother() const {
@@ -140,6 +260,7 @@ public:
 
 	void SetMother(const Vector4R& mother) {
 		fMother = mother;
+		fCache.reset();
 	}
 
 	size_t GetNSamples() const {
@@ -148,6 +269,38 @@ public:
 
 	void SetNSamples(size_t nSamples) {
 		fNSamples = nSamples;
+		fCache.reset();
+	}
+
+	/**
+	 * @brief If true, the sample is generated once and reused by the following calls.
+	 * It is always the case if Kinematics is not void.
+	 */
+	bool IsSampleCaching() const {
+		return fSampleCaching;
+	}
+
+	void SetSampleCaching(bool sampleCaching) {
+		fSampleCaching = sampleCaching;
+	}
+
+	/**
+	 * @brief Discard the cached sample. A new one is generated in the next call, e.g. after changing the seed of the generator.
+	 */
+	void ResetCache() {
+		fCache.reset();
+	}
+
+	/**
+	 * @brief Cached phase-space events, or nullptr before the first call in caching mode.
+	 * Invariants are cached instead of the events if Kinematics is not void.
+	 */
+	const events_t* GetCachedEvents() const {
+		return fCache ? &fCache->fEvents : nullptr;
+	}
+
+	const std::shared_ptr<Kinematics>& GetKinematics() const {
+		return fKinematics;
 	}
 
 	template<typename FUNCTOR>
@@ -155,14 +308,17 @@ public:
 
 private:
 
+	void GenerateSample();
+
 	PhaseSpace<N,GRND> fGenerator;
 	Vector4R  fMother;
 	size_t fNSamples;
+	bool   fSampleCaching;
+	std::shared_ptr<Kinematics> fKinematics;
+	std::shared_ptr<cache_t> fCache;
 
 };
 
-
-
 }  // namespace hydra
 
 #include <hydra/detail/PhaseSpaceIntegrator.inl>
@@ -0,0 +1,244 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * PhaseSpaceStream.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef PHASESPACESTREAM_H_
+#define PHASESPACESTREAM_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Vector4R.h>
+#include <hydra/Tuple.h>
+#include <hydra/PhaseSpace.h>
+#include <hydra/Decays.h>
+#include <hydra/detail/PRNGTypedefs.h>
+
+#include <array>
+#include <future>
+#include <utility>
+
+namespace hydra {
+
+/**
+ * \ingroup phsp
+ */
+template<typename Particles, typename Backend, typename GRND=hydra::default_random_engine>
+class PhaseSpaceStream;
+
+/**
+ * \ingroup phsp
+ * \brief Streaming phase-space generator, producing successive fixed-size batches of events.
+ *
+ * The stream splits a sample of `nevents` decays of a mother particle into batches of `batch_size` events,
+ * stored in a hydra::Decays container allocated in the memory space of Backend.
+ * The events of the batch k are the events with global index in [k*batch_size, (k+1)*batch_size) of the
+ * sequence produced by PhaseSpace::Generate. So, any batch is reproducible in isolation, and the
+ * concatenation of all batches is identical to the one-shot generation, using a constant amount of memory.
+ *
+ * If double-buffering is enabled, the generation of the batch k+1 is launched asynchronously
+ * while the batch k is consumed.
+ *
+ * Typical usage:
+ *
+ * \code{.cpp}
+ * hydra::PhaseSpaceStream<hydra::tuple<A,B,C>, hydra::device::sys_t> stream(phsp, mother, nevents, batch_size, true);
+ *
+ * while( stream.HasNext() ){
+ *     auto& batch = stream.Next();
+ *     //evaluate, histogram or unweight the batch...
+ * }
+ * \endcode
+ *
+ * \tparam Particles list of particles in the final state.
+ * \tparam Backend memory space to allocate storage for the batches.
+ * \tparam GRND underlying random number generator.
+ */
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+class PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND>  system_type;
+
+	enum { nparticles = sizeof...(Particles) };
+
+public:
+
+	typedef Decays<hydra::tuple<Particles...>, system_type> decays_type;
+	typedef PhaseSpace<nparticles, GRND> phsp_type;
+
+	PhaseSpaceStream()=delete;
+
+	/**
+	 * @brief PhaseSpaceStream ctor.
+	 * @param phsp phase-space generator.
+	 * @param mother mother particle four-vector.
+	 * @param nevents total number of events.
+	 * @param batch_size number of events per batch. The last batch can be smaller.
+	 * @param double_buffering generate the next batch while the current one is consumed.
+	 */
+	PhaseSpaceStream(phsp_type const& phsp, Vector4R const& mother, size_t nevents, size_t batch_size,
+			bool double_buffering=false):
+		fPhaseSpace(phsp),
+		fMother(mother),
+		fNEvents(nevents),
+		fBatchSize(batch_size),
+		fNBatches(0),
+		fNextBatch(0),
+		fPendingBatch(0),
+		fActive(0),
+		fPrefetched(false),
+		fDoubleBuffering(double_buffering),
+		fBuffers{ decays_type( phsp.GetMotherMass(), get_masses(phsp) ),
+			      decays_type( phsp.GetMotherMass(), get_masses(phsp) ) }
+	{
+		if(fBatchSize==0)
+			throw std::invalid_argument("[hydra::PhaseSpaceStream]: Batch size is zero. (fBatchSize==0)");
+
+		fNBatches = (fNEvents + fBatchSize - 1)/fBatchSize;
+	}
+
+	PhaseSpaceStream(PhaseSpaceStream<hydra::tuple<Particles...>, system_type, GRND> const& other)=delete;
+
+	PhaseSpaceStream<hydra::tuple<Particles...>, system_type, GRND>&
+	operator=(PhaseSpaceStream<hydra::tuple<Particles...>, system_type, GRND> const& other)=delete;
+
+	~PhaseSpaceStream(){
+		Drain();
+	}
+
+	/**
+	 * @brief Check if there are batches left in the stream.
+	 */
+	inline bool HasNext() const {
+		return fNextBatch < fNBatches;
+	}
+
+	/**
+	 * @brief Generate the next batch of the stream and return a reference to it.
+	 * The reference is valid until the next call to Next(), GetBatch(...) or Reset(...).
+	 * The batch can be modified in place, for example to unweight it.
+	 * An exception raised while prefetching a batch is rethrown by the next call to Next() or GetBatch(...),
+	 * and the batch is generated again by the following call to Next(). The destructor discards it.
+	 */
+	decays_type& Next();
+
+	/**
+	 * @brief Generate the batch k in isolation and return a reference to it.
+	 * The position of the stream is not changed.
+	 * The reference is valid until the next call to Next(), GetBatch(...) or Reset(...).
+	 */
+	decays_type& GetBatch(size_t k);
+
+	/**
+	 * @brief Rewind the stream to the batch k.
+	 */
+	void Reset(size_t k=0);
+
+	/**
+	 * @brief Call `consumer(k, batch)` for each of the remaining batches of the stream.
+	 */
+	template<typename Consumer>
+	void ForEach(Consumer&& consumer);
+
+	/**
+	 * @brief Number of events in the batch k.
+	 */
+	inline size_t GetBatchSize(size_t k) const {
+		return k+1 < fNBatches ? fBatchSize : fNEvents - k*fBatchSize;
+	}
+
+	inline size_t GetBatchSize() const {
+		return fBatchSize;
+	}
+
+	inline size_t GetNBatches() const {
+		return fNBatches;
+	}
+
+	inline size_t GetNEvents() const {
+		return fNEvents;
+	}
+
+	inline size_t GetNextBatch() const {
+		return fNextBatch;
+	}
+
+	inline bool IsDoubleBuffering() const {
+		return fDoubleBuffering;
+	}
+
+	inline void SetDoubleBuffering(bool double_buffering) {
+		fDoubleBuffering = double_buffering;
+	}
+
+	inline const Vector4R& GetMother() const {
+		return fMother;
+	}
+
+	inline const phsp_type& GetPhaseSpace() const {
+		return fPhaseSpace;
+	}
+
+private:
+
+	static std::array<double, nparticles> get_masses(phsp_type const& phsp)
+	{
+		std::array<double, nparticles> masses;
+
+		for(size_t i=0; i<nparticles; i++)
+			masses[i] = phsp.GetMasses()[i];
+
+		return masses;
+	}
+
+	void Generate(size_t k, decays_type& buffer);
+
+	//waits for the prefetch task and rethrows its exception, if any
+	void Wait();
+
+	//waits for the prefetch task, discarding its exception
+	void Drain() noexcept;
+
+	phsp_type   fPhaseSpace;
+	Vector4R    fMother;
+	size_t      fNEvents;
+	size_t      fBatchSize;
+	size_t      fNBatches;
+	size_t      fNextBatch;
+	size_t      fPendingBatch;
+	size_t      fActive;
+	bool        fPrefetched;
+	bool        fDoubleBuffering;
+	decays_type fBuffers[2];
+	std::future<void> fPending;
+};
+
+}  // namespace hydra
+
+#include <hydra/detail/PhaseSpaceStream.inl>
+
+#endif /* PHASESPACESTREAM_H_ */
@@ -40,8 +40,10 @@
 #include <hydra/detail/external/hydra_thrust/transform_reduce.h>
 #include <hydra/PlainState.h>
 #include <hydra/detail/functors/ProcessCallsPlain.h>
+#include <hydra/detail/functors/MultiIntegrand.h>
 #include <utility>
 #include <vector>
+#include <limits>
 #include <hydra/Integrator.h>
 #include <hydra/Random.h>
 
@@ -68,6 +70,13 @@ struct Plain;
  * The error estimate itself should decrease as \f$\sigma(f)/\sqrt{N}\f$.
  * The familiar law of errors decreasing as \f$1/\sqrt{N}\f$ applies—to
  * reduce the error by a factor of 10 requires a 100-fold increase in the number of sample points.
+ *
+ * In adaptive mode (Plain::SetAdaptive(true)), the number of calls is not fixed in advance. Integrate(...) processes
+ * successive batches of Plain::GetBatchSize() calls, merging their statistics, and stops as soon as the relative error
+ * is below Plain::GetRelativeError(), the total number of calls reaches Plain::GetNCalls() or the elapsed time
+ * exceeds Plain::GetMaxTime(). Each batch draws the next block of the random number sequence, so
+ * the result after \f$n\f$ calls is the same as with the fixed-size integration. The summary of
+ * each batch is available in Plain::GetBatches().
  */
 template<size_t N, hydra::detail::Backend BACKEND, typename GRND>
 class Plain<N, hydra::detail::BackendPolicy<BACKEND>, GRND>:
@@ -92,7 +101,11 @@ public:
 				fNCalls(calls),
 				fResult(0),
 				fAbsError(0),
-				fVolume(1.0)
+				fVolume(1.0),
+				fAdaptive(false),
+				fBatchSize(1<<20),
+				fRelativeError(1.0e-3),
+				fMaxTime(std::numeric_limits<GReal_t>::max())
 	{
 
 		fVolume=1.0;
@@ -117,7 +130,11 @@ public:
 		fNCalls(calls),
 		fResult(0),
 		fAbsError(0),
-		fVolume(1.0)
+		fVolume(1.0),
+		fAdaptive(false),
+		fBatchSize(1<<20),
+		fRelativeError(1.0e-3),
+		fMaxTime(std::numeric_limits<GReal_t>::max())
 	{
 
 		fVolume=1.0;
@@ -137,6 +154,11 @@ public:
 		fResult(other.GetResult()),
 		fAbsError(other.GetAbsError() ),
 		fVolume(other.GetVolume()),
+		fAdaptive(other.IsAdaptive()),
+		fBatchSize(other.GetBatchSize()),
+		fRelativeError(other.GetRelativeError()),
+		fMaxTime(other.GetMaxTime()),
+		fBatches(other.GetBatches()),
 		fDeltaX(other.GetDeltaX()),
 		fXLow(other.GetXLow())
 	{ }
@@ -151,6 +173,11 @@ public:
 		this->fResult   = other.GetResult();
 		this->fAbsError = other.GetAbsError() ;
 		this->fVolume = other.GetVolume();
+		this->fAdaptive      = other.IsAdaptive();
+		this->fBatchSize     = other.GetBatchSize();
+		this->fRelativeError = other.GetRelativeError();
+		this->fMaxTime       = other.GetMaxTime();
+		this->fBatches       = other.GetBatches();
 		this->fDeltaX = other.GetDeltaX();
 		this->fXLow   = other.GetXLow();
 
@@ -164,6 +191,11 @@ public:
 	fResult(other.GetResult()),
 	fAbsError(other.GetAbsError() ),
 	fVolume(other.GetVolume()),
+	fAdaptive(other.IsAdaptive()),
+	fBatchSize(other.GetBatchSize()),
+	fRelativeError(other.GetRelativeError()),
+	fMaxTime(other.GetMaxTime()),
+	fBatches(other.GetBatches()),
 	fDeltaX(other.GetDeltaX()),
 	fXLow(other.GetXLow())
 	{ }
@@ -179,6 +211,11 @@ public:
 		this->fResult = other.GetResult();
 		this->fAbsError = other.GetAbsError() ;
 		this->fVolume = other.GetVolume() ;
+		this->fAdaptive      = other.IsAdaptive();
+		this->fBatchSize     = other.GetBatchSize();
+		this->fRelativeError = other.GetRelativeError();
+		this->fMaxTime       = other.GetMaxTime();
+		this->fBatches       = other.GetBatches();
 		this->fDeltaX = other.GetDeltaX() ;
 		this->fXLow   = other.GetXLow();
 
@@ -193,7 +230,28 @@ public:
 	 * @return std::pair<GReal_t, GReal_t> with the integration result and error.
 	 */
 	template<typename FUNCTOR>
-	inline std::pair<GReal_t, GReal_t>  Integrate(FUNCTOR const& fFunctor );
+	inline std::pair<GReal_t, GReal_t>  Integrate(FUNCTOR const& fFunctor ){
+		return fAdaptive ? IntegrateAdaptive(fFunctor) : IntegrateFixed(fFunctor);
+	}
+
+	/**
+	 * @brief Integrates several functors in one pass, evaluating all of them at the same points.
+	 * @param functors hydra::tuple with the integrands.
+	 * @return std::array with one std::pair<GReal_t, GReal_t> (result, error) per integrand.
+	 */
+	template<typename ...FUNCTORS>
+	inline std::array<std::pair<GReal_t, GReal_t>, sizeof...(FUNCTORS)>
+	MultiIntegrate(hydra::thrust::tuple<FUNCTORS...> const& functors ){
+		return MultiIntegrate(detail::MultiIntegrand<FUNCTORS...>(functors));
+	}
+
+	/**
+	 * @brief Integrates each component of a functor returning std::array<GReal_t,K>, in one pass.
+	 * @param fFunctor functor returning the K integrands at a point.
+	 * @return std::array with one std::pair<GReal_t, GReal_t> (result, error) per integrand.
+	 */
+	template<typename FUNCTOR>
+	inline detail::multi_integral_t<FUNCTOR> MultiIntegrate(FUNCTOR const& fFunctor );
 
 	/**
 	 * @brief Get the absolute error of integration.
@@ -277,15 +335,75 @@ public:
 		fSeed = seed;
 	}
 
-	//PlainState *fState;
+	/**
+	 * @brief Adaptive mode: the number of calls, up to GetNCalls(), is decided by the error reached.
+	 */
+	inline bool IsAdaptive() const {
+		return fAdaptive;
+	}
+
+	inline void SetAdaptive(bool adaptive) {
+		fAdaptive = adaptive;
+	}
+
+	/**
+	 * @brief Number of calls per batch in adaptive mode.
+	 */
+	inline size_t GetBatchSize() const {
+		return fBatchSize;
+	}
+
+	inline void SetBatchSize(size_t batchSize) {
+		fBatchSize = batchSize;
+	}
+
+	/**
+	 * @brief Relative error target in adaptive mode.
+	 */
+	inline GReal_t GetRelativeError() const {
+		return fRelativeError;
+	}
+
+	inline void SetRelativeError(GReal_t relativeError) {
+		fRelativeError = relativeError;
+	}
+
+	/**
+	 * @brief Time budget in adaptive mode (ms). No batch is started after it is exhausted.
+	 */
+	inline GReal_t GetMaxTime() const {
+		return fMaxTime;
+	}
+
+	inline void SetMaxTime(GReal_t maxTime) {
+		fMaxTime = maxTime;
+	}
+
+	/**
+	 * @brief Summary of the batches of the last adaptive integration.
+	 */
+	inline const std::vector<PlainBatch>& GetBatches() const {
+		return fBatches;
+	}
 
 private:
 
+	template<typename FUNCTOR>
+	inline std::pair<GReal_t, GReal_t>  IntegrateFixed(FUNCTOR const& fFunctor );
+
+	template<typename FUNCTOR>
+	inline std::pair<GReal_t, GReal_t>  IntegrateAdaptive(FUNCTOR const& fFunctor );
+
 	size_t  fSeed;
 	size_t  fNCalls;
 	GReal_t fResult;
 	GReal_t fAbsError;
 	GReal_t fVolume;
+	bool    fAdaptive;
+	size_t  fBatchSize;
+	GReal_t fRelativeError;
+	GReal_t fMaxTime;
+	std::vector<PlainBatch> fBatches;
 	vector_t fDeltaX;
 	vector_t fXLow;
 
@@ -70,6 +70,20 @@ PlainState():
     fMax(other.fMax  )
        {}
 
+    __hydra_host__ __hydra_device__ inline
+   PlainState& operator=( PlainState const& other)
+   {
+	   if(this == &other) return *this;
+
+	   fN    = other.fN;
+	   fMean = other.fMean;
+	   fM2   = other.fM2;
+	   fMin  = other.fMin;
+	   fMax  = other.fMax;
+
+	   return *this;
+   }
+
 
 
     __hydra_host__ __hydra_device__ inline
@@ -80,6 +94,19 @@ PlainState():
 
 };
 
+/**
+ * \ingroup numerical_integration
+ * \brief Summary of a batch of calls of the Plain MC numerical integration in adaptive mode.
+ * The number of calls, result and error are accumulated over all batches up to this one.
+ */
+struct PlainBatch
+{
+	size_t  fNCalls;   ///< total number of calls
+	GReal_t fResult;   ///< integral estimated from all calls
+	GReal_t fAbsError; ///< error of the integral
+	GReal_t fTime;     ///< time spent in this batch (ms)
+};
+
 }
 
 
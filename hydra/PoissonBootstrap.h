@@ -0,0 +1,228 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * PoissonBootstrap.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef POISSONBOOTSTRAP_H_
+#define POISSONBOOTSTRAP_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Range.h>
+#include <hydra/detail/Iterable_traits.h>
+#include <hydra/detail/TypeTraits.h>
+#include <hydra/detail/PRNGTypedefs.h>
+#include <hydra/detail/functors/PoissonBootstrapWeight.h>
+#include <hydra/detail/external/hydra_thrust/functional.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/transform_iterator.h>
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+namespace hydra {
+
+/**
+ * \ingroup random
+ */
+template<typename Backend, typename GRND=hydra::default_random_engine>
+class PoissonBootstrap;
+
+/**
+ * \ingroup random
+ * \brief Multi-replica bootstrap with Poisson(1) event weights.
+ *
+ * Instead of resampling the dataset once per replica, each event `i` receives, in each replica `b`,
+ * an independent Poisson(1) weight w_{b,i}, which is the large-sample limit of the multinomial
+ * counts of the classical bootstrap. The weights are produced on the fly by a counter-based generator,
+ * from the position i*nreplicas + b of the sequence, so they are never stored and
+ * all replicas are processed in a single sequential pass over the data:
+ *
+ *  - PoissonBootstrap::Sum(...) : sum_i w_{b,i} f(x_i) for all replicas.
+ *  - PoissonBootstrap::Mean(...) : sum_i w_{b,i} f(x_i) / sum_i w_{b,i} for all replicas.
+ *  - PoissonBootstrap::Histogram(...) : one histogram per replica.
+ *
+ * Log-likelihoods of all replicas at fixed parameters are obtained from Sum(...), passing a functor returning
+ * the logarithm of the pdf. To refit a replica, PoissonBootstrap::GetReplicaWeights(...) provides its weights
+ * as a lazy range, that can be passed as event weights to hydra::make_loglikehood_fcn.
+ *
+ * The data is split in `npartitions` contiguous partitions, processed in parallel, each one
+ * accumulating its private copy of the replica statistics, which are added up at the end.
+ *
+ * \tparam Backend memory space to allocate the partial accumulators.
+ * \tparam GRND underlying counter-based random number generator.
+ */
+template<hydra::detail::Backend BACKEND, typename GRND>
+class PoissonBootstrap<hydra::detail::BackendPolicy<BACKEND>, GRND>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND>  system_type;
+
+public:
+
+	typedef detail::PoissonWeight<GRND> weight_type;
+	typedef hydra::thrust::transform_iterator<detail::ReplicaWeight<GRND>,
+			hydra::thrust::counting_iterator<size_t>, double> weight_iterator;
+
+	PoissonBootstrap()=delete;
+
+	/**
+	 * @brief PoissonBootstrap ctor.
+	 * @param nreplicas number of bootstrap replicas.
+	 * @param seed seed for the underlying pseudo-random number generator.
+	 * @param npartitions number of partitions the data is split in. Increase it for massively parallel devices.
+	 */
+	PoissonBootstrap(size_t nreplicas, size_t seed=0x4d595df4d0f33173, size_t npartitions=64):
+		fNReplicas(nreplicas),
+		fSeed(seed),
+		fNPartitions(npartitions)
+	{
+		if(nreplicas==0)
+			throw std::invalid_argument("[hydra::PoissonBootstrap]: Number of replicas is zero. (nreplicas==0)");
+
+		if(npartitions==0)
+			throw std::invalid_argument("[hydra::PoissonBootstrap]: Number of partitions is zero. (npartitions==0)");
+	}
+
+	/**
+	 * @brief Sums of f(x_i) weighted with the replica weights, for all replicas, in one pass.
+	 * @param begin iterator pointing to the begin of the data.
+	 * @param end iterator pointing to the end of the data.
+	 * @param functor function of the data elements.
+	 * @return vector with nreplicas sums.
+	 */
+	template<typename Iterator, typename Functor>
+	typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<double>>::type
+	Sum(Iterator begin, Iterator end, Functor const& functor) const;
+
+	template<typename Iterable, typename Functor>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, std::vector<double>>::type
+	Sum(Iterable&& data, Functor const& functor) const {
+		return Sum(std::forward<Iterable>(data).begin(), std::forward<Iterable>(data).end(), functor);
+	}
+
+	/**
+	 * @brief Weighted means of f(x_i), for all replicas, in one pass.
+	 * @return vector with nreplicas means.
+	 */
+	template<typename Iterator, typename Functor>
+	typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<double>>::type
+	Mean(Iterator begin, Iterator end, Functor const& functor) const;
+
+	template<typename Iterable, typename Functor>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, std::vector<double>>::type
+	Mean(Iterable&& data, Functor const& functor) const {
+		return Mean(std::forward<Iterable>(data).begin(), std::forward<Iterable>(data).end(), functor);
+	}
+
+	/**
+	 * @brief Histograms of f(x_i), for all replicas, in one pass.
+	 * Entries outside [min, max) are discarded.
+	 * @return vector with nreplicas histograms with nbins bins each.
+	 */
+	template<typename Iterator, typename Functor>
+	typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<std::vector<double>>>::type
+	Histogram(Iterator begin, Iterator end, size_t nbins, double min, double max, Functor const& functor) const;
+
+	template<typename Iterator>
+	inline typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<std::vector<double>>>::type
+	Histogram(Iterator begin, Iterator end, size_t nbins, double min, double max) const {
+		return Histogram(begin, end, nbins, min, max, hydra::thrust::identity<double>());
+	}
+
+	template<typename Iterable, typename Functor>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, std::vector<std::vector<double>>>::type
+	Histogram(Iterable&& data, size_t nbins, double min, double max, Functor const& functor) const {
+		return Histogram(std::forward<Iterable>(data).begin(), std::forward<Iterable>(data).end(),
+				nbins, min, max, functor);
+	}
+
+	template<typename Iterable>
+	inline typename std::enable_if<hydra::detail::is_iterable<Iterable>::value, std::vector<std::vector<double>>>::type
+	Histogram(Iterable&& data, size_t nbins, double min, double max) const {
+		return Histogram(std::forward<Iterable>(data).begin(), std::forward<Iterable>(data).end(),
+				nbins, min, max, hydra::thrust::identity<double>());
+	}
+
+	/**
+	 * @brief Lazy range with the weights of the replica `replica` for a dataset with `nentries` events.
+	 */
+	inline Range<weight_iterator> GetReplicaWeights(size_t replica, size_t nentries) const {
+
+		detail::ReplicaWeight<GRND> weight(GetWeightFunctor(), replica);
+
+		hydra::thrust::counting_iterator<size_t> first(0);
+
+		return make_range(weight_iterator(first, weight), weight_iterator(first + nentries, weight));
+	}
+
+	/**
+	 * @brief Functor returning the weight of the event `index` in the replica `replica`.
+	 */
+	inline weight_type GetWeightFunctor() const {
+		return weight_type(fSeed, fNReplicas);
+	}
+
+	inline size_t GetNReplicas() const {
+		return fNReplicas;
+	}
+
+	inline void SetNReplicas(size_t nreplicas) {
+		fNReplicas = nreplicas;
+	}
+
+	inline size_t GetSeed() const {
+		return fSeed;
+	}
+
+	inline void SetSeed(size_t seed) {
+		fSeed = seed;
+	}
+
+	inline size_t GetNPartitions() const {
+		return fNPartitions;
+	}
+
+	inline void SetNPartitions(size_t npartitions) {
+		fNPartitions = npartitions;
+	}
+
+private:
+
+	template<typename Iterator, typename Functor>
+	std::vector<double> Accumulate(Iterator begin, Iterator end, Functor const& functor) const;
+
+	size_t fNReplicas;
+	size_t fSeed;
+	size_t fNPartitions;
+};
+
+}  // namespace hydra
+
+#include <hydra/detail/PoissonBootstrap.inl>
+
+#endif /* POISSONBOOTSTRAP_H_ */
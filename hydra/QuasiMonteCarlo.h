@@ -0,0 +1,370 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * QuasiMonteCarlo.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+#ifndef QUASIMONTECARLO_H_
+#define QUASIMONTECARLO_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Sobol.h>
+#include <hydra/Integrator.h>
+#include <hydra/detail/PRNGTypedefs.h>
+#include <hydra/detail/functors/ProcessCallsQuasiMonteCarlo.h>
+#include <hydra/detail/functors/MultiIntegrand.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+namespace hydra {
+
+template<size_t N, typename BACKEND, typename GRND=hydra::default_random_engine>
+class QuasiMonteCarlo;
+
+/**
+ * \ingroup numerical_integration
+ *
+ * \brief Randomized quasi-Monte Carlo integration, with scrambled Sobol points.
+ *
+ * The integrand is sampled at the first \f$n\f$ points of the Sobol sequence, in \f$R\f$ independent
+ * randomizations of the sequence, with \f$n R\f$ equal to the number of calls. Each randomization \f$r\f$ gives
+ * an unbiased estimate \f$I_r = (V/n) \sum_i f(x_{r,i})\f$, and the result and its error are
+ * the mean of the \f$I_r\f$ and its standard error,
+ * \f[ E(f) = \frac{1}{R}\sum_r I_r, \qquad \sigma^2(E) = \frac{1}{R(R-1)}\sum_r (I_r - E(f))^2 .\f]
+ * For smooth integrands the error decreases roughly as \f$1/n\f$, instead of the \f$1/\sqrt{n}\f$ of hydra::Plain.
+ * The best results are obtained with powers of two for \f$n\f$.
+ *
+ * The randomization is the nested uniform (Owen) scrambling, implemented with hashes, or optionally
+ * a random digital shift. The points are split in chunks evaluated in parallel, each one starting from
+ * the point computed from its index, with O(1) skip-ahead.
+ *
+ * \tparam N number of dimensions (up to 3667).
+ * \tparam BACKEND parallel back end.
+ * \tparam GRND pseudo-random number generator used to draw the randomization seeds.
+ */
+template<size_t N, hydra::detail::Backend BACKEND, typename GRND>
+class QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND>, GRND>:
+public Integral<QuasiMonteCarlo<N,hydra::detail::BackendPolicy<BACKEND>,GRND>>
+{
+	typedef hydra::detail::BackendPolicy<BACKEND> system_t;
+	typedef typename system_t::template container<GReal_t>  vector_t;
+	typedef typename system_t::template container<uint32_t> uint_vector_t;
+
+public:
+
+	QuasiMonteCarlo()=delete;
+
+	/**
+	 * @brief Constructor for the quasi-Monte Carlo numerical integration algorithm.
+	 * @param LowLim std::array<GReal_t,N> with the lower limits of the integration region.
+	 * @param UpLim std::array<GReal_t,N>  with the upper limits of the integration region.
+	 * @param calls total number of calls, split among the randomizations.
+	 * @param seed seed for the randomizations.
+	 * @param nrandomizations number of independent randomizations, used to estimate the error.
+	 */
+	QuasiMonteCarlo( std::array<GReal_t,N> const& LowLim, std::array<GReal_t,N> const& UpLim,
+			size_t calls, size_t seed=159753456852, size_t nrandomizations=16):
+				fSeed(seed),
+				fNCalls(calls),
+				fNRandomizations(nrandomizations),
+				fOwenScrambling(true),
+				fChunkSize(64),
+				fResult(0),
+				fAbsError(0),
+				fVolume(1.0)
+	{
+		std::vector<GReal_t> deltaX(N), xLow(N);
+
+		for(size_t i=0; i<N; i++)
+		{
+			deltaX[i] = UpLim[i] - LowLim[i];
+			xLow[i]   = LowLim[i];
+			fVolume  *= deltaX[i];
+		}
+
+		fDeltaX = deltaX;
+		fXLow   = xLow;
+
+		Initialize();
+	}
+
+	/**
+	 * @brief Constructor for the quasi-Monte Carlo numerical integration algorithm.
+	 * @param LowLim c-array with the lower limits of the integration region.
+	 * @param UpLim c-array with the upper limits of the integration region.
+	 * @param calls total number of calls, split among the randomizations.
+	 * @param seed seed for the randomizations.
+	 * @param nrandomizations number of independent randomizations, used to estimate the error.
+	 */
+	QuasiMonteCarlo( const double LowLim[N] , const double  UpLim[N],
+			size_t calls, size_t seed=159753456852, size_t nrandomizations=16):
+				fSeed(seed),
+				fNCalls(calls),
+				fNRandomizations(nrandomizations),
+				fOwenScrambling(true),
+				fChunkSize(64),
+				fResult(0),
+				fAbsError(0),
+				fVolume(1.0)
+	{
+		std::vector<GReal_t> deltaX(N), xLow(N);
+
+		for(size_t i=0; i<N; i++)
+		{
+			deltaX[i] = UpLim[i] - LowLim[i];
+			xLow[i]   = LowLim[i];
+			fVolume  *= deltaX[i];
+		}
+
+		fDeltaX = deltaX;
+		fXLow   = xLow;
+
+		Initialize();
+	}
+
+	QuasiMonteCarlo( QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND>, GRND> const& other):
+		fSeed(other.GetSeed() ),
+		fNCalls(other.GetNCalls()),
+		fNRandomizations(other.GetNRandomizations()),
+		fOwenScrambling(other.IsOwenScrambling()),
+		fChunkSize(other.GetChunkSize()),
+		fResult(other.GetResult()),
+		fAbsError(other.GetAbsError() ),
+		fVolume(other.GetVolume()),
+		fDeltaX(other.GetDeltaX()),
+		fXLow(other.GetXLow()),
+		fDirections(other.GetDirections())
+	{ }
+
+	template<hydra::detail::Backend BACKEND2>
+	QuasiMonteCarlo( QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND2>, GRND> const& other):
+		fSeed(other.GetSeed() ),
+		fNCalls(other.GetNCalls()),
+		fNRandomizations(other.GetNRandomizations()),
+		fOwenScrambling(other.IsOwenScrambling()),
+		fChunkSize(other.GetChunkSize()),
+		fResult(other.GetResult()),
+		fAbsError(other.GetAbsError() ),
+		fVolume(other.GetVolume()),
+		fDeltaX(other.GetDeltaX()),
+		fXLow(other.GetXLow()),
+		fDirections(other.GetDirections())
+	{ }
+
+	QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND>, GRND>&
+	operator=( QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND>, GRND> const& other)
+	{
+		if( this==&other) return *this;
+
+		this->fSeed            = other.GetSeed() ;
+		this->fNCalls          = other.GetNCalls();
+		this->fNRandomizations = other.GetNRandomizations();
+		this->fOwenScrambling  = other.IsOwenScrambling();
+		this->fChunkSize       = other.GetChunkSize();
+		this->fResult          = other.GetResult();
+		this->fAbsError        = other.GetAbsError() ;
+		this->fVolume          = other.GetVolume();
+		this->fDeltaX          = other.GetDeltaX();
+		this->fXLow            = other.GetXLow();
+		this->fDirections      = other.GetDirections();
+
+		return *this;
+	}
+
+	template<hydra::detail::Backend BACKEND2>
+	QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND>, GRND>&
+	operator=( QuasiMonteCarlo<N, hydra::detail::BackendPolicy<BACKEND2>, GRND> const& other)
+	{
+		this->fSeed            = other.GetSeed() ;
+		this->fNCalls          = other.GetNCalls();
+		this->fNRandomizations = other.GetNRandomizations();
+		this->fOwenScrambling  = other.IsOwenScrambling();
+		this->fChunkSize       = other.GetChunkSize();
+		this->fResult          = other.GetResult();
+		this->fAbsError        = other.GetAbsError() ;
+		this->fVolume          = other.GetVolume();
+		this->fDeltaX          = other.GetDeltaX();
+		this->fXLow            = other.GetXLow();
+		this->fDirections      = other.GetDirections();
+
+		return *this;
+	}
+
+	/**
+	 * @brief This method performs the actual integration.
+	 * @param fFunctor functor (integrand).
+	 * @return std::pair<GReal_t, GReal_t> with the integration result and error.
+	 */
+	template<typename FUNCTOR>
+	inline std::pair<GReal_t, GReal_t>  Integrate(FUNCTOR const& fFunctor );
+
+	/**
+	 * @brief Integrates several functors in one pass, evaluating all of them at the same points.
+	 * @param functors hydra::tuple with the integrands.
+	 * @return std::array with one std::pair<GReal_t, GReal_t> (result, error) per integrand.
+	 */
+	template<typename ...FUNCTORS>
+	inline std::array<std::pair<GReal_t, GReal_t>, sizeof...(FUNCTORS)>
+	MultiIntegrate(hydra::thrust::tuple<FUNCTORS...> const& functors ){
+		return MultiIntegrate(detail::MultiIntegrand<FUNCTORS...>(functors));
+	}
+
+	/**
+	 * @brief Integrates each component of a functor returning std::array<GReal_t,K>, in one pass.
+	 * @param fFunctor functor returning the K integrands at a point.
+	 * @return std::array with one std::pair<GReal_t, GReal_t> (result, error) per integrand.
+	 */
+	template<typename FUNCTOR>
+	inline detail::multi_integral_t<FUNCTOR> MultiIntegrate(FUNCTOR const& fFunctor );
+
+	/**
+	 * @brief Get the absolute error of integration.
+	 * @return error of integration.
+	 */
+	inline GReal_t GetSigma() const {
+		return fAbsError;
+	}
+
+	inline GReal_t GetAbsError() const {
+		return fAbsError;
+	}
+
+	inline void SetAbsError(GReal_t absError) {
+		fAbsError = absError;
+	}
+
+	inline const vector_t& GetDeltaX() const {
+		return fDeltaX;
+	}
+
+	inline const vector_t& GetXLow() const {
+		return fXLow;
+	}
+
+	/**
+	 * @brief Sobol direction numbers, stored as [bit*N + dimension].
+	 */
+	inline const uint_vector_t& GetDirections() const {
+		return fDirections;
+	}
+
+	inline size_t GetNCalls() const {
+		return fNCalls;
+	}
+
+	inline void SetNCalls(size_t nCalls) {
+		fNCalls = nCalls;
+	}
+
+	inline size_t GetNRandomizations() const {
+		return fNRandomizations;
+	}
+
+	inline void SetNRandomizations(size_t nRandomizations) {
+		fNRandomizations = nRandomizations;
+	}
+
+	/**
+	 * @brief Owen scrambling if true, random digital shift otherwise.
+	 */
+	inline bool IsOwenScrambling() const {
+		return fOwenScrambling;
+	}
+
+	inline void SetOwenScrambling(bool owenScrambling) {
+		fOwenScrambling = owenScrambling;
+	}
+
+	/**
+	 * @brief Number of consecutive points processed by each thread. Consecutive points
+	 * are obtained with one XOR per dimension.
+	 */
+	inline size_t GetChunkSize() const {
+		return fChunkSize;
+	}
+
+	inline void SetChunkSize(size_t chunkSize) {
+		fChunkSize = chunkSize;
+	}
+
+	inline GReal_t GetResult() const {
+		return fResult;
+	}
+
+	inline void SetResult(GReal_t result) {
+		fResult = result;
+	}
+
+	inline GReal_t GetVolume() const {
+		return fVolume;
+	}
+
+	inline size_t GetSeed() const {
+		return fSeed;
+	}
+
+	inline void SetSeed(const size_t& seed) {
+		fSeed = seed;
+	}
+
+private:
+
+	void Initialize();
+
+	size_t GenerateSeeds(uint_vector_t& seeds) const;
+
+	std::pair<GReal_t, GReal_t> Combine(std::vector<GReal_t> const& estimates) const;
+
+	size_t  fSeed;
+	size_t  fNCalls;
+	size_t  fNRandomizations;
+	bool    fOwenScrambling;
+	size_t  fChunkSize;
+	GReal_t fResult;
+	GReal_t fAbsError;
+	GReal_t fVolume;
+	vector_t fDeltaX;
+	vector_t fXLow;
+	uint_vector_t fDirections;
+
+};
+
+}  // namespace hydra
+
+#include <hydra/detail/QuasiMonteCarlo.inl>
+
+#endif /* QUASIMONTECARLO_H_ */
@@ -45,6 +45,7 @@
 #include <hydra/detail/PRNGTypedefs.h>
 
 #include <hydra/Range.h>
+#include <hydra/VegasState.h>
 
 //
 #include <hydra/detail/external/hydra_thrust/copy.h>
@@ -538,6 +539,104 @@ sample( Iterable&& output ,
 		typename Functor::argument_type const& min,typename Functor::argument_type  const& max,
 		Functor const& functor, size_t seed=0xb56c4feeef1b, size_t rng_jump=0 );
 
+/**
+ * \ingroup random
+ *
+ * @brief Fill a range with numbers distributed according a user defined distribution, using the adapted grid
+ * of a hydra::VegasState as importance-sampling proposal for the accept-reject method.
+ * The trials are drawn from the piecewise constant density defined by the grid and accepted with probability
+ * proportional to the ratio between the functor and that density. For a grid trained on the same functor,
+ * the acceptance is much larger than for trials drawn uniformly in the integration region.
+ * @param policy backend to perform the calculation.
+ * @param begin beginning of the range storing the generated values
+ * @param end ending of the range storing the generated values
+ * @param grid Vegas state holding the grid and the limits of the sampling region.
+ * @param functor distribution to be sampled
+ * @param rng_seed seed for the underlying pseudo-random number generator
+ * @param rng_jump sequence offset for the underlying pseudo-random number generator
+ * @return range with the generated values
+ */
+template<typename RNG=default_random_engine, typename DerivedPolicy, typename Functor, typename Iterator, size_t N,
+hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterator<Iterator>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterator>())>::value,
+Range<Iterator> >::type
+sample(hydra::thrust::detail::execution_policy_base<DerivedPolicy>  const& policy,
+		Iterator begin, Iterator end, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed=0xb56c4feeef1b, size_t rng_jump=0 );
+
+/**
+ * \ingroup random
+ *
+ * @brief Fill a range with numbers distributed according a user defined distribution, using the adapted grid
+ * of a hydra::VegasState as importance-sampling proposal for the accept-reject method.
+ * @param policy backend to perform the calculation.
+ * @param begin beginning of the range storing the generated values
+ * @param end ending of the range storing the generated values
+ * @param grid Vegas state holding the grid and the limits of the sampling region.
+ * @param functor distribution to be sampled
+ * @param rng_seed seed for the underlying pseudo-random number generator
+ * @param rng_jump sequence offset for the underlying pseudo-random number generator
+ * @return range with the generated values
+ */
+template<typename RNG=default_random_engine, typename Functor, typename Iterator, hydra::detail::Backend BACKEND,
+size_t N, hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterator<Iterator>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterator>())>::value,
+Range<Iterator> >::type
+sample(hydra::detail::BackendPolicy<BACKEND> const& policy,
+		Iterator begin, Iterator end, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed=0xb56c4feeef1b, size_t rng_jump=0 );
+
+/**
+ * \ingroup random
+ *
+ * @brief Fill a range with numbers distributed according a user defined distribution, using the adapted grid
+ * of a hydra::VegasState as importance-sampling proposal for the accept-reject method.
+ * @param begin beginning of the range storing the generated values
+ * @param end ending of the range storing the generated values
+ * @param grid Vegas state holding the grid and the limits of the sampling region.
+ * @param functor distribution to be sampled
+ * @param rng_seed seed for the underlying pseudo-random number generator
+ * @param rng_jump sequence offset for the underlying pseudo-random number generator
+ * @return range with the generated values
+ */
+template<typename RNG=default_random_engine, typename Functor, typename Iterator, size_t N,
+hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterator<Iterator>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterator>())>::value,
+Range<Iterator> >::type
+sample(Iterator begin, Iterator end, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed=0xb56c4feeef1b, size_t rng_jump=0 );
+
+/**
+ * \ingroup random
+ *
+ * @brief Fill a range with numbers distributed according a user defined distribution, using the adapted grid
+ * of a hydra::VegasState as importance-sampling proposal for the accept-reject method.
+ * @param output range storing the generated values
+ * @param grid Vegas state holding the grid and the limits of the sampling region.
+ * @param functor distribution to be sampled
+ * @param rng_seed seed for the underlying pseudo-random number generator
+ * @param rng_jump sequence offset for the underlying pseudo-random number generator
+ * @return output range with the generated values
+ */
+template<typename RNG=default_random_engine, typename Functor, typename Iterable, size_t N,
+hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterable<Iterable>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterable>().begin())>::value ,
+Range< decltype(std::declval<Iterable>().begin())>>::type
+sample( Iterable&& output, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed=0xb56c4feeef1b, size_t rng_jump=0 );
+
 /**
  * \ingroup random
  *
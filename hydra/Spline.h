@@ -210,10 +210,85 @@ inline typename std::enable_if<
                        double >::type
 spline3D(IterableX&& abscissa_x,  IterableY&& abscissa_y, IterableW&& abscissa_w, IterableZ&& abscissa_z, IterableM measurements, TypeX x, TypeX y, TypeW w, TypeZ z );
 
+/**
+ * @fn IteratorR spline(Iterator1, Iterator1, Iterator2, IteratorP, IteratorP, IteratorR, bool)
+ * @brief Cubic monotone spline interpolation over a range of points
+ *
+ * The coefficients of the spline are calculated once and the points are located incrementally, see hydra::SplineTableFunctor.
+ * Sorted points are located in constant time, and unsorted ones too if sort is true, at the cost of a sort by key.
+ * The points are processed in their memory space.
+ *
+ * @param first iterator pointing to the first element of the abcissae range
+ * @param last  iterator pointing to the last element of the abcissae range
+ * @param measurements iterator pointing to the first element of the data range with at least (last - first) elements
+ * @param begin iterator pointing to the first point where to calculate the interpolation
+ * @param end iterator pointing to the end of the points
+ * @param result iterator pointing to the first element of the output range
+ * @param sort visit the points in increasing order
+ * @return end of the output range
+ */
+template<typename Iterator1, typename Iterator2, typename IteratorP, typename IteratorR>
+inline typename  std::enable_if<
+                    std::is_convertible<typename hydra::thrust::iterator_traits<Iterator1>::value_type, double >::value &&
+                    std::is_convertible<typename hydra::thrust::iterator_traits<Iterator2>::value_type, double >::value &&
+                    std::is_convertible<typename hydra::thrust::iterator_traits<IteratorP>::value_type, double >::value,
+                    IteratorR >::type
+spline(Iterator1 first, Iterator1 last,  Iterator2 measurements, IteratorP begin, IteratorP end, IteratorR result, bool sort=false);
+
+/**
+ * @fn IteratorR spline2D(IteratorX, IteratorX, IteratorY, IteratorY, IteratorM, IteratorP, IteratorP, IteratorR, bool)
+ * @brief Two-dimensional cubic monotone spline interpolation over a range of points, tuples (x, y).
+ * See spline(Iterator1, Iterator1, Iterator2, IteratorP, IteratorP, IteratorR, bool).
+ */
+template<typename IteratorX, typename IteratorY, typename IteratorM, typename IteratorP, typename IteratorR>
+inline typename std::enable_if<
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorX>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorY>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorM>::value_type, double >::value &&
+	detail::is_tuple_type<typename hydra::thrust::iterator_traits<IteratorP>::value_type>::value,
+	IteratorR>::type
+spline2D(IteratorX firstx, IteratorX lastx, IteratorY firsty, IteratorY lasty, IteratorM measurements,
+		IteratorP begin, IteratorP end, IteratorR result, bool sort=false);
+
+/**
+ * @fn IteratorR spline3D(IteratorX, IteratorX, IteratorY, IteratorY, IteratorZ, IteratorZ, IteratorM, IteratorP, IteratorP, IteratorR, bool)
+ * @brief Three-dimensional cubic monotone spline interpolation over a range of points, tuples (x, y, z).
+ * See spline(Iterator1, Iterator1, Iterator2, IteratorP, IteratorP, IteratorR, bool).
+ */
+template<typename IteratorX, typename IteratorY, typename IteratorZ, typename IteratorM, typename IteratorP, typename IteratorR>
+inline typename std::enable_if<
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorX>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorY>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorZ>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorM>::value_type, double >::value &&
+	detail::is_tuple_type<typename hydra::thrust::iterator_traits<IteratorP>::value_type>::value,
+	IteratorR>::type
+spline3D(IteratorX firstx, IteratorX lastx, IteratorY firsty, IteratorY lasty, IteratorZ firstz, IteratorZ lastz,
+		IteratorM measurements, IteratorP begin, IteratorP end, IteratorR result, bool sort=false);
+
+/**
+ * @fn IteratorR spline4D(IteratorX, IteratorX, IteratorY, IteratorY, IteratorW, IteratorW, IteratorZ, IteratorZ, IteratorM, IteratorP, IteratorP, IteratorR, bool)
+ * @brief Four-dimensional cubic monotone spline interpolation over a range of points, tuples (x, y, w, z).
+ * See spline(Iterator1, Iterator1, Iterator2, IteratorP, IteratorP, IteratorR, bool).
+ */
+template<typename IteratorX, typename IteratorY, typename IteratorW, typename IteratorZ, typename IteratorM,
+          typename IteratorP, typename IteratorR>
+inline typename std::enable_if<
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorX>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorY>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorW>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorZ>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorM>::value_type, double >::value &&
+	detail::is_tuple_type<typename hydra::thrust::iterator_traits<IteratorP>::value_type>::value,
+	IteratorR>::type
+spline4D(IteratorX firstx, IteratorX lastx, IteratorY firsty, IteratorY lasty, IteratorW firstw, IteratorW lastw,
+		IteratorZ firstz, IteratorZ lastz, IteratorM measurements, IteratorP begin, IteratorP end, IteratorR result, bool sort=false);
+
 } // namespace hydra
 
 #include <hydra/detail/Spline.inl>
 #include <hydra/detail/Spline2D.inl>
 #include <hydra/detail/Spline3D.inl>
 #include <hydra/detail/Spline4D.inl>
+#include <hydra/detail/SplineBatch.inl>
 #endif /* SPILINE_H_ */
@@ -194,10 +194,6 @@ private:
 	}
 
 	VegasState<N,hydra::detail::BackendPolicy<BACKEND>> fState;
-	rvector_backend fFValInput;
-	uvector_backend fGlobalBinInput;
-	rvector_backend fFValOutput;
-	uvector_backend fGlobalBinOutput;
 };
 
 }
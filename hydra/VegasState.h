@@ -39,6 +39,11 @@
 #include <hydra/Types.h>
 
 #include <vector>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cmath>
 #include <hydra/detail/external/hydra_thrust/copy.h>
 #include <chrono>
 
@@ -136,6 +141,29 @@ public:
      */
 	void ClearStoredIterations();
 
+	/**
+	 * @brief Write the adapted grid to a binary stream.
+	 * Only the grid and the integration limits are stored.
+	 */
+	void SaveGrid(std::ostream& stream) const;
+
+	/**
+	 * @brief Write the adapted grid to the binary file `filename`.
+	 */
+	void SaveGrid(std::string const& filename) const;
+
+	/**
+	 * @brief Read a grid written by SaveGrid(...) from a binary stream.
+	 * The number of dimensions and the integration limits need to match the ones of this state.
+	 * The state is marked as trained, so that it can be used for warm starts (see SetWarmStart).
+	 */
+	void LoadGrid(std::istream& stream);
+
+	/**
+	 * @brief Read a grid written by SaveGrid(...) from the binary file `filename`.
+	 */
+	void LoadGrid(std::string const& filename);
+
 
 	inline GReal_t GetAlpha() const { return fAlpha; }
 
@@ -493,6 +521,21 @@ public:
 		fTrainingCalls = trainingCalls;
 	}
 
+	/**
+	 * Number of partitions the calls of each iteration are split in, 0 for the automatic choice (default).
+	 * Each partition accumulates a private copy of the grid distribution,
+	 * so the scratch memory is N*bins*partitions, independently of the number of calls.
+	 * The automatic choice keeps about 64 calls per partition on CUDA and 8192 on the host back ends,
+	 * within a scratch memory of 2^23 entries.
+	 */
+	size_t GetNPartitions() const {
+		return fNPartitions;
+	}
+
+	void SetNPartitions(size_t nPartitions) {
+		fNPartitions = nPartitions;
+	}
+
 	GUInt_t GetTrainingIterations() const {
 		return fTrainingIterations;
 	}
@@ -509,6 +552,27 @@ public:
 		fFunctionCallsDuration = functionCallsDuration;
 	}
 
+	/**
+	 * If warm start is enabled and the state holds a trained grid (either loaded with LoadGrid(...) or
+	 * adapted by a previous integration), Vegas::Integrate skips the grid initialization
+	 * and the training iterations, and starts from the available grid.
+	 */
+	GBool_t IsWarmStart() const {
+		return fWarmStart;
+	}
+
+	void SetWarmStart(GBool_t warmStart) {
+		fWarmStart = warmStart;
+	}
+
+	GBool_t IsGridTrained() const {
+		return fGridTrained;
+	}
+
+	void SetGridTrained(GBool_t gridTrained) {
+		fGridTrained = gridTrained;
+	}
+
 	GBool_t IsTrainedGridFrozen() const {
 		return fTrainedGridFrozen;
 	}
@@ -584,6 +648,9 @@ private:
 	size_t  fCallsPerBox; ///< number of call per box
 	size_t  fCalls;
 	size_t  fTrainingCalls;
+	size_t  fNPartitions; ///< number of partitions with private grid distributions, 0 for automatic
+	GBool_t fWarmStart; ///< reuse the available grid, skipping the training
+	GBool_t fGridTrained; ///< the grid was adapted or loaded
 	GReal_t fMaxError; ///< max error
 	GBool_t fUseRelativeError; ///< use relative error as convergence criteria
 
@@ -0,0 +1,178 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * AliasTable.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef ALIASTABLE_INL_
+#define ALIASTABLE_INL_
+
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/reduce.h>
+#include <hydra/detail/external/hydra_thrust/extrema.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+#include <hydra/detail/external/hydra_thrust/system/detail/generic/select_system.h>
+
+#include <vector>
+#include <stdexcept>
+
+namespace hydra {
+
+template<size_t N, hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator>
+void AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>::Build(Iterator wbegin)
+{
+	if(fNBins==0)
+		throw std::invalid_argument("[hydra::AliasTable]: Empty set of weights. (fNBins==0)");
+
+	//stage the weights in the memory space of the table and check them there
+	probability_storage_t weights(fNBins);
+	hydra::thrust::copy(wbegin, wbegin + fNBins, weights.begin());
+
+	double min_weight = *hydra::thrust::min_element(fSystem, weights.begin(), weights.end());
+
+	if(min_weight < 0.0)
+		throw std::invalid_argument("[hydra::AliasTable]: Negative weight. (weight < 0)");
+
+	fNorm = hydra::thrust::reduce(fSystem, weights.begin(), weights.end(), 0.0);
+
+	if(!(fNorm > 0.0))
+		throw std::invalid_argument("[hydra::AliasTable]: Weights sum up to zero. (fNorm <= 0)");
+
+	//Vose's method: O(fNBins) pairing of under-full and over-full columns
+	std::vector<double> probabilities(fNBins);
+	std::vector<size_t> aliases(fNBins);
+
+	hydra::thrust::copy(weights.begin(), weights.end(), probabilities.begin());
+
+	std::vector<size_t> small;
+	std::vector<size_t> large;
+	small.reserve(fNBins);
+	large.reserve(fNBins);
+
+	double scale = double(fNBins)/fNorm;
+
+	for(size_t i=0; i<fNBins; i++){
+
+		probabilities[i] *= scale;
+		aliases[i] = i;
+
+		if(probabilities[i] < 1.0) small.push_back(i);
+		else large.push_back(i);
+	}
+
+	while( !small.empty() && !large.empty() ){
+
+		size_t s = small.back(); small.pop_back();
+		size_t l = large.back(); large.pop_back();
+
+		aliases[s] = l;
+		probabilities[l] = (probabilities[l] + probabilities[s]) - 1.0;
+
+		if(probabilities[l] < 1.0) small.push_back(l);
+		else large.push_back(l);
+	}
+
+	//leftovers are full columns up to rounding
+	for(size_t i: large) probabilities[i] = 1.0;
+	for(size_t i: small) probabilities[i] = 1.0;
+
+	fProbabilities = probability_storage_t(probabilities.begin(), probabilities.end());
+	fAliases = alias_storage_t(aliases.begin(), aliases.end());
+}
+
+template<size_t N, hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator>
+inline Range<Iterator>
+AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>::SampleIndexes(Iterator begin, Iterator end,
+		size_t seed, size_t rng_jump) const
+{
+	using hydra::thrust::system::detail::generic::select_system;
+	typedef  typename hydra::thrust::iterator_system<Iterator>::type system1_t;
+	system1_t system1;
+
+	typedef  typename hydra::thrust::detail::remove_reference<
+			decltype(select_system(std::declval<system_t&>(), system1 ))>::type common_system_t;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + hydra::thrust::distance(begin, end);
+
+	hydra::thrust::transform(common_system_t(), first, last, begin, GetIndexSampler(seed, rng_jump));
+
+	return make_range(begin, end);
+}
+
+template<size_t N, hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator>
+inline Range<Iterator>
+AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>::Sample(Iterator begin, Iterator end,
+		size_t seed, size_t rng_jump) const
+{
+	using hydra::thrust::system::detail::generic::select_system;
+	typedef  typename hydra::thrust::iterator_system<Iterator>::type system1_t;
+	system1_t system1;
+
+	typedef  typename hydra::thrust::detail::remove_reference<
+			decltype(select_system(std::declval<system_t&>(), system1 ))>::type common_system_t;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + hydra::thrust::distance(begin, end);
+
+	hydra::thrust::transform(common_system_t(), first, last, begin, GetPointSampler(seed, rng_jump));
+
+	return make_range(begin, end);
+}
+
+template<typename GRND, typename Iterator, hydra::detail::Backend BACKEND>
+AliasTable<1, hydra::detail::BackendPolicy<BACKEND>, GRND>
+make_alias_table( hydra::detail::BackendPolicy<BACKEND> const&, Iterator wbegin, Iterator wend)
+{
+	return AliasTable<1, hydra::detail::BackendPolicy<BACKEND>, GRND>(wbegin, wend);
+}
+
+template<typename GRND, typename Iterable, hydra::detail::Backend BACKEND>
+inline typename std::enable_if< hydra::detail::is_iterable<Iterable>::value &&
+!hydra::detail::is_hydra_dense_histogram<typename std::decay<Iterable>::type>::value,
+AliasTable<1, hydra::detail::BackendPolicy<BACKEND>, GRND>>::type
+make_alias_table( hydra::detail::BackendPolicy<BACKEND> const& backend, Iterable&& weights)
+{
+	return make_alias_table<GRND>(backend, std::forward<Iterable>(weights).begin(),
+			std::forward<Iterable>(weights).end());
+}
+
+template<typename GRND, typename T, size_t N, typename D,
+hydra::detail::Backend BACKEND, hydra::detail::Backend BACKEND2>
+AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>
+make_alias_table( hydra::detail::BackendPolicy<BACKEND> const&,
+		DenseHistogram<T, N, hydra::detail::BackendPolicy<BACKEND2>, D> const& histogram)
+{
+	return AliasTable<N, hydra::detail::BackendPolicy<BACKEND>, GRND>(histogram);
+}
+
+}  // namespace hydra
+
+#endif /* ALIASTABLE_INL_ */
@@ -75,7 +75,7 @@ public:
 	{
 		if(this == &other) return *this;
 
-		IntegrationFormula<Functor,1>::operator=(other);
+		IntegrationFormula<Functor,N>::operator=(other);
 
 		for(size_t i =0; i<N; i++ ){
 
@@ -88,21 +88,18 @@ public:
 
 	inline std::pair<GReal_t, GReal_t> operator()(Functor const& functor) const
 	{
-			return  static_cast<const IntegrationFormula<Functor,N>& >(*this).EvalFormula(functor,
-					fLowerLimit, fUpperLimit );
+			return  this->EvalFormula(functor, fLowerLimit, fUpperLimit );
 	}
 
 	inline std::pair<GReal_t, GReal_t> Integrate(Functor const& functor) const
 	{
-		return  static_cast<const IntegrationFormula<Functor,N>& >(*this).EvalFormula(functor,
-				fLowerLimit, fUpperLimit );
+		return  this->EvalFormula(functor, fLowerLimit, fUpperLimit );
 	}
 
 	inline std::pair<GReal_t, GReal_t> Integrate(Functor const& functor,
 			double (&LowerLimit)[N], double (&UpperLimit)[N] ) const
 	{
-			return  static_cast<const IntegrationFormula<Functor,N>& >(*this).EvalFormula(functor,
-					LowerLimit, UpperLimit );
+			return  this->EvalFormula(functor, LowerLimit, UpperLimit );
 	}
 
 	double GetLowerLimit(size_t i) const {
@@ -0,0 +1,130 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * BatchFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef BATCHFFT_H_
+#define BATCHFFT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/FFTPolicy.h>
+#include <hydra/detail/native_fft/BaseNativeFFT.h>
+#include <hydra/detail/native_fft/NativeFFTPlan.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+
+#include <cstddef>
+
+namespace hydra {
+
+namespace detail {
+
+namespace convolution {
+
+/*
+ * Unnormalized complex transforms, of size n and sign `sign`, of batches of sequences stored contiguously,
+ * n points apart, in the memory of FFTPolicy<T, FFT>::device_backend_type.
+ * FFTW and cuFFT run the batch through one batched plan, see hydra/detail/fftw/BatchFFTW.h and
+ * hydra/detail/cufft/BatchCuFFT.h. Other libraries run the batch through one cached plan,
+ * copying each sequence in and out of its buffers.
+ */
+template<typename T, detail::FFTCalculator FFT>
+class BatchFFT
+{
+	typedef hydra::complex<T> complex_type;
+	typedef typename detail::FFTPolicy<T, FFT>::C2C fft_type;
+
+public:
+
+	BatchFFT(size_t n, int sign):
+		fN(n),
+		fFFT(n, sign)
+	{}
+
+	template<typename Policy>
+	inline void Execute(Policy policy, const complex_type* input, complex_type* output, size_t batch)
+	{
+		complex_type* fft_input  = fFFT.GetInputData().first.get();
+		complex_type* fft_output = fFFT.GetOutputData().first.get();
+
+		for(size_t b=0; b<batch; b++)
+		{
+			hydra::thrust::copy(policy, input + b*fN, input + (b+1)*fN, fft_input);
+
+			fFFT.Execute();
+
+			hydra::thrust::copy(policy, fft_output, fft_output + fN, output + b*fN);
+		}
+	}
+
+	inline size_t GetSize() const {
+		return fN;
+	}
+
+private:
+
+	size_t   fN;
+	fft_type fFFT;
+};
+
+/*
+ * The native plans process the whole batch in the same passes.
+ */
+template<typename T>
+class BatchFFT<T, detail::Native>
+{
+	typedef hydra::complex<T> complex_type;
+
+public:
+
+	BatchFFT(size_t n, int sign):
+		fPlan(n, sign)
+	{}
+
+	template<typename Policy>
+	inline void Execute(Policy, const complex_type* input, complex_type* output, size_t batch)
+	{
+		fPlan.Execute(input, output, batch);
+	}
+
+	inline size_t GetSize() const {
+		return fPlan.GetSize();
+	}
+
+private:
+
+	native_fft::Plan<T, native_fft::default_backend_type> fPlan;
+};
+
+}  // namespace convolution
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* BATCHFFT_H_ */
@@ -38,6 +38,7 @@
 #include <hydra/Algorithm.h>
 #include <hydra/Zip.h>
 #include <hydra/Complex.h>
+#include <array>
 #include <functional>
 #include <utility>
 #include <type_traits>
@@ -311,7 +312,409 @@ private:
 	T fNorm;
 };
 
+/*
+ * Samples of the functor on the zero-padded grid of N dimensions, with 2*nsamples[a] points
+ * along the axis a, stored with the axis 0 running fastest. The points with index >= nsamples[a]
+ * in any axis hold zero.
+ */
+template<typename Functor, typename T, size_t N>
+struct GridFunctorSampler
+{
+	typedef hydra::complex<T> complex_type;
+
+	GridFunctorSampler()=delete;
+
+	GridFunctorSampler(Functor const& functor, std::array<size_t,N> const& nsamples,
+			std::array<T,N> const& min, std::array<T,N> const& delta):
+		fFunctor(functor)
+	{
+		for(size_t a=0; a<N; a++){
+			fNSamples[a] = nsamples[a];
+			fMin[a]      = min[a];
+			fDelta[a]    = delta[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	inline complex_type operator()(size_t index) const
+	{
+		T x[N];
+
+		for(size_t a=0; a<N; a++)
+		{
+			size_t j = index%(2*fNSamples[a]);
+			index   /= 2*fNSamples[a];
+
+			if( j >= fNSamples[a] ) return complex_type(0.0, 0.0);
+
+			x[a] = fMin[a] + j*fDelta[a];
+		}
+
+		return complex_type( fFunctor( detail::arrayToTuple<T, N>(x) ), 0.0);
+	}
+
+	size_t  fNSamples[N];
+	T       fMin[N];
+	T       fDelta[N];
+	Functor fFunctor;
+};
+
+/*
+ * Samples of the kernel on the zero-padded grid, wrapped around: the point j of the axis a
+ * is placed at j*delta[a] for j < nsamples[a] and at (j - 2*nsamples[a])*delta[a] otherwise.
+ */
+template<typename Kernel, typename T, size_t N>
+struct GridKernelSampler
+{
+	typedef hydra::complex<T> complex_type;
+
+	GridKernelSampler()=delete;
+
+	GridKernelSampler(Kernel const& kernel, std::array<size_t,N> const& nsamples,
+			std::array<T,N> const& delta):
+		fKernel(kernel)
+	{
+		for(size_t a=0; a<N; a++){
+			fNSamples[a] = nsamples[a];
+			fDelta[a]    = delta[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	inline complex_type operator()(size_t index) const
+	{
+		T t[N];
+
+		for(size_t a=0; a<N; a++)
+		{
+			size_t j = index%(2*fNSamples[a]);
+			index   /= 2*fNSamples[a];
+
+			// never reached by the samples of the convolution
+			if( j == fNSamples[a] ) return complex_type(0.0, 0.0);
+
+			t[a] = j < fNSamples[a] ? T(j)*fDelta[a] : (T(j) - T(2*fNSamples[a]))*fDelta[a];
+		}
+
+		return complex_type( fKernel( detail::arrayToTuple<T, N>(t) ), 0.0);
+	}
+
+	size_t fNSamples[N];
+	T      fDelta[N];
+	Kernel fKernel;
+};
+
+/*
+ * Reads the real part of the sample m of the convolution, m running over the
+ * unpadded grid with the axis 0 fastest, and scales it.
+ */
+template<typename T, size_t N>
+struct GridExtract
+{
+	typedef hydra::complex<T> complex_type;
+
+	GridExtract()=delete;
+
+	GridExtract(complex_type* data, std::array<size_t,N> const& nsamples, T scale):
+		fScale(scale),
+		fData(data)
+	{
+		size_t stride = 1;
+
+		for(size_t a=0; a<N; a++){
+			fNSamples[a] = nsamples[a];
+			fStrides[a]  = stride;
+			stride      *= 2*nsamples[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	inline T operator()(size_t index) const
+	{
+		size_t position = 0;
+
+		for(size_t a=0; a<N; a++)
+		{
+			position += (index%fNSamples[a])*fStrides[a];
+			index    /= fNSamples[a];
+		}
+
+		return fData[position].real()*fScale;
+	}
+
+	size_t fNSamples[N];
+	size_t fStrides[N];
+	T      fScale;
+	complex_type* fData;
+};
+
+/*
+ * Copies the line l of a batch of lines along the axis fAxis of a grid of N axes, with strides fStrides,
+ * between the grid and the batch, where the lines are stored contiguously, fLength points apart.
+ * The lines run over the first fExtents[a] coordinates of the other axes, the lowest axis running fastest,
+ * so that neighbouring lines are neighbours in the grid. The batch is written from the grid with fGather,
+ * and the grid from the batch otherwise.
+ */
+template<typename T, size_t N>
+struct GridLineCopy
+{
+	typedef hydra::complex<T> complex_type;
+
+	GridLineCopy()=delete;
+
+	GridLineCopy(complex_type* grid, complex_type* lines, size_t axis,
+			std::vector<size_t> const& extents, std::vector<size_t> const& strides, bool gather):
+		fGather(gather),
+		fAxis(axis),
+		fLength(extents[axis]),
+		fGrid(grid),
+		fLines(lines)
+	{
+		for(size_t a=0; a<N; a++){
+			fExtents[a] = extents[a];
+			fStrides[a] = strides[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	GridLineCopy(GridLineCopy<T,N> const& other):
+		fGather(other.fGather),
+		fAxis(other.fAxis),
+		fLength(other.fLength),
+		fGrid(other.fGrid),
+		fLines(other.fLines)
+	{
+		for(size_t a=0; a<N; a++){
+			fExtents[a] = other.fExtents[a];
+			fStrides[a] = other.fStrides[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t l) const
+	{
+		size_t line   = l;
+		size_t offset = 0;
+
+		for(size_t a=0; a<N; a++)
+		{
+			if(a == fAxis) continue;
+
+			size_t rest = line/fExtents[a];
+
+			offset += (line - rest*fExtents[a])*fStrides[a];
+			line    = rest;
+		}
+
+		const size_t stride = fStrides[fAxis];
+
+		complex_type* __restrict__ grid  = fGrid + offset;
+		complex_type* __restrict__ lines = fLines + l*fLength;
+
+		if(fGather)
+			for(size_t j=0; j<fLength; j++) lines[j] = grid[j*stride];
+		else
+			for(size_t j=0; j<fLength; j++) grid[j*stride] = lines[j];
+	}
+
+	bool   fGather;
+	size_t fAxis;
+	size_t fLength;
+	size_t fExtents[N];
+	size_t fStrides[N];
+	complex_type* fGrid;
+	complex_type* fLines;
+};
+
+/*
+ * Samples of a batch of M problems, on grids of 2*nsamples points. Two real sequences are packed in
+ * each complex sequence, as real and imaginary parts: the functor and the kernel of the problem b,
+ * or, when the kernels are not sampled, the functors of the problems 2b and 2b+1.
+ * The functor and the kernel are sampled with the same conventions as FunctorSampler and KernelSampler.
+ */
+template<typename Functor, typename Kernel, typename T>
+struct BatchSampler
+{
+	typedef hydra::complex<T> complex_type;
+
+	BatchSampler()=delete;
+
+	BatchSampler(const Functor* functors, const Kernel* kernels, size_t nproblems, size_t nsamples,
+			T min, T delta, bool with_kernels):
+		fWithKernels(with_kernels),
+		fNProblems(nproblems),
+		fNSamples(nsamples),
+		fMin(min),
+		fDelta(delta),
+		fFunctors(functors),
+		fKernels(kernels)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline complex_type operator()(size_t index) const
+	{
+		size_t b = index/(2*fNSamples);
+		size_t j = index - b*2*fNSamples;
+
+		if(fWithKernels)
+			return complex_type( SampleFunctor(b, j), SampleKernel(b, j) );
+
+		return complex_type( SampleFunctor(2*b, j), 2*b + 1 < fNProblems ? SampleFunctor(2*b + 1, j) : T(0.0) );
+	}
+
+private:
+
+	__hydra_host__ __hydra_device__
+	inline T SampleFunctor(size_t m, size_t j) const
+	{
+		return j < fNSamples ? T( fFunctors[m](fMin + j*fDelta) ) : T(0.0);
+	}
+
+	__hydra_host__ __hydra_device__
+	inline T SampleKernel(size_t m, size_t j) const
+	{
+		if( j == 0 ) return 0.5*fKernels[m](T(0.0));
+
+		if( j <= fNSamples - fNSamples/2 ) return fKernels[m](j*fDelta);
+
+		if( j >= fNSamples + fNSamples/2 ) return fKernels[m]( (T(j) - 1 - 2*T(fNSamples))*fDelta );
+
+		return T(0.0);
+	}
+
+	bool   fWithKernels;
+	size_t fNProblems;
+	size_t fNSamples;
+	T      fMin;
+	T      fDelta;
+	const Functor* fFunctors;
+	const Kernel*  fKernels;
+};
+
+/*
+ * Spectrum of the imaginary part of the complex sequences of length n, (Z[k] - conj(Z[n-k]))/2i.
+ */
+template<typename T>
+struct BatchKernelSpectrum
+{
+	typedef hydra::complex<T> complex_type;
+
+	BatchKernelSpectrum()=delete;
+
+	BatchKernelSpectrum(const complex_type* spectra, size_t n):
+		fN(n),
+		fSpectra(spectra)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline complex_type operator()(size_t index) const
+	{
+		size_t b = index/fN;
+		size_t k = index - b*fN;
+
+		complex_type z  = fSpectra[index];
+		complex_type zc = fSpectra[b*fN + (k ? fN - k : 0)];
+
+		complex_type d = z - complex_type(zc.real(), -zc.imag());
+
+		return complex_type(0.5*d.imag(), -0.5*d.real());
+	}
 
+	size_t fN;
+	const complex_type* fSpectra;
+};
+
+/*
+ * Products of the functor and kernel spectra of the problems 2c and 2c+1, packed as W = P_{2c} + i*P_{2c+1},
+ * whose backward transform holds the two real convolutions in its real and imaginary parts.
+ * The functor spectra are recovered from the forward transforms of the packed samples, see BatchSampler.
+ */
+template<typename T>
+struct BatchProduct
+{
+	typedef hydra::complex<T> complex_type;
+
+	BatchProduct()=delete;
+
+	BatchProduct(const complex_type* spectra, const complex_type* kernels, size_t nproblems, size_t n, bool with_kernels):
+		fWithKernels(with_kernels),
+		fNProblems(nproblems),
+		fN(n),
+		fSpectra(spectra),
+		fKernels(kernels)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline complex_type operator()(size_t index) const
+	{
+		size_t c = index/fN;
+		size_t k = index - c*fN;
+
+		complex_type p0 = Spectrum(2*c, k)*fKernels[2*c*fN + k];
+		complex_type p1 = 2*c + 1 < fNProblems ? Spectrum(2*c + 1, k)*fKernels[(2*c + 1)*fN + k] : complex_type(0.0, 0.0);
+
+		return complex_type(p0.real() - p1.imag(), p0.imag() + p1.real());
+	}
+
+private:
+
+	// spectrum of the functor of the problem m
+	__hydra_host__ __hydra_device__
+	inline complex_type Spectrum(size_t m, size_t k) const
+	{
+		size_t sequence = fWithKernels ? m : m/2;
+		bool   real     = fWithKernels || m%2 == 0;
+
+		complex_type z  = fSpectra[sequence*fN + k];
+		complex_type zc = fSpectra[sequence*fN + (k ? fN - k : 0)];
+
+		zc = complex_type(zc.real(), -zc.imag());
+
+		if(real) return T(0.5)*(z + zc);
+
+		complex_type d = z - zc;
+
+		return complex_type(0.5*d.imag(), -0.5*d.real());
+	}
+
+	bool   fWithKernels;
+	size_t fNProblems;
+	size_t fN;
+	const complex_type* fSpectra;
+	const complex_type* fKernels;
+};
+
+/*
+ * Sample j of the convolution of the problem m, from the backward transforms of the packed products.
+ */
+template<typename T>
+struct BatchExtract
+{
+	typedef hydra::complex<T> complex_type;
+
+	BatchExtract()=delete;
+
+	BatchExtract(const complex_type* data, size_t nsamples):
+		fNSamples(nsamples),
+		fNorm(T(1.0)/(2*nsamples)),
+		fData(data)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline T operator()(size_t index) const
+	{
+		size_t m = index/fNSamples;
+		size_t j = index - m*fNSamples;
+
+		complex_type value = fData[(m/2)*2*fNSamples + j];
+
+		return (m%2 == 0 ? value.real() : value.imag())*fNorm;
+	}
+
+	size_t fNSamples;
+	T      fNorm;
+	const complex_type* fData;
+};
 
 }  // namespace convolution
 
@@ -511,6 +511,66 @@ typedef detail::FlagDaugthers< reweight_functor> tagger_type;
 }
 
 
+template<typename ...Particles,   hydra::detail::Backend Backend>
+template<typename GRND>
+hydra::Range<typename Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::iterator>
+Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::Unweight( OnlineUnweighting<system_type, GRND>& unweighter)
+{
+	auto weights = hydra::thrust::make_transform_iterator(fDecays.begin(), this->GetEventWeightFunctor());
+
+	return unweighter.Unweight(fDecays.begin(), fDecays.end(), weights);
+}
+
+template<typename ...Particles,   hydra::detail::Backend Backend>
+template<typename  Functor, typename GRND>
+typename std::enable_if<
+ 	detail::is_hydra_functor<Functor>::value ||
+ 	detail::is_hydra_lambda<Functor>::value  ||
+ 	detail::is_hydra_composite_functor<Functor>::value,
+	hydra::Range<typename  Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::iterator>>::type
+Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::Unweight( Functor  const& functor,
+		OnlineUnweighting<system_type, GRND>& unweighter)
+{
+	auto weights = hydra::thrust::make_transform_iterator(fDecays.begin(), this->GetEventWeightFunctor(functor));
+
+	return unweighter.Unweight(fDecays.begin(), fDecays.end(), weights);
+}
+
+template<typename ...Particles,   hydra::detail::Backend Backend>
+template<typename GRND, typename Iterable>
+typename std::enable_if<detail::is_iterable<Iterable>::value,
+	hydra::Range<typename Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::iterator>>::type
+Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::Unweight( OnlineUnweighting<system_type, GRND>& unweighter,
+		Iterable&& residuals)
+{
+	if( size_t(hydra::thrust::distance(std::forward<Iterable>(residuals).begin(),
+			std::forward<Iterable>(residuals).end())) < this->size() )
+		throw std::invalid_argument("[hydra::Decays]: Residual weights container smaller than the decays container. (residuals.size() < size())");
+
+	auto weights = hydra::thrust::make_transform_iterator(fDecays.begin(), this->GetEventWeightFunctor());
+
+	return unweighter.Unweight(fDecays.begin(), fDecays.end(), weights, std::forward<Iterable>(residuals).begin());
+}
+
+template<typename ...Particles,   hydra::detail::Backend Backend>
+template<typename  Functor, typename GRND, typename Iterable>
+typename std::enable_if<
+ 	(detail::is_hydra_functor<Functor>::value ||
+ 	detail::is_hydra_lambda<Functor>::value  ||
+ 	detail::is_hydra_composite_functor<Functor>::value) &&
+ 	detail::is_iterable<Iterable>::value,
+	hydra::Range<typename  Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::iterator>>::type
+Decays<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<Backend>>::Unweight( Functor  const& functor,
+		OnlineUnweighting<system_type, GRND>& unweighter, Iterable&& residuals)
+{
+	if( size_t(hydra::thrust::distance(std::forward<Iterable>(residuals).begin(),
+			std::forward<Iterable>(residuals).end())) < this->size() )
+		throw std::invalid_argument("[hydra::Decays]: Residual weights container smaller than the decays container. (residuals.size() < size())");
+
+	auto weights = hydra::thrust::make_transform_iterator(fDecays.begin(), this->GetEventWeightFunctor(functor));
+
+	return unweighter.Unweight(fDecays.begin(), fDecays.end(), weights, std::forward<Iterable>(residuals).begin());
+}
 
 }  // namespace hydra
 
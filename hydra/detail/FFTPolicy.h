@@ -35,7 +35,7 @@ namespace hydra {
 
 	namespace detail {
 
-		enum FFTCalculator{CuFFT, FFTW};
+		enum FFTCalculator{CuFFT, FFTW, Native};
 
 		 template<typename Precision, FFTCalculator FFTBackend>
 		 struct FFTPolicy;
@@ -34,7 +34,8 @@
 #include <cmath>
 #include <tuple>
 #include <limits>
-#include <hydra/detail/external/hydra_thrust/sort.h>
+#include <algorithm>
+#include <stdexcept>
 #include <hydra/detail/external/hydra_thrust/execution_policy.h>
 #include <hydra/detail/external/hydra_thrust/functional.h>
 
@@ -50,31 +51,32 @@ GaussKronrodAdaptiveQuadrature<NRULE,NBIN,hydra::detail::BackendPolicy<BACKEND>>
 
 			auto row = fCallTableHost[index];
 
-			size_t  bin        = hydra::thrust::get<0>(row);
+			size_t  bin        = fHeapSize + hydra::thrust::get<0>(row);
 			GReal_t bin_delta  = hydra::thrust::get<1>(row)-hydra::thrust::get<2>(row);
 			GReal_t bin_result = hydra::thrust::get<2>(row);
 			hydra::thrust::get<4>(fNodesTable[bin])   +=  bin_result;
 			hydra::thrust::get<5>(fNodesTable[bin])   +=  bin_delta;
 		}
 
+	//push the evaluated nodes into the heap
+	for(size_t node=fHeapSize; node<fNodesTable.size(); node++ )
+	{
+		hydra::thrust::get<5>(fNodesTable[node])= GetError(hydra::thrust::get<5>(fNodesTable[node]) );
+		hydra::thrust::get<0>(fNodesTable[node])=0;
+
+		std::push_heap(fNodesTable.begin(), fNodesTable.begin() + node + 1,
+				hydra::detail::CompareTuples<5,	hydra::thrust::less >());
+	}
+
+	fHeapSize = fNodesTable.size();
+
 	GReal_t result=0;
 	GReal_t error2=0;
 
-	//for(auto row: fNodesTable ) std::cout <<std::setprecision(10)<< row << std::endl;
-
 	for(size_t node=0; node<fNodesTable.size(); node++ )
 	{
-		//std::cout <<std::setprecision(10)<< fNodesTable[node]<< std::endl;
-		if(hydra::thrust::get<0>(fNodesTable[node])==1 )
-		{
-			hydra::thrust::get<5>(fNodesTable[node])= GetError(hydra::thrust::get<5>(fNodesTable[node]) );
-			hydra::thrust::get<0>(fNodesTable[node])=0;
-			//std::cout << "====>"<< std::setprecision(10)<< fNodesTable[node]<< std::endl;
-		}
-
 		result     += hydra::thrust::get<4>(fNodesTable[node]);
 		error2    += hydra::thrust::get<5>(fNodesTable[node])*hydra::thrust::get<5>(fNodesTable[node]);
-
 	}
 
 	return std::pair<GReal_t, GReal_t>(result, sqrt(error2) );
@@ -85,19 +87,23 @@ template<typename FUNCTOR>
 std::pair<GReal_t, GReal_t>
 GaussKronrodAdaptiveQuadrature<NRULE,NBIN, hydra::detail::BackendPolicy<BACKEND>>::Integrate(FUNCTOR const& functor)
 {
+	if( fBatchSize==0 )
+		throw std::invalid_argument("[hydra::GaussKronrodAdaptiveQuadrature]: Batch size is zero. (fBatchSize==0)");
+
 	std::pair<GReal_t, GReal_t> result(0,0);
 
 	fIterationNumber=0;
 	GBool_t  condition1=0;
 	GBool_t  condition2=0;
+	GBool_t  condition3=0;
 
 	InitNodes();
 	do{
 
 		// do  not split nodes at first iteration
-		if( fIterationNumber>0 ) UpdateNodes();
+		if( fIterationNumber>0 ) UpdateNodes(result);
 
-		//set parameters table
+		//set parameters table, only for the new nodes
 		SetParametersTable( );
 
 		//set the call table to hold the evaluation results
@@ -113,65 +119,68 @@ GaussKronrodAdaptiveQuadrature<NRULE,NBIN, hydra::detail::BackendPolicy<BACKEND>
 		hydra::thrust::copy(fCallTableDevice.begin(),  fCallTableDevice.end(),
 				fCallTableHost.begin());
 
-		/**
-		 * \todo Re-implement Accumulate() using hydra::thrust::sort + thust::reduce_by_key, maybe not faster but
-		 * more scalable.
-		 */
 		result = Accumulate();
 
 		fIterationNumber++;
 
 		/*
 		 * keep iterating while the error is larger than the required or
-		 * larger than the numerical double precision
+		 * larger than the numerical double precision, and the
+		 * maximum number of nodes is not reached
 		 */
 
 		condition1 =  result.second > sqrt(result.first*result.first)*fMaxRelativeError;
 		condition2 =  result.second > std::numeric_limits<GReal_t>::epsilon();
+		condition3 =  fNodesTable.size() < fMaxNodes;
 
 	}
-	while( condition1 &&  condition2 );
+	while( condition1 &&  condition2 && condition3 );
 
 	return result;
 }
 
 
 template<size_t NRULE, size_t NBIN, hydra::detail::Backend BACKEND>
-void GaussKronrodAdaptiveQuadrature<NRULE,NBIN,hydra::detail::BackendPolicy<BACKEND>>::UpdateNodes()
+void GaussKronrodAdaptiveQuadrature<NRULE,NBIN,hydra::detail::BackendPolicy<BACKEND>>::UpdateNodes(
+		std::pair<GReal_t, GReal_t> const& result)
 {
+	GReal_t tolerance2 = std::pow(result.first*fMaxRelativeError, 2);
+	GReal_t error2     = result.second*result.second;
 
-	hydra::thrust::sort(hydra::thrust::host,
-				fNodesTable.begin(),
-			    fNodesTable.end(),
-				hydra::detail::CompareTuples<5,	hydra::thrust::greater >());
+	node_list_h new_nodes;
+	new_nodes.reserve(2*fBatchSize);
 
-	auto node = fNodesTable[0];
+	/*
+	 * split the nodes with the largest errors while the error
+	 * of the remaining ones is still above the tolerance
+	 */
+	do{
+		std::pop_heap(fNodesTable.begin(), fNodesTable.begin() + fHeapSize,
+				hydra::detail::CompareTuples<5,	hydra::thrust::less >());
 
-	GReal_t lower_limits = hydra::thrust::get<2>(node);
-	GReal_t upper_limits = hydra::thrust::get<3>(node);
-	GReal_t delta = upper_limits-lower_limits;
+		auto node = fNodesTable[--fHeapSize];
 
-	GReal_t delta2 = delta/2.0;
-	node_t new_node1(1, 0, lower_limits ,lower_limits+delta2, 0, 0);
-	node_t new_node2(1, 0, lower_limits+delta2, upper_limits, 0, 0);
+		GReal_t lower_limits = hydra::thrust::get<2>(node);
+		GReal_t upper_limits = hydra::thrust::get<3>(node);
+		GReal_t delta2 = (upper_limits-lower_limits)/2.0;
 
-	fNodesTable[0] =  new_node1;
-	fNodesTable.push_back( new_node2);
+		error2 -= hydra::thrust::get<5>(node)*hydra::thrust::get<5>(node);
 
+		new_nodes.push_back( node_t(1, 0, lower_limits ,lower_limits+delta2, 0, 0) );
+		new_nodes.push_back( node_t(1, 0, lower_limits+delta2, upper_limits, 0, 0) );
 
-	hydra::thrust::sort(hydra::thrust::host,
-			fNodesTable.begin(),
-		    fNodesTable.end(),
-			hydra::detail::CompareTuples<2,	hydra::thrust::less >());
+	} while( fHeapSize > 0 && error2 > tolerance2
+			&& new_nodes.size() < 2*fBatchSize
+			&& fHeapSize + new_nodes.size() < fMaxNodes );
 
+	fNodesTable.resize(fHeapSize);
 
-	for(size_t  i = 0; i<fNodesTable.size(); i++)
+	for(size_t  i = 0; i<new_nodes.size(); i++)
 	{
-		hydra::thrust::get<1>(fNodesTable[i])=i;
+		hydra::thrust::get<1>(new_nodes[i])=i;
+		fNodesTable.push_back(new_nodes[i]);
 	}
 
-	//for(auto row: fNodesTable) std::cout << row << std::endl;
-
 }
 
 
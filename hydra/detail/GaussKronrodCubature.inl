@@ -0,0 +1,346 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * GaussKronrodCubature.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef GAUSSKRONRODCUBATURE_INL_
+#define GAUSSKRONRODCUBATURE_INL_
+
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdint.h>
+
+namespace hydra {
+
+namespace detail {
+
+namespace gauss_kronrod_cubature {
+
+/*
+ * One-dimensional rule on [-1, 1], with all nodes expanded, and its embedded Gauss rule.
+ * Each node carries a code identifying it among all the tabulated rules: 0 for the center,
+ * shared by all rules, and (NRULE<<8)|(node<<1)|sign otherwise, so that the nodes of a Gauss rule
+ * have the same codes as in the Gauss-Kronrod rule it is embedded in.
+ */
+struct rule_1d
+{
+	std::vector<GReal_t>  X;
+	std::vector<GReal_t>  KronrodWeight;
+	std::vector<GReal_t>  GaussWeight;
+	std::vector<uint32_t> Code;
+
+	inline void AddNode(GReal_t x, GReal_t kronrod_weight, GReal_t gauss_weight, uint32_t code)
+	{
+		X.push_back(x);
+		KronrodWeight.push_back(kronrod_weight);
+		GaussWeight.push_back(gauss_weight);
+		Code.push_back(code);
+	}
+};
+
+/*
+ * Gauss-Kronrod rule with NRULE nodes or, if gauss_only is true, its embedded Gauss rule alone.
+ */
+template<size_t NRULE>
+inline rule_1d expand_rule(bool gauss_only=false)
+{
+	GaussKronrodRule<NRULE> rule = GaussKronrodRuleSelector<NRULE>().fRule;
+
+	rule_1d result;
+
+	for(uint32_t i=0; i<(NRULE+1)/2; i++)
+	{
+		if( gauss_only && rule.GaussWeight[i]==0.0 ) continue;
+
+		GReal_t kronrod_weight = gauss_only ? rule.GaussWeight[i] : rule.KronrodWeight[i];
+
+		if( i==0 ){
+			result.AddNode(0.0, kronrod_weight, rule.GaussWeight[0], 0);
+			continue;
+		}
+
+		result.AddNode( rule.X[i], kronrod_weight, rule.GaussWeight[i], (uint32_t(NRULE)<<8)|(i<<1));
+		result.AddNode(-rule.X[i], kronrod_weight, rule.GaussWeight[i], (uint32_t(NRULE)<<8)|(i<<1)|1u);
+	}
+
+	return result;
+}
+
+/*
+ * Rules of increasing level for the sparse grids, with roughly doubling number of nodes:
+ * the midpoint rule, the 7 points Gauss rule and the Gauss-Kronrod rules with 15, 31 and 61 nodes.
+ * The first three are nested.
+ */
+inline rule_1d sparse_grid_rule(size_t level)
+{
+	rule_1d result;
+
+	switch(level)
+	{
+	case 0:  result.AddNode(0.0, 2.0, 2.0, 0); break;
+	case 1:  result = expand_rule<15>(true); break;
+	case 2:  result = expand_rule<15>(); break;
+	case 3:  result = expand_rule<31>(); break;
+	default: result = expand_rule<61>(); break;
+	}
+
+	return result;
+}
+
+inline GReal_t binomial(size_t n, size_t k)
+{
+	GReal_t result = 1.0;
+
+	for(size_t i=1; i<=k; i++)
+		result = result*(n - k + i)/i;
+
+	return result;
+}
+
+/*
+ * Multi-indexes l, with l_j <= level, whose sum is in [min_sum, level].
+ */
+template<size_t N>
+void smolyak_terms(size_t level, size_t min_sum, size_t dim, size_t sum,
+		std::array<size_t,N>& index, std::vector<std::array<size_t,N>>& terms)
+{
+	if(dim == N)
+	{
+		if(sum >= min_sum) terms.push_back(index);
+		return;
+	}
+
+	for(size_t l=0; sum + l <= level; l++)
+	{
+		index[dim] = l;
+		smolyak_terms<N>(level, min_sum, dim+1, sum + l, index, terms);
+	}
+}
+
+}  // namespace gauss_kronrod_cubature
+
+}  // namespace detail
+
+template<size_t NRULE, size_t N, hydra::detail::Backend BACKEND>
+void GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>::SetCallTable()
+{
+	if(fSparseGrid)
+		SetSparseGridTable();
+	else
+		SetTensorProductTable();
+}
+
+template<size_t NRULE, size_t N, hydra::detail::Backend BACKEND>
+void GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>::SetTensorProductTable()
+{
+	detail::gauss_kronrod_cubature::rule_1d rule = detail::gauss_kronrod_cubature::expand_rule<NRULE>();
+
+	std::vector<GReal_t> nodes, kronrod_weights, gauss_weights;
+
+	fNPoints = 1;
+
+	for(size_t j=0; j<N; j++)
+	{
+		if( fGrid[j] == 0 )
+			throw std::invalid_argument("[hydra::GaussKronrodCubature]: Number of intervals is zero. (grid[j]==0)");
+
+		GReal_t delta = (fUpperLimits[j] - fLowerLimits[j])/fGrid[j];
+
+		for(size_t bin=0; bin<fGrid[j]; bin++)
+		{
+			GReal_t a = delta/2.0;
+			GReal_t b = fLowerLimits[j] + (bin + 0.5)*delta;
+
+			for(size_t node=0; node<rule.X.size(); node++)
+			{
+				nodes.push_back( a*rule.X[node] + b);
+				kronrod_weights.push_back( a*rule.KronrodWeight[node]);
+				gauss_weights.push_back( a*rule.GaussWeight[node]);
+			}
+		}
+
+		fNPoints *= fGrid[j]*rule.X.size();
+	}
+
+	fNodes          = nodes;
+	fKronrodWeights = kronrod_weights;
+	fGaussWeights   = gauss_weights;
+}
+
+template<size_t NRULE, size_t N, hydra::detail::Backend BACKEND>
+void GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>::SetSparseGridTable()
+{
+	using namespace detail::gauss_kronrod_cubature;
+
+	if( fLevel > 4 )
+		throw std::invalid_argument("[hydra::GaussKronrodCubature]: Sparse-grid level above 4. (level > 4)");
+
+	std::vector<rule_1d> rules;
+	std::map<uint32_t, GReal_t> abscissas;
+
+	for(size_t l=0; l<=fLevel; l++)
+	{
+		rules.push_back(sparse_grid_rule(l));
+
+		for(size_t node=0; node<rules[l].X.size(); node++)
+			abscissas[rules[l].Code[node]] = rules[l].X[node];
+	}
+
+	/*
+	 * terms of the sparse grids of level fLevel and fLevel-1. The grid stores the union of
+	 * their nodes, each one with its weight in both rules (zero where it does not belong to one).
+	 * For N >= 2 the nodes of level fLevel-1 are a subset of the ones of level fLevel, but not for N = 1
+	 * from level 3, as the Gauss-Kronrod rules with 15, 31 and 61 nodes are not nested.
+	 * At level 0, the embedded rule is the midpoint rule itself.
+	 */
+	size_t embedded_level = fLevel ? fLevel - 1 : 0;
+
+	std::vector<std::array<size_t,N>> terms;
+	std::array<size_t,N> index{};
+
+	smolyak_terms<N>(fLevel, embedded_level+1 > N ? embedded_level+1-N : 0, 0, 0, index, terms);
+
+	auto coefficient = [](size_t level, size_t sum){
+
+		if( sum > level || sum + N <= level ) return 0.0;
+
+		return ((level - sum)%2 ? -1.0 : 1.0)*binomial(N-1, level - sum);
+	};
+
+	// weights on [-1, 1]^N of the distinct nodes, keyed by the codes of their coordinates
+	std::map<std::array<uint32_t,N>, std::pair<GReal_t, GReal_t>> grid;
+
+	for(auto const& term: terms)
+	{
+		size_t sum = 0;
+		size_t npoints = 1;
+
+		for(size_t j=0; j<N; j++){
+			sum     += term[j];
+			npoints *= rules[term[j]].X.size();
+		}
+
+		GReal_t coefficient_sparse   = coefficient(fLevel, sum);
+		GReal_t coefficient_embedded = coefficient(embedded_level, sum);
+
+		for(size_t point=0; point<npoints; point++)
+		{
+			std::array<uint32_t,N> key;
+			GReal_t weight = 1.0;
+
+			for(size_t j=0, i=point; j<N; j++)
+			{
+				rule_1d const& rule = rules[term[j]];
+				size_t node = i%rule.X.size();
+				i /= rule.X.size();
+
+				key[j]  = rule.Code[node];
+				weight *= rule.KronrodWeight[node];
+			}
+
+			auto& weights   = grid[key];
+			weights.first  += coefficient_sparse*weight;
+			weights.second += coefficient_embedded*weight;
+		}
+	}
+
+	fNPoints = grid.size();
+
+	std::vector<GReal_t> nodes(N*fNPoints), kronrod_weights(fNPoints), gauss_weights(fNPoints);
+
+	GReal_t jacobian = 1.0;
+
+	for(size_t j=0; j<N; j++)
+		jacobian *= (fUpperLimits[j] - fLowerLimits[j])/2.0;
+
+	size_t point = 0;
+
+	for(auto const& node: grid)
+	{
+		for(size_t j=0; j<N; j++)
+			nodes[j*fNPoints + point] = fLowerLimits[j]
+					+ (abscissas[node.first[j]] + 1.0)*(fUpperLimits[j] - fLowerLimits[j])/2.0;
+
+		kronrod_weights[point] = jacobian*node.second.first;
+		gauss_weights[point]   = jacobian*node.second.second;
+
+		point++;
+	}
+
+	fNodes          = nodes;
+	fKronrodWeights = kronrod_weights;
+	fGaussWeights   = gauss_weights;
+}
+
+template<size_t NRULE, size_t N, hydra::detail::Backend BACKEND>
+template<typename FUNCTOR>
+std::pair<GReal_t, GReal_t>
+GaussKronrodCubature<NRULE, N, hydra::detail::BackendPolicy<BACKEND>>::Integrate(FUNCTOR const& functor)
+{
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + fNPoints;
+
+	GReal_t* nodes           = const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fNodes.data()));
+	GReal_t* kronrod_weights = const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fKronrodWeights.data()));
+	GReal_t* gauss_weights   = const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fGaussWeights.data()));
+
+	GaussKronrodCall result;
+
+	if(fSparseGrid)
+	{
+		detail::GaussKronrodSparseCall<FUNCTOR,N> call(nodes, kronrod_weights, gauss_weights, fNPoints, functor);
+
+		result = hydra::thrust::transform_reduce(system_t(), first, last,
+				call, GaussKronrodCall(), GaussKronrodBinary() );
+	}
+	else
+	{
+		size_t sizes[N];
+
+		for(size_t j=0; j<N; j++)
+			sizes[j] = fGrid[j]*NRULE;
+
+		detail::GaussKronrodTensorCall<FUNCTOR,N> call(nodes, kronrod_weights, gauss_weights, sizes, functor);
+
+		result = hydra::thrust::transform_reduce(system_t(), first, last,
+				call, GaussKronrodCall(), GaussKronrodBinary() );
+	}
+
+	GReal_t difference = std::fabs(result.fGaussCall- result.fGaussKronrodCall );
+
+	// the truncation error of the sparse grid is not reduced by the Gauss-Kronrod heuristic
+	GReal_t error = std::max(std::numeric_limits<GReal_t>::epsilon(),
+			fSparseGrid ? difference : std::pow(200.0*difference, 1.5));
+
+	return std::pair<GReal_t, GReal_t>(result.fGaussKronrodCall, error);
+}
+
+}  // namespace hydra
+
+#endif /* GAUSSKRONRODCUBATURE_INL_ */
@@ -59,6 +59,30 @@ GaussKronrodQuadrature<NRULE, NBIN, hydra::detail::BackendPolicy<BACKEND>>::Inte
 	return std::pair<GReal_t, GReal_t>(result.fGaussKronrodCall, error);
 }
 
+template<size_t NRULE, size_t NBIN, hydra::detail::Backend  BACKEND>
+template<typename FUNCTOR>
+detail::multi_integral_t<FUNCTOR>
+GaussKronrodQuadrature<NRULE, NBIN, hydra::detail::BackendPolicy<BACKEND>>::MultiIntegrate(FUNCTOR const& functor)
+{
+	constexpr size_t K = detail::multi_integrand_size<FUNCTOR>::value;
+
+	GaussKronrodMultiCall<K> result = hydra::thrust::transform_reduce(hydra::detail::BackendPolicy<BACKEND>{},
+			fCallTable.begin(), fCallTable.end(),
+			GaussKronrodMultiUnary<FUNCTOR,K>(functor), GaussKronrodMultiCall<K>(), GaussKronrodMultiBinary<K>() );
+
+	detail::multi_integral_t<FUNCTOR> integrals;
+
+	for(size_t k=0; k<K; k++)
+	{
+		GReal_t error = std::max(std::numeric_limits<GReal_t>::epsilon(),
+				std::pow(200.0*std::fabs(result.fGaussCall[k]- result.fGaussKronrodCall[k] ), 1.5));
+
+		integrals[k] = std::pair<GReal_t, GReal_t>(result.fGaussKronrodCall[k], error);
+	}
+
+	return integrals;
+}
+
 }  // namespace hydra
 
 #endif /* GAUSSKRONRODQUADRATURE_INL_ */
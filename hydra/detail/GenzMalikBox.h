@@ -315,7 +315,13 @@ public:
 		this->fRule5 = hydra::get<0>(_pair.first ) ;
 		this->fRule7 = hydra::get<1>(_pair.first ) ;
 
-			this->fCutAxis = hydra::detail::max( _pair.second);
+			//bisect along the axis with the largest fourth difference, in absolute value
+			GReal_t four_difference[N];
+			hydra::detail::tupleToArray(_pair.second, &four_difference[0]);
+
+			this->fCutAxis = 0;
+			for(size_t i=1; i<N; i++)
+				this->fCutAxis = ::fabs(four_difference[i]) > ::fabs(four_difference[this->fCutAxis]) ? i : this->fCutAxis;
 
 			GReal_t factor = this->fVolume/::pow(2.0, N);
 
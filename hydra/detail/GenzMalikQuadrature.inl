@@ -40,9 +40,12 @@
 #include <hydra/detail/utility/Generic.h>
 #include <hydra/detail/functors/ProcessGenzMalikQuadrature.h>
 #include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
 #include <algorithm>
 #include <cmath>
 #include <future>
+#include <stdexcept>
 
 
 
@@ -205,15 +208,27 @@ void GenzMalikQuadrature<N, hydra::detail::BackendPolicy<BACKEND>>::SetGeometry(
 
 template<size_t N, hydra::detail::Backend  BACKEND>
 GenzMalikQuadrature<N, hydra::detail::BackendPolicy<BACKEND>>::GenzMalikQuadrature( GenzMalikQuadrature<N, hydra::detail::BackendPolicy<BACKEND>> const& other):
-fBoxList(other.GetBoxList() ),
-fGenzMalikRule(other.GetGenzMalikRule() )
+fRelativeError(other.GetRelativeError() ),
+fAbsoluteError(other.GetAbsoluteError() ),
+fFraction(other.GetFraction() ),
+fMaxBoxes(other.GetMaxBoxes() ),
+fBatchSize(other.GetBatchSize() ),
+fAdaptive(other.IsAdaptive() ),
+fGenzMalikRule(other.GetGenzMalikRule() ),
+fBoxList(other.GetBoxList() )
 {}
 
 template<size_t N, hydra::detail::Backend  BACKEND>
 template<hydra::detail::Backend  BACKEND2>
 GenzMalikQuadrature<N, hydra::detail::BackendPolicy<BACKEND>>::GenzMalikQuadrature( GenzMalikQuadrature<N, hydra::detail::BackendPolicy<BACKEND2>> const& other):
-fBoxList(other.GetBoxList() ),
-fGenzMalikRule(other.GetGenzMalikRule() )
+fRelativeError(other.GetRelativeError() ),
+fAbsoluteError(other.GetAbsoluteError() ),
+fFraction(other.GetFraction() ),
+fMaxBoxes(other.GetMaxBoxes() ),
+fBatchSize(other.GetBatchSize() ),
+fAdaptive(other.IsAdaptive() ),
+fGenzMalikRule(other.GetGenzMalikRule() ),
+fBoxList(other.GetBoxList() )
 {}
 
 
@@ -223,6 +238,12 @@ GenzMalikQuadrature<N,hydra::detail::BackendPolicy<BACKEND>>::operator=( GenzMal
 {
 	if(this==&other) return *this;
 
+	this->fRelativeError = other.GetRelativeError();
+	this->fAbsoluteError = other.GetAbsoluteError();
+	this->fFraction  = other.GetFraction();
+	this->fMaxBoxes  = other.GetMaxBoxes();
+	this->fBatchSize = other.GetBatchSize();
+	this->fAdaptive  = other.IsAdaptive();
 	this->fBoxList=other.GetBoxList() ;
 	this->fGenzMalikRule = other.GetGenzMalikRule() ;
 
@@ -236,6 +257,12 @@ GenzMalikQuadrature<N,hydra::detail::BackendPolicy<BACKEND>>::operator=( GenzMal
 {
 	if(this==&other) return *this;
 
+	this->fRelativeError = other.GetRelativeError();
+	this->fAbsoluteError = other.GetAbsoluteError();
+	this->fFraction  = other.GetFraction();
+	this->fMaxBoxes  = other.GetMaxBoxes();
+	this->fBatchSize = other.GetBatchSize();
+	this->fAdaptive  = other.IsAdaptive();
 	this->fBoxList=other.GetBoxList() ;
 	this->fGenzMalikRule = other.GetGenzMalikRule() ;
 
@@ -247,6 +274,8 @@ template<typename FUNCTOR>
 std::pair<GReal_t, GReal_t> GenzMalikQuadrature<N,hydra::detail::BackendPolicy<BACKEND>>::Integrate(FUNCTOR const& functor)
 {
 
+	if( fAdaptive ) return HeapIntegration(functor);
+
 	device_box_list_type TempBoxList_d( fBoxList );
 
 	detail::ProcessGenzMalikBox<N, FUNCTOR, rule_iterator> process_box(functor,
@@ -283,6 +312,99 @@ std::pair<GReal_t, GReal_t> GenzMalikQuadrature<N,hydra::detail::BackendPolicy<B
 	return  result;
 }
 
+template<size_t N, hydra::detail::Backend  BACKEND>
+template<typename FUNCTOR>
+std::pair<GReal_t, GReal_t>
+GenzMalikQuadrature<N,hydra::detail::BackendPolicy<BACKEND>>::HeapIntegration(FUNCTOR const& functor)
+{
+	if( fBatchSize==0 )
+		throw std::invalid_argument("[hydra::GenzMalikQuadrature]: Batch size is zero. (fBatchSize==0)");
+
+	detail::ProcessGenzMalikBox<N, FUNCTOR, rule_iterator> process_box(functor,
+			fGenzMalikRule.begin(), fGenzMalikRule.end() ) ;
+
+	detail::CompareGenzMalikBoxes<N> compare;
+
+	//evaluate the initial boxes
+	device_box_list_type boxes_d( fBoxList );
+
+	hydra::thrust::for_each(system_type(), boxes_d.begin(), boxes_d.end(), process_box);
+
+	//heap of boxes, with the largest error on the top
+	box_list_type heap( boxes_d.size() );
+
+	hydra::thrust::copy( boxes_d.begin(), boxes_d.end(), heap.begin() );
+
+	std::make_heap(heap.begin(), heap.end(), compare);
+
+	GReal_t integral = 0.0;
+	GReal_t error    = 0.0;
+
+	for(auto const& box: heap){
+		integral += box.GetIntegral();
+		error    += box.GetError();
+	}
+
+	//new boxes are evaluated in batches on the device
+	box_list_type new_boxes;
+	new_boxes.reserve( 2*fBatchSize );
+
+	boxes_d.resize( 2*fBatchSize );
+
+	while( error > std::max(fAbsoluteError, fRelativeError*std::fabs(integral))
+			&& heap.size() < fMaxBoxes )
+	{
+		GReal_t tolerance = std::max(fAbsoluteError, fRelativeError*std::fabs(integral));
+
+		new_boxes.clear();
+
+		//pop boxes while the error of the remaining ones is still above the tolerance
+		do{
+			std::pop_heap(heap.begin(), heap.end(), compare);
+
+			detail::GenzMalikBox<N> box( heap.back() );
+			heap.pop_back();
+
+			integral -= box.GetIntegral();
+			error    -= box.GetError();
+
+			auto sub_boxes = box.Divide();
+
+			new_boxes.push_back(sub_boxes.first);
+			new_boxes.push_back(sub_boxes.second);
+
+		} while( !heap.empty() && error > tolerance
+				&& new_boxes.size() < 2*fBatchSize
+				&& heap.size() + new_boxes.size() < fMaxBoxes );
+
+		hydra::thrust::copy( new_boxes.begin(), new_boxes.end(), boxes_d.begin() );
+
+		hydra::thrust::for_each(system_type(), boxes_d.begin(), boxes_d.begin() + new_boxes.size(), process_box);
+
+		hydra::thrust::copy( boxes_d.begin(), boxes_d.begin() + new_boxes.size(), new_boxes.begin() );
+
+		for(auto const& box: new_boxes){
+
+			integral += box.GetIntegral();
+			error    += box.GetError();
+
+			heap.push_back(box);
+			std::push_heap(heap.begin(), heap.end(), compare);
+		}
+	}
+
+	//sum up again, to get rid of the round-off accumulated in the updates
+	integral = 0.0;
+	error    = 0.0;
+
+	for(auto const& box: heap){
+		integral += box.GetIntegral();
+		error    += box.GetError();
+	}
+
+	return std::make_pair(integral, error);
+}
+
 template<size_t N, hydra::detail::Backend  BACKEND>
 template<typename FUNCTOR, typename Vector>
 void GenzMalikQuadrature<N,
@@ -0,0 +1,182 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * InterferenceMatrixIntegrator.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef INTERFERENCEMATRIXINTEGRATOR_INL_
+#define INTERFERENCEMATRIXINTEGRATOR_INL_
+
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+
+#include <cmath>
+
+namespace hydra {
+
+template<hydra::detail::Backend BACKEND, typename Iterator>
+template<typename FUNCTOR>
+std::pair<GReal_t, GReal_t>
+InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>::Integrate(FUNCTOR const& functor)
+{
+	auto amplitudes = detail::dropFirst(functor.GetFunctors());
+
+	constexpr size_t K = hydra::thrust::tuple_size<decltype(amplitudes)>::value;
+
+	cache_t& cache = *fCache;
+
+	if( cache.fNAmplitudes != K )
+	{
+		cache.fNAmplitudes = K;
+		cache.fShapes.resize(K*fNEvents);
+		cache.fMatrix.assign(K*K, hydra::complex<GReal_t>(0.0, 0.0));
+		cache.fShapeKeys.assign(K, 0);
+		cache.fValid.assign(K, false);
+	}
+
+	//evaluate again the shapes whose parameters changed
+	std::vector<bool> changed(K, false);
+
+	UpdateShapes(amplitudes, changed, detail::make_index_sequence<K>{});
+
+	for(size_t i=0; i<K; i++)
+		if(changed[i]) UpdateRow<K>(i);
+
+	//I = S * sum_ij c_i M_ij conj(c_j)
+	std::array<hydra::complex<GReal_t>, K> couplings = GetCouplings(amplitudes, detail::make_index_sequence<K>{});
+
+	GReal_t result = 0.0;
+
+	for(size_t i=0; i<K; i++)
+		for(size_t j=0; j<K; j++)
+			result += (couplings[i]*cache.fMatrix[i*K + j]*hydra::conj(couplings[j])).real();
+
+	result *= fScale;
+
+	GReal_t error = 0.0;
+
+	if( fErrorEstimation )
+	{
+		hydra::thrust::counting_iterator<size_t> first(0);
+		hydra::thrust::counting_iterator<size_t> last = first + fNEvents;
+
+		PlainState state = hydra::thrust::transform_reduce(system_t(), first, last,
+				detail::InterferenceMatrixCall<K>(
+						hydra::thrust::raw_pointer_cast(cache.fShapes.data()),
+						const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fWeights.data())),
+						fNEvents, couplings),
+				PlainState(), detail::ProcessCallsPlainBinary() );
+
+		error = fScale*::sqrt( state.fM2/(GReal_t(fNEvents)*(fNEvents - 1)) );
+	}
+
+	return std::make_pair(result, error);
+}
+
+template<hydra::detail::Backend BACKEND, typename Iterator>
+template<typename Amplitudes, size_t ...I>
+inline void
+InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>::UpdateShapes(Amplitudes const& amplitudes,
+		std::vector<bool>& changed, detail::index_sequence<I...>)
+{
+	int dummy[]{ 0, ((changed[I] = UpdateShape(I, hydra::thrust::get<I>(amplitudes))), 0)... };
+
+	(void) dummy;
+}
+
+template<hydra::detail::Backend BACKEND, typename Iterator>
+template<typename Amplitude>
+bool InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>::UpdateShape(size_t i, Amplitude const& amplitude)
+{
+	if( fCouplingRe >= amplitude.GetNumberOfParameters() || fCouplingIm >= amplitude.GetNumberOfParameters() )
+		throw std::invalid_argument("[hydra::InterferenceMatrixIntegrator]: Coupling parameter index out of range. (fCouplingRe or fCouplingIm >= amplitude.GetNumberOfParameters())");
+
+	cache_t& cache = *fCache;
+
+	size_t key = GetShapeKey(amplitude);
+
+	if( cache.fValid[i] && cache.fShapeKeys[i] == key ) return false;
+
+	//shape = amplitude with unit coupling
+	Amplitude shape(amplitude);
+
+	shape.SetParameter(fCouplingRe, 1.0);
+	shape.SetParameter(fCouplingIm, 0.0);
+
+	hydra::thrust::transform(system_t(), fBegin, fEnd, cache.fShapes.begin() + i*fNEvents, shape);
+
+	cache.fShapeKeys[i] = key;
+	cache.fValid[i]     = true;
+
+	return true;
+}
+
+template<hydra::detail::Backend BACKEND, typename Iterator>
+template<size_t K>
+void InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>::UpdateRow(size_t i)
+{
+	cache_t& cache = *fCache;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + fNEvents;
+
+	std::array<GReal_t, 2*K> init{};
+
+	std::array<GReal_t, 2*K> row = hydra::thrust::transform_reduce(system_t(), first, last,
+			detail::InterferenceMatrixRow<K>(
+					hydra::thrust::raw_pointer_cast(cache.fShapes.data()),
+					const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fWeights.data())),
+					fNEvents, i),
+			init, detail::MultiIntegrandPlus<2*K>() );
+
+	//the matrix is hermitian
+	for(size_t j=0; j<K; j++)
+	{
+		hydra::complex<GReal_t> m(row[2*j]/fNEvents, row[2*j+1]/fNEvents);
+
+		cache.fMatrix[i*K + j] = m;
+		cache.fMatrix[j*K + i] = hydra::conj(m);
+	}
+
+	cache.fNRowUpdates++;
+}
+
+template<hydra::detail::Backend BACKEND, typename Iterator>
+template<typename Amplitude>
+size_t InterferenceMatrixIntegrator<hydra::detail::BackendPolicy<BACKEND>, Iterator>::GetShapeKey(Amplitude const& amplitude) const
+{
+	std::vector<GReal_t> parameters;
+
+	for(size_t p=0; p<amplitude.GetNumberOfParameters(); p++)
+		if( p != fCouplingRe && p != fCouplingIm )
+			parameters.push_back(amplitude.GetParameter(p).GetValue());
+
+	return parameters.size() ? detail::hash_range(parameters.begin(), parameters.end()) : 0;
+}
+
+}  // namespace hydra
+
+#endif /* INTERFERENCEMATRIXINTEGRATOR_INL_ */
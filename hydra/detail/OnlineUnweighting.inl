@@ -0,0 +1,167 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * OnlineUnweighting.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef ONLINEUNWEIGHTING_INL_
+#define ONLINEUNWEIGHTING_INL_
+
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/sort.h>
+#include <hydra/detail/external/hydra_thrust/extrema.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+#include <hydra/detail/external/hydra_thrust/partition.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/zip_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+#include <hydra/detail/external/hydra_thrust/system/detail/generic/select_system.h>
+
+namespace hydra {
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename Pointer>
+double OnlineUnweighting<hydra::detail::BackendPolicy<BACKEND>, GRND>::Quantile(Pointer wbegin, size_t n) const
+{
+	auto buffer = hydra::thrust::get_temporary_buffer<double>(system_type(), n);
+
+	hydra::thrust::copy(system_type(), wbegin, wbegin + n, buffer.first);
+	hydra::thrust::sort(system_type(), buffer.first, buffer.first + n);
+
+	size_t index = static_cast<size_t>(fQuantile*n);
+	index = index < n ? index : n-1;
+
+	double quantile = buffer.first[index];
+
+	//heavily populated zero-weight region
+	if( !(quantile > 0.0) ) quantile = buffer.first[n-1];
+
+	hydra::thrust::return_temporary_buffer(system_type(), buffer.first, buffer.second);
+
+	if( !(quantile > 0.0) )
+		throw std::invalid_argument("[hydra::OnlineUnweighting]: Pilot sample without positive weights. (max_weight <= 0)");
+
+	return quantile;
+}
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator>
+double OnlineUnweighting<hydra::detail::BackendPolicy<BACKEND>, GRND>::Pilot(Iterator wbegin, Iterator wend)
+{
+	size_t n = hydra::thrust::distance(wbegin, wend);
+
+	if(n==0)
+		throw std::invalid_argument("[hydra::OnlineUnweighting]: Empty pilot sample. (n==0)");
+
+	auto weights = hydra::thrust::get_temporary_buffer<double>(system_type(), n);
+
+	hydra::thrust::copy(wbegin, wend, weights.first);
+
+	fMaxWeight = fSafetyFactor*Quantile(weights.first, n);
+
+	hydra::thrust::return_temporary_buffer(system_type(), weights.first, weights.second);
+
+	return fMaxWeight;
+}
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename IteratorData, typename IteratorWeight>
+typename std::enable_if<hydra::detail::is_iterator<IteratorData>::value, Range<IteratorData>>::type
+OnlineUnweighting<hydra::detail::BackendPolicy<BACKEND>, GRND>::Unweight(IteratorData data_begin, IteratorData data_end,
+		IteratorWeight weights_begin)
+{
+	size_t n = hydra::thrust::distance(data_begin, data_end);
+
+	auto residuals = hydra::thrust::get_temporary_buffer<double>(system_type(), n);
+
+	auto result = Unweight(data_begin, data_end, weights_begin, residuals.first);
+
+	hydra::thrust::return_temporary_buffer(system_type(), residuals.first, residuals.second);
+
+	return result;
+}
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename IteratorData, typename IteratorWeight, typename IteratorResidual>
+typename std::enable_if<hydra::detail::is_iterator<IteratorData>::value, Range<IteratorData>>::type
+OnlineUnweighting<hydra::detail::BackendPolicy<BACKEND>, GRND>::Unweight(IteratorData data_begin, IteratorData data_end,
+		IteratorWeight weights_begin, IteratorResidual residuals_begin)
+{
+	using hydra::thrust::system::detail::generic::select_system;
+	typedef  typename hydra::thrust::iterator_system<IteratorResidual>::type system_residual_t;
+	system_residual_t system_residual;
+
+	typedef  typename hydra::thrust::detail::remove_reference<
+			decltype(select_system(std::declval<system_type&>(), system_residual ))>::type common_system_t;
+
+	size_t n = hydra::thrust::distance(data_begin, data_end);
+
+	if(n==0) return make_range(data_begin, data_begin);
+
+	//stage the weights: they can be lazily calculated from the data, which is going to be reordered
+	auto weights = hydra::thrust::get_temporary_buffer<double>(system_type(), n);
+
+	hydra::thrust::copy(weights_begin, weights_begin + n, weights.first);
+
+	typedef detail::UnweightingFlag<GRND, decltype(weights.first)> flagger_type;
+
+	//no pilot: the batch is its own pilot
+	if( !(fMaxWeight > 0.0) ) fMaxWeight = fSafetyFactor*Quantile(weights.first, n);
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + n;
+
+	hydra::thrust::transform(common_system_t(), first, last, residuals_begin,
+			flagger_type(fSeed, fJump, fMaxWeight, weights.first));
+
+	detail::StatsUnweighting stats = hydra::thrust::transform_reduce(common_system_t(),
+			hydra::thrust::make_zip_iterator(hydra::thrust::make_tuple(weights.first, residuals_begin)),
+			hydra::thrust::make_zip_iterator(hydra::thrust::make_tuple(weights.first + n, residuals_begin + n)),
+			detail::GetStatsUnweighting(), detail::StatsUnweighting(), detail::AddStatsUnweighting());
+
+	hydra::thrust::return_temporary_buffer(system_type(), weights.first, weights.second);
+
+	auto start  = hydra::thrust::make_zip_iterator(hydra::thrust::make_tuple(data_begin, residuals_begin));
+	auto stop   = hydra::thrust::make_zip_iterator(hydra::thrust::make_tuple(data_end, residuals_begin + n));
+
+	auto middle = hydra::thrust::stable_partition(start, stop, detail::IsAcceptedEvent());
+
+	//book-keeping and overshoot correction of the running maximum
+	fBatchStats.push_back( UnweightingStats(stats, fMaxWeight) );
+
+	fStats = detail::AddStatsUnweighting()(fStats, stats);
+
+	if( stats.fMaxWeight > fMaxWeight ) fMaxWeight = stats.fMaxWeight;
+
+	fJump += n;
+
+	return make_range(data_begin, data_begin + hydra::thrust::distance(start, middle));
+}
+
+}  // namespace hydra
+
+#endif /* ONLINEUNWEIGHTING_INL_ */
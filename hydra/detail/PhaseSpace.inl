@@ -443,14 +443,28 @@ void PhaseSpace<N,GRND>::Generate(hydra::detail::BackendPolicy<BACKEND> const& e
 
 }
 
+template <size_t N, typename GRND>
+template<typename Iterator, hydra::detail::Backend BACKEND>
+void PhaseSpace<N,GRND>::Generate(hydra::detail::BackendPolicy<BACKEND> const& exec_policy, Vector4R const& mother,
+		Iterator begin, Iterator end, size_t offset){
+	/**
+	 * Generate the events with global index in [offset, offset + (end-begin) ), in the same way
+	 * Generate(mother, ...) does for a output range starting at the global index 0.
+	 */
+
+	detail::DecayMother<N,GRND> decayer(mother,fMasses,  fMaxWeight, fECM, fSeed);
+	detail::launch_decayer(exec_policy, begin, end, offset, decayer );
+
+}
+
 
 template <size_t N, typename GRND>
-inline GInt_t PhaseSpace<N,GRND>::GetSeed() const	{
+inline size_t PhaseSpace<N,GRND>::GetSeed() const	{
 	return fSeed;
 }
 
 template <size_t N, typename GRND>
-inline void PhaseSpace<N,GRND>::SetSeed(GInt_t _seed) 	{
+inline void PhaseSpace<N,GRND>::SetSeed(size_t _seed) 	{
 	fSeed=_seed;
 }
 
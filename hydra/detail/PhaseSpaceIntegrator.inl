@@ -29,16 +29,75 @@
 #ifndef PHASESPACEINTEGRATOR_INL_
 #define PHASESPACEINTEGRATOR_INL_
 
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+#include <hydra/detail/external/hydra_thrust/iterator/zip_iterator.h>
+
 namespace hydra {
 
-template <size_t N, hydra::detail::Backend BACKEND, typename GRND>
+template <size_t N, hydra::detail::Backend BACKEND, typename GRND, typename Kinematics>
 template<typename FUNCTOR>
 std::pair<GReal_t, GReal_t>
-PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND>::Integrate(  FUNCTOR  const& functor)
+PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>::Integrate(  FUNCTOR  const& functor)
 {
- return	fGenerator.AverageOn(hydra::detail::BackendPolicy<BACKEND>(),  fMother, functor, fNSamples );
+	//with Kinematics the integrand takes the invariants, which are only available cached
+	if constexpr ( std::is_void<Kinematics>::value )
+	{
+		if( !fSampleCaching )
+			return	fGenerator.AverageOn(hydra::detail::BackendPolicy<BACKEND>(),  fMother, functor, fNSamples );
+	}
+
+	if( !fCache ) GenerateSample();
+
+	if constexpr ( std::is_void<Kinematics>::value )
+	{
+		auto first = hydra::thrust::make_zip_iterator(
+				hydra::thrust::make_tuple( fCache->fWeights.begin(), fCache->fEvents.begin() ));
+
+		detail::StatsPHSP result = hydra::thrust::transform_reduce(system_t(), first, first + fNSamples,
+				detail::phase_space_integrator::WeightedCall<FUNCTOR>(functor),
+				detail::StatsPHSP(), detail::AddStatsPHSP() );
+
+		return std::make_pair(result.fMean, ::sqrt(result.fM2)/result.fW );
+	}
+	else
+	{
+		auto first = hydra::thrust::make_zip_iterator(
+				hydra::thrust::make_tuple( fCache->fWeights.begin(), fCache->fInvariants.begin() ));
+
+		detail::StatsPHSP result = hydra::thrust::transform_reduce(system_t(), first, first + fNSamples,
+				detail::phase_space_integrator::WeightedCall<FUNCTOR>(functor),
+				detail::StatsPHSP(), detail::AddStatsPHSP() );
+
+		return std::make_pair(result.fMean, ::sqrt(result.fM2)/result.fW );
+	}
 }
 
+template <size_t N, hydra::detail::Backend BACKEND, typename GRND, typename Kinematics>
+void PhaseSpaceIntegrator<N,hydra::detail::BackendPolicy<BACKEND>, GRND, Kinematics>::GenerateSample()
+{
+	fCache = std::make_shared<cache_t>(fGenerator.GetMotherMass(), fGenerator.GetMasses());
+
+	fCache->fEvents.resize(fNSamples);
+	fCache->fWeights.resize(fNSamples);
+
+	fGenerator.Generate(system_t(), fMother, fCache->fEvents.begin(), fCache->fEvents.end());
+
+	hydra::thrust::transform(system_t(), fCache->fEvents.begin(), fCache->fEvents.end(),
+			fCache->fWeights.begin(), fCache->fEvents.GetEventWeightFunctor());
+
+	if constexpr ( !std::is_void<Kinematics>::value )
+	{
+		//keep only the invariants
+		fCache->fInvariants.resize(fNSamples);
+
+		hydra::thrust::transform(system_t(), fCache->fEvents.begin(), fCache->fEvents.end(),
+				fCache->fInvariants.begin(), *fKinematics);
+
+		fCache->fEvents.clear();
+		fCache->fEvents.shrink_to_fit();
+	}
+}
 
 }  // namespace hydra
 
@@ -0,0 +1,146 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * PhaseSpaceStream.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup phsp
+ */
+
+#ifndef PHASESPACESTREAM_INL_
+#define PHASESPACESTREAM_INL_
+
+#include <stdexcept>
+
+namespace hydra {
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+void PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::Generate(size_t k, decays_type& buffer)
+{
+	size_t offset = k*fBatchSize;
+
+	buffer.resize( GetBatchSize(k) );
+
+	fPhaseSpace.Generate(system_type(), fMother, buffer.begin(), buffer.end(), offset);
+}
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+void PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::Wait()
+{
+	if( !fPending.valid() ) return;
+
+	try {
+		fPending.get();
+	}
+	catch(...) {
+		//the prefetched buffer is incomplete: the batch is generated again on demand
+		fPrefetched = false;
+		throw;
+	}
+}
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+void PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::Drain() noexcept
+{
+	try {
+		Wait();
+	}
+	catch(...) {}
+}
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+typename PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::decays_type&
+PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::Next()
+{
+	if( !HasNext() )
+		throw std::out_of_range("[hydra::PhaseSpaceStream]: No batches left in the stream. (fNextBatch >= fNBatches)");
+
+	size_t k = fNextBatch;
+
+	//rethrows the error of the prefetch, if any, leaving the batch k to be generated by the next call
+	Wait();
+
+	fNextBatch++;
+
+	if( fPrefetched && fPendingBatch==k ){
+
+		//the batch k was prefetched in the inactive buffer
+		fActive = 1 - fActive;
+	}
+	else Generate(k, fBuffers[fActive]);
+
+	fPrefetched = false;
+
+	if( fDoubleBuffering && HasNext() ){
+
+		fPendingBatch = fNextBatch;
+		fPrefetched   = true;
+
+		fPending = std::async(std::launch::async, [this](size_t next, size_t buffer){
+			this->Generate(next, this->fBuffers[buffer]);
+		}, fNextBatch, 1 - fActive);
+	}
+
+	return fBuffers[fActive];
+}
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+typename PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::decays_type&
+PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::GetBatch(size_t k)
+{
+	if( k >= fNBatches )
+		throw std::out_of_range("[hydra::PhaseSpaceStream]: Batch index out of range. (k >= fNBatches)");
+
+	//the prefetched batch, if any, is kept in the inactive buffer
+	Wait();
+	Generate(k, fBuffers[fActive]);
+
+	return fBuffers[fActive];
+}
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+void PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::Reset(size_t k)
+{
+	Drain();
+	fNextBatch = k;
+}
+
+template<typename ...Particles, hydra::detail::Backend BACKEND, typename GRND>
+template<typename Consumer>
+void PhaseSpaceStream<hydra::tuple<Particles...>, hydra::detail::BackendPolicy<BACKEND>, GRND>::ForEach(Consumer&& consumer)
+{
+	while( HasNext() ){
+
+		size_t k = fNextBatch;
+
+		consumer(k, Next());
+	}
+}
+
+}  // namespace hydra
+
+#endif /* PHASESPACESTREAM_INL_ */
@@ -31,12 +31,17 @@
 //#ifndef PLAIN_INL_
 //#define PLAIN_INL_
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
 namespace hydra {
 
 template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
 template<typename FUNCTOR>
 inline std::pair<GReal_t, GReal_t>
-Plain<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::Integrate(FUNCTOR const& fFunctor)
+Plain<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::IntegrateFixed(FUNCTOR const& fFunctor)
 {
 
 	// create iterators
@@ -58,6 +63,83 @@ Plain<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::Integrate(FUNCTOR const& fF
 
 }
 
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+template<typename FUNCTOR>
+inline std::pair<GReal_t, GReal_t>
+Plain<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::IntegrateAdaptive(FUNCTOR const& fFunctor)
+{
+	if( fBatchSize < 2 )
+		throw std::invalid_argument("[hydra::Plain]: Batch size smaller than two. (fBatchSize < 2)");
+
+	if( fNCalls < 2 )
+		throw std::invalid_argument("[hydra::Plain]: Maximum number of calls smaller than two. (fNCalls < 2)");
+
+	detail::ProcessCallsPlainUnary<FUNCTOR,N,GRND> process_calls(
+			const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fXLow.data())),
+			const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fDeltaX.data())), fSeed, fFunctor);
+
+	fBatches.clear();
+
+	PlainState state;
+
+	auto start = std::chrono::steady_clock::now();
+
+	do {
+
+		// the batch takes the next block of the random number sequence
+		size_t batch_size = std::min(fBatchSize, fNCalls - state.fN);
+
+		hydra::thrust::counting_iterator<size_t> first(state.fN);
+		hydra::thrust::counting_iterator<size_t> last = first + batch_size;
+
+		auto batch_start = std::chrono::steady_clock::now();
+
+		PlainState batch = hydra::thrust::transform_reduce(system_t(), first, last,
+				process_calls, PlainState(), detail::ProcessCallsPlainBinary() );
+
+		auto batch_end = std::chrono::steady_clock::now();
+
+		// merge online
+		state = state.fN ? detail::ProcessCallsPlainBinary()(state, batch) : batch;
+
+		fResult   = fVolume*state.fMean;
+		fAbsError = fVolume*::sqrt( state.fM2/((state.fN-1)*(state.fN-1)) );
+
+		fBatches.push_back( PlainBatch{ state.fN, fResult, fAbsError,
+			std::chrono::duration<GReal_t, std::milli>(batch_end - batch_start).count() } );
+
+	} while( fAbsError > fRelativeError*std::fabs(fResult) && state.fN < fNCalls &&
+			std::chrono::duration<GReal_t, std::milli>(std::chrono::steady_clock::now() - start).count() < fMaxTime );
+
+	return std::make_pair(fResult, fAbsError);
+}
+
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+template<typename FUNCTOR>
+inline detail::multi_integral_t<FUNCTOR>
+Plain<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::MultiIntegrate(FUNCTOR const& fFunctor)
+{
+	constexpr size_t K = detail::multi_integrand_size<FUNCTOR>::value;
+
+	// create iterators
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + fNCalls;
+
+	// compute summary statistics of all integrands over the same points
+	detail::MultiPlainState<K> result = hydra::thrust::transform_reduce(system_t(), first, last,
+			detail::ProcessCallsPlainMultiUnary<FUNCTOR,N,K,GRND>(const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fXLow.data())),
+					const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fDeltaX.data())), fSeed,fFunctor),
+			detail::MultiPlainState<K>(), detail::ProcessCallsPlainMultiBinary<K>() );
+
+	detail::multi_integral_t<FUNCTOR> integrals;
+
+	for(size_t k=0; k<K; k++)
+		integrals[k] = std::make_pair( fVolume*result.fMean[k],
+				fVolume*::sqrt( result.fM2[k]/((fNCalls-1)*(fNCalls-1)) ) );
+
+	return integrals;
+}
+
 }
 
 //#endif /* PLAIN_INL_ */
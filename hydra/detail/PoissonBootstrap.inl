@@ -0,0 +1,169 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * PoissonBootstrap.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef POISSONBOOTSTRAP_INL_
+#define POISSONBOOTSTRAP_INL_
+
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+#include <hydra/detail/external/hydra_thrust/system/detail/generic/select_system.h>
+
+namespace hydra {
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator, typename Functor>
+std::vector<double>
+PoissonBootstrap<hydra::detail::BackendPolicy<BACKEND>, GRND>::Accumulate(Iterator begin, Iterator end,
+		Functor const& functor) const
+{
+	using hydra::thrust::system::detail::generic::select_system;
+	typedef  typename hydra::thrust::iterator_system<Iterator>::type system_data_t;
+	system_data_t system_data;
+
+	typedef  typename hydra::thrust::detail::remove_reference<
+			decltype(select_system(std::declval<system_type&>(), system_data ))>::type common_system_t;
+
+	std::vector<double> sums(2*fNReplicas, 0.0);
+
+	size_t n = hydra::thrust::distance(begin, end);
+
+	if(n==0) return sums;
+
+	size_t chunk       = (n + fNPartitions - 1)/fNPartitions;
+	size_t npartitions = (n + chunk - 1)/chunk;
+
+	auto partials = hydra::thrust::get_temporary_buffer<double>(system_type(), npartitions*2*fNReplicas);
+
+	typedef detail::BootstrapPartialSums<GRND, Iterator, Functor, decltype(partials.first)> accumulator_type;
+
+	hydra::thrust::for_each(common_system_t(),
+			hydra::thrust::counting_iterator<size_t>(0),
+			hydra::thrust::counting_iterator<size_t>(npartitions),
+			accumulator_type(GetWeightFunctor(), begin, functor, partials.first, n, chunk));
+
+	std::vector<double> host_partials(npartitions*2*fNReplicas);
+
+	hydra::thrust::copy(partials.first, partials.first + npartitions*2*fNReplicas, host_partials.begin());
+
+	hydra::thrust::return_temporary_buffer(system_type(), partials.first, partials.second);
+
+	for(size_t p=0; p<npartitions; p++)
+		for(size_t k=0; k<2*fNReplicas; k++)
+			sums[k] += host_partials[p*2*fNReplicas + k];
+
+	//[sums | sums of weights]
+	return sums;
+}
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator, typename Functor>
+typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<double>>::type
+PoissonBootstrap<hydra::detail::BackendPolicy<BACKEND>, GRND>::Sum(Iterator begin, Iterator end,
+		Functor const& functor) const
+{
+	std::vector<double> sums = Accumulate(begin, end, functor);
+
+	sums.resize(fNReplicas);
+
+	return sums;
+}
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator, typename Functor>
+typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<double>>::type
+PoissonBootstrap<hydra::detail::BackendPolicy<BACKEND>, GRND>::Mean(Iterator begin, Iterator end,
+		Functor const& functor) const
+{
+	std::vector<double> sums = Accumulate(begin, end, functor);
+
+	std::vector<double> means(fNReplicas, 0.0);
+
+	for(size_t b=0; b<fNReplicas; b++)
+		means[b] = sums[fNReplicas + b] > 0.0 ? sums[b]/sums[fNReplicas + b] : 0.0;
+
+	return means;
+}
+
+template<hydra::detail::Backend BACKEND, typename GRND>
+template<typename Iterator, typename Functor>
+typename std::enable_if<hydra::detail::is_iterator<Iterator>::value, std::vector<std::vector<double>>>::type
+PoissonBootstrap<hydra::detail::BackendPolicy<BACKEND>, GRND>::Histogram(Iterator begin, Iterator end,
+		size_t nbins, double min, double max, Functor const& functor) const
+{
+	using hydra::thrust::system::detail::generic::select_system;
+	typedef  typename hydra::thrust::iterator_system<Iterator>::type system_data_t;
+	system_data_t system_data;
+
+	typedef  typename hydra::thrust::detail::remove_reference<
+			decltype(select_system(std::declval<system_type&>(), system_data ))>::type common_system_t;
+
+	if(nbins==0)
+		throw std::invalid_argument("[hydra::PoissonBootstrap]: Number of bins is zero. (nbins==0)");
+
+	if(!(max > min))
+		throw std::invalid_argument("[hydra::PoissonBootstrap]: Invalid histogram range. (max <= min)");
+
+	std::vector<std::vector<double>> histograms(fNReplicas, std::vector<double>(nbins, 0.0));
+
+	size_t n = hydra::thrust::distance(begin, end);
+
+	if(n==0) return histograms;
+
+	size_t chunk       = (n + fNPartitions - 1)/fNPartitions;
+	size_t npartitions = (n + chunk - 1)/chunk;
+	size_t size        = fNReplicas*nbins;
+
+	auto partials = hydra::thrust::get_temporary_buffer<double>(system_type(), npartitions*size);
+
+	typedef detail::BootstrapPartialHistogram<GRND, Iterator, Functor, decltype(partials.first)> accumulator_type;
+
+	hydra::thrust::for_each(common_system_t(),
+			hydra::thrust::counting_iterator<size_t>(0),
+			hydra::thrust::counting_iterator<size_t>(npartitions),
+			accumulator_type(GetWeightFunctor(), begin, functor, partials.first, n, chunk, nbins, min, max));
+
+	std::vector<double> host_partials(npartitions*size);
+
+	hydra::thrust::copy(partials.first, partials.first + npartitions*size, host_partials.begin());
+
+	hydra::thrust::return_temporary_buffer(system_type(), partials.first, partials.second);
+
+	for(size_t p=0; p<npartitions; p++)
+		for(size_t b=0; b<fNReplicas; b++)
+			for(size_t k=0; k<nbins; k++)
+				histograms[b][k] += host_partials[p*size + b*nbins + k];
+
+	return histograms;
+}
+
+}  // namespace hydra
+
+#endif /* POISSONBOOTSTRAP_INL_ */
@@ -0,0 +1,194 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * QuasiMonteCarlo.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef QUASIMONTECARLO_INL_
+#define QUASIMONTECARLO_INL_
+
+#include <hydra/detail/external/hydra_thrust/functional.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/random.h>
+
+#include <cmath>
+#include <memory>
+
+namespace hydra {
+
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+void QuasiMonteCarlo<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::Initialize()
+{
+	typedef detail::sobol_lattice<uint_least64_t, N, 64u, default_sobol_table> lattice_t;
+
+	// the lattice holds N*64 64-bit words, keep it off the stack
+	std::unique_ptr<lattice_t> lattice(new lattice_t());
+
+	/*
+	 * only the 32 leading bits of the first 32 direction numbers
+	 * contribute to the first 2^32 points of the sequence
+	 */
+	std::vector<uint32_t> directions(32*N);
+
+	for(size_t bit=0; bit<32; bit++)
+		for(size_t j=0; j<N; j++)
+			directions[bit*N + j] = uint32_t( lattice->GetBits()[bit*N + j] >> 32 );
+
+	fDirections = directions;
+}
+
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+size_t QuasiMonteCarlo<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::GenerateSeeds(uint_vector_t& seeds) const
+{
+	if( fNRandomizations < 2 )
+		throw std::invalid_argument("[hydra::QuasiMonteCarlo]: At least two randomizations are needed to estimate the error. (fNRandomizations < 2)");
+
+	size_t npoints = fNCalls/fNRandomizations;
+
+	if( npoints == 0 )
+		throw std::invalid_argument("[hydra::QuasiMonteCarlo]: Number of calls smaller than the number of randomizations. (fNCalls < fNRandomizations)");
+
+	if( fChunkSize == 0 )
+		throw std::invalid_argument("[hydra::QuasiMonteCarlo]: Chunk size is zero. (fChunkSize==0)");
+
+	if( npoints > (size_t(1)<<32) )
+		throw std::invalid_argument("[hydra::QuasiMonteCarlo]: Number of points per randomization above 2^32. (fNCalls/fNRandomizations > 2^32)");
+
+	// seeds of the randomizations, [randomization*N + dimension]
+	std::vector<uint32_t> seeds_h(fNRandomizations*N);
+
+	GRND randEng(fSeed);
+	hydra::thrust::uniform_int_distribution<uint32_t> uniDist(0, 0xFFFFFFFFu);
+
+	for(auto& seed: seeds_h) seed = uniDist(randEng);
+
+	seeds = seeds_h;
+
+	return npoints;
+}
+
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+std::pair<GReal_t, GReal_t>
+QuasiMonteCarlo<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::Combine(std::vector<GReal_t> const& estimates) const
+{
+	GReal_t mean = 0.0;
+	for(auto estimate: estimates) mean += estimate;
+	mean /= fNRandomizations;
+
+	GReal_t variance = 0.0;
+	for(auto estimate: estimates) variance += (estimate - mean)*(estimate - mean);
+	variance /= (fNRandomizations*(fNRandomizations - 1));
+
+	return std::make_pair(mean, ::sqrt(variance));
+}
+
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+template<typename FUNCTOR>
+inline std::pair<GReal_t, GReal_t>
+QuasiMonteCarlo<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::Integrate(FUNCTOR const& fFunctor)
+{
+	uint_vector_t seeds;
+
+	size_t npoints = GenerateSeeds(seeds);
+
+	// each call processes a chunk of consecutive points
+	size_t nchunks = (npoints + fChunkSize - 1)/fChunkSize;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + nchunks;
+
+	std::vector<GReal_t> estimates(fNRandomizations);
+
+	for(size_t r=0; r<fNRandomizations; r++)
+	{
+		detail::ProcessCallsQuasiMonteCarlo<FUNCTOR,N> process_calls(
+				const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fXLow.data())),
+				const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fDeltaX.data())),
+				const_cast<uint32_t*>(hydra::thrust::raw_pointer_cast(fDirections.data())),
+				hydra::thrust::raw_pointer_cast(seeds.data()) + r*N,
+				fOwenScrambling, npoints, fChunkSize, fFunctor);
+
+		GReal_t sum = hydra::thrust::transform_reduce(system_t(), first, last,
+				process_calls, GReal_t(0.0), hydra::thrust::plus<GReal_t>() );
+
+		estimates[r] = fVolume*sum/npoints;
+	}
+
+	auto result = Combine(estimates);
+
+	fResult   = result.first;
+	fAbsError = result.second;
+
+	return result;
+}
+
+template< size_t N,hydra::detail::Backend BACKEND, typename GRND>
+template<typename FUNCTOR>
+inline detail::multi_integral_t<FUNCTOR>
+QuasiMonteCarlo<N,hydra::detail::BackendPolicy<BACKEND>,GRND>::MultiIntegrate(FUNCTOR const& fFunctor)
+{
+	constexpr size_t K = detail::multi_integrand_size<FUNCTOR>::value;
+
+	typedef std::array<GReal_t, K> sum_t;
+
+	uint_vector_t seeds;
+
+	size_t npoints = GenerateSeeds(seeds);
+
+	size_t nchunks = (npoints + fChunkSize - 1)/fChunkSize;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + nchunks;
+
+	// estimates of each integrand, [integrand][randomization]
+	std::vector<std::vector<GReal_t>> estimates(K, std::vector<GReal_t>(fNRandomizations));
+
+	for(size_t r=0; r<fNRandomizations; r++)
+	{
+		detail::ProcessCallsQuasiMonteCarlo<FUNCTOR,N,sum_t> process_calls(
+				const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fXLow.data())),
+				const_cast<GReal_t*>(hydra::thrust::raw_pointer_cast(fDeltaX.data())),
+				const_cast<uint32_t*>(hydra::thrust::raw_pointer_cast(fDirections.data())),
+				hydra::thrust::raw_pointer_cast(seeds.data()) + r*N,
+				fOwenScrambling, npoints, fChunkSize, fFunctor);
+
+		sum_t sum = hydra::thrust::transform_reduce(system_t(), first, last,
+				process_calls, sum_t{}, detail::MultiIntegrandPlus<K>() );
+
+		for(size_t k=0; k<K; k++)
+			estimates[k][r] = fVolume*sum[k]/npoints;
+	}
+
+	detail::multi_integral_t<FUNCTOR> integrals;
+
+	for(size_t k=0; k<K; k++)
+		integrals[k] = Combine(estimates[k]);
+
+	return integrals;
+}
+
+}  // namespace hydra
+
+#endif /* QUASIMONTECARLO_INL_ */
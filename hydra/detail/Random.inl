@@ -431,6 +431,103 @@ sample( Iterable&& output ,
 			_min, _max, functor, seed, rng_jump );
 }
 
+template<typename RNG, typename DerivedPolicy, typename Functor, typename Iterator, size_t N,
+hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterator<Iterator>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterator>())>::value,
+Range<Iterator> >::type
+sample(hydra::thrust::detail::execution_policy_base<DerivedPolicy>  const& policy,
+		Iterator begin, Iterator end, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed, size_t rng_jump)
+{
+	typedef double value_type;
+
+	typedef hydra::thrust::pointer<value_type,  DerivedPolicy> pointer_type;
+
+	typedef detail::RndFlag<value_type, pointer_type, RNG> flagger_type;
+
+	typedef detail::RndTrialVegas<value_type, RNG, Functor, N, pointer_type> sampler_type;
+
+	if( grid.GetNBins() < 2 )
+		throw std::invalid_argument("[hydra::sample]: Vegas grid is not initialized. (nbins < 2)");
+
+    size_t ntrials = hydra::thrust::distance( begin, end);
+
+    size_t nxi = (grid.GetNBins() + 1)*N;
+
+    //stage the grid in the memory space of the policy
+    auto xi = hydra::thrust::get_temporary_buffer<value_type>(policy, nxi);
+
+    hydra::thrust::copy(grid.GetXi().begin(), grid.GetXi().begin() + nxi, xi.first);
+
+    auto values = hydra::thrust::get_temporary_buffer<value_type>(policy, ntrials);
+
+	// create iterators
+	hydra::thrust::counting_iterator<size_t> first(0);
+	hydra::thrust::counting_iterator<size_t> last = first + ntrials;
+
+	//calculate the ratios between the functor and the grid density
+	hydra::thrust::transform(policy, first, last, begin, values.first,
+			sampler_type(seed, rng_jump, functor, xi.first, grid.GetNBins(), grid.GetXLow(), grid.GetXUp()));
+
+	//get the maximum value
+	value_type max_value = *( hydra::thrust::max_element(policy,values.first, values.first+ values.second) );
+
+	Iterator r = hydra::thrust::partition(policy, begin, end, first,
+			flagger_type(seed+1337, rng_jump, max_value, values.first) );
+
+	// deallocate storage with hydra::thrust::return_temporary_buffer
+	hydra::thrust::return_temporary_buffer(policy, values.first, values.second);
+	hydra::thrust::return_temporary_buffer(policy, xi.first, xi.second);
+
+	return  make_range(begin , r);
+}
+
+template<typename RNG, typename Functor, typename Iterator, hydra::detail::Backend BACKEND,
+size_t N, hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterator<Iterator>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterator>())>::value,
+Range<Iterator> >::type
+sample(hydra::detail::BackendPolicy<BACKEND> const& policy,
+		Iterator begin, Iterator end, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed, size_t rng_jump)
+{
+	return sample<RNG>(policy.backend, begin, end, grid, functor, seed, rng_jump );
+}
+
+template<typename RNG, typename Functor, typename Iterator, size_t N,
+hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterator<Iterator>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterator>())>::value,
+Range<Iterator> >::type
+sample(Iterator begin, Iterator end, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed, size_t rng_jump)
+{
+	typedef  typename hydra::thrust::iterator_system<Iterator>::type   system_type;
+
+	return	sample<RNG>(system_type(), begin, end, grid, functor, seed, rng_jump );
+}
+
+template<typename RNG, typename Functor, typename Iterable, size_t N,
+hydra::detail::Backend BACKEND2>
+typename std::enable_if<
+detail::random::is_callable<Functor>::value  &&
+detail::random::is_iterable<Iterable>::value &&
+detail::is_tuple_type< decltype(*std::declval<Iterable>().begin())>::value ,
+Range< decltype(std::declval<Iterable>().begin())>>::type
+sample( Iterable&& output, VegasState<N, hydra::detail::BackendPolicy<BACKEND2>> const& grid,
+		Functor const& functor, size_t seed, size_t rng_jump)
+{
+	return	sample<RNG>(std::forward<Iterable>(output).begin(), std::forward<Iterable>(output).end(),
+			grid, functor, seed, rng_jump );
+}
+
 
 
 }//namespace hydra
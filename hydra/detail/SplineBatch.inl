@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * SplineBatch.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SPLINEBATCH_INL_
+#define SPLINEBATCH_INL_
+
+#include <hydra/device/System.h>
+#include <hydra/functions/SplineTableFunctor.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+
+#include <array>
+#include <vector>
+
+namespace hydra {
+
+namespace detail {
+
+namespace spline {
+
+template<typename Iterator>
+inline std::vector<double> to_vector(Iterator first, Iterator last)
+{
+	std::vector<double> v(hydra::thrust::distance(first, last));
+
+	hydra::thrust::copy(first, last, v.begin());
+
+	return v;
+}
+
+template<typename ...ArgTypes, size_t N, typename IteratorM, typename IteratorP, typename IteratorR>
+inline IteratorR batch(std::array<std::vector<double>, N> const& abscissae, IteratorM measurements,
+		IteratorP begin, IteratorP end, IteratorR result, bool sort)
+{
+	size_t npoints = 1;
+
+	for(auto const& x: abscissae) npoints *= x.size();
+
+	SplineTableFunctor<hydra::device::sys_t, ArgTypes...> table(abscissae, to_vector(measurements, measurements + npoints));
+
+	result = table.Interpolate(begin, end, result, sort);
+
+	table.Dispose();
+
+	return result;
+}
+
+}  // namespace spline
+
+}  // namespace detail
+
+template<typename Iterator1, typename Iterator2, typename IteratorP, typename IteratorR>
+inline typename  std::enable_if<
+                    std::is_convertible<typename hydra::thrust::iterator_traits<Iterator1>::value_type, double >::value &&
+                    std::is_convertible<typename hydra::thrust::iterator_traits<Iterator2>::value_type, double >::value &&
+                    std::is_convertible<typename hydra::thrust::iterator_traits<IteratorP>::value_type, double >::value,
+                    IteratorR >::type
+spline(Iterator1 first, Iterator1 last,  Iterator2 measurements, IteratorP begin, IteratorP end, IteratorR result, bool sort)
+{
+	std::array<std::vector<double>, 1> abscissae{ detail::spline::to_vector(first, last) };
+
+	return detail::spline::batch<double>(abscissae, measurements, begin, end, result, sort);
+}
+
+template<typename IteratorX, typename IteratorY, typename IteratorM, typename IteratorP, typename IteratorR>
+inline typename std::enable_if<
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorX>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorY>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorM>::value_type, double >::value &&
+	detail::is_tuple_type<typename hydra::thrust::iterator_traits<IteratorP>::value_type>::value,
+	IteratorR>::type
+spline2D(IteratorX firstx, IteratorX lastx, IteratorY firsty, IteratorY lasty, IteratorM measurements,
+		IteratorP begin, IteratorP end, IteratorR result, bool sort)
+{
+	std::array<std::vector<double>, 2> abscissae{ detail::spline::to_vector(firstx, lastx),
+		detail::spline::to_vector(firsty, lasty) };
+
+	return detail::spline::batch<double, double>(abscissae, measurements, begin, end, result, sort);
+}
+
+template<typename IteratorX, typename IteratorY, typename IteratorZ, typename IteratorM, typename IteratorP, typename IteratorR>
+inline typename std::enable_if<
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorX>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorY>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorZ>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorM>::value_type, double >::value &&
+	detail::is_tuple_type<typename hydra::thrust::iterator_traits<IteratorP>::value_type>::value,
+	IteratorR>::type
+spline3D(IteratorX firstx, IteratorX lastx, IteratorY firsty, IteratorY lasty, IteratorZ firstz, IteratorZ lastz,
+		IteratorM measurements, IteratorP begin, IteratorP end, IteratorR result, bool sort)
+{
+	std::array<std::vector<double>, 3> abscissae{ detail::spline::to_vector(firstx, lastx),
+		detail::spline::to_vector(firsty, lasty), detail::spline::to_vector(firstz, lastz) };
+
+	return detail::spline::batch<double, double, double>(abscissae, measurements, begin, end, result, sort);
+}
+
+template<typename IteratorX, typename IteratorY, typename IteratorW, typename IteratorZ, typename IteratorM,
+          typename IteratorP, typename IteratorR>
+inline typename std::enable_if<
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorX>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorY>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorW>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorZ>::value_type, double >::value &&
+	std::is_convertible<typename hydra::thrust::iterator_traits<IteratorM>::value_type, double >::value &&
+	detail::is_tuple_type<typename hydra::thrust::iterator_traits<IteratorP>::value_type>::value,
+	IteratorR>::type
+spline4D(IteratorX firstx, IteratorX lastx, IteratorY firsty, IteratorY lasty, IteratorW firstw, IteratorW lastw,
+		IteratorZ firstz, IteratorZ lastz, IteratorM measurements, IteratorP begin, IteratorP end, IteratorR result, bool sort)
+{
+	std::array<std::vector<double>, 4> abscissae{ detail::spline::to_vector(firstx, lastx),
+		detail::spline::to_vector(firsty, lasty), detail::spline::to_vector(firstw, lastw),
+		detail::spline::to_vector(firstz, lastz) };
+
+	return detail::spline::batch<double, double, double, double>(abscissae, measurements, begin, end, result, sort);
+}
+
+}  // namespace hydra
+
+#endif /* SPLINEBATCH_INL_ */
@@ -0,0 +1,238 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * SplineTable.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SPLINETABLE_INL_
+#define SPLINETABLE_INL_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+
+#include <math.h>
+#include <vector>
+
+namespace hydra {
+
+namespace detail {
+
+namespace spline {
+
+/*
+ * Steffen slope at an interior node, from the secants s_im, s_i of the adjacent intervals of widths h_im, h_i.
+ */
+__hydra_host__ __hydra_device__
+inline double steffen_slope(double s_im, double s_i, double h_im, double h_i)
+{
+	double p = (s_im*h_i + s_i*h_im)/(h_im + h_i);
+
+	double m = ::fabs(s_im) < ::fabs(s_i) ? ::fabs(s_im) : ::fabs(s_i);
+	m = m < 0.5*::fabs(p) ? m : 0.5*::fabs(p);
+
+	return (::copysign(1.0, s_im) + ::copysign(1.0, s_i))*m;
+}
+
+/*
+ * Steffen slope at a border node, from the secant s_near of the border interval, of width h_near,
+ * and the secant s_far of the next one, of width h_far.
+ */
+__hydra_host__ __hydra_device__
+inline double steffen_border_slope(double s_near, double s_far, double h_near, double h_far)
+{
+	double p = s_near*(1.0 + h_near/(h_near + h_far)) - s_far*h_near/(h_near + h_far);
+
+	double m = ::fabs(s_near) < 0.5*::fabs(p) ? ::fabs(s_near) : 0.5*::fabs(p);
+
+	return (::copysign(1.0, p) + ::copysign(1.0, s_near))*m;
+}
+
+/*
+ * Steffen spline in the interval [X[1], X[2]] = [x_i, x_{i+1}] of a grid of n nodes, from the nodes X[0..3] = x_{i-1..i+2}
+ * and the values Y[0..3]. The nodes beyond the grid are not read. Grids of two nodes are interpolated linearly.
+ */
+__hydra_host__ __hydra_device__
+inline double steffen_local(size_t i, size_t n, const double (&X)[4], const double (&Y)[4], double value)
+{
+	double h_i = X[2] - X[1];
+	double s_i = (Y[2] - Y[1])/h_i;
+
+	double c_i  = s_i;
+	double c_ip = s_i;
+
+	if( n > 2 ){
+
+		c_i  = i==0 ? steffen_border_slope(s_i, (Y[3] - Y[2])/(X[3] - X[2]), h_i, X[3] - X[2])
+				    : steffen_slope((Y[1] - Y[0])/(X[1] - X[0]), s_i, X[1] - X[0], h_i);
+
+		c_ip = i + 2==n ? steffen_border_slope(s_i, (Y[1] - Y[0])/(X[1] - X[0]), h_i, X[1] - X[0])
+				        : steffen_slope(s_i, (Y[3] - Y[2])/(X[3] - X[2]), h_i, X[3] - X[2]);
+	}
+
+	double a = (c_i + c_ip - 2.0*s_i)/(h_i*h_i);
+	double b = (3.0*s_i - 2.0*c_i - c_ip)/h_i;
+	double u = value - X[1];
+
+	return ((a*u + b)*u + c_i)*u + Y[1];
+}
+
+/*
+ * Last of the count nodes x[first, first + count) not above value, or first.
+ */
+__hydra_host__ __hydra_device__
+inline size_t bisect(const double* x, size_t first, size_t count, double value)
+{
+	while( count > 1 ){
+
+		size_t step = count/2;
+
+		if( x[first + step] <= value ){
+			first += step;
+			count -= step;
+		}
+		else count = step;
+	}
+
+	return first;
+}
+
+/*
+ * Interval [x[i], x[i+1]] of the n nodes x holding value, clamped to [0, n-2]. Uniform nodes, of first node x0 and
+ * inverse spacing invh, are located directly, the others by binary search.
+ */
+__hydra_host__ __hydra_device__
+inline size_t locate(const double* x, size_t n, bool uniform, double x0, double invh, double value)
+{
+	if( uniform ){
+
+		double u = (value - x0)*invh;
+
+		return u <= 0.0 ? 0 : u >= double(n - 2) ? n - 2 : size_t(u);
+	}
+
+	return bisect(x, 0, n - 1, value);
+}
+
+/*
+ * As above, searching from the interval hint, usually the one of the previous point: the bracket is widened
+ * by steps of 1, 2, 4, ... nodes in the direction of value (galloping), and then bisected. Points in the
+ * interval hint or in the next one are located with two or three comparisons, and a point k intervals away
+ * costs O(log k) instead of O(log n).
+ */
+__hydra_host__ __hydra_device__
+inline size_t locate(const double* x, size_t n, bool uniform, double x0, double invh, double value, size_t hint)
+{
+	if( uniform ) return locate(x, n, uniform, x0, invh, value);
+
+	size_t lo = hint < n - 1 ? hint : n - 2;
+	size_t step = 1;
+
+	if( x[lo] <= value ){
+
+		while( lo + step < n - 1 && x[lo + step] <= value ){
+			lo   += step;
+			step *= 2;
+		}
+
+		size_t hi = lo + step < n - 1 ? lo + step : n - 1;
+
+		return bisect(x, lo, hi - lo, value);
+	}
+
+	size_t hi = lo;
+
+	while( hi >= step && x[hi - step] > value ){
+		hi   -= step;
+		step *= 2;
+	}
+
+	lo = hi >= step ? hi - step : 0;
+
+	return bisect(x, lo, hi - lo, value);
+}
+
+/*
+ * Value of the cubic of interleaved coefficients {a, b, c, d}, at the distance u from the lower node of its interval.
+ */
+__hydra_host__ __hydra_device__
+inline double horner(const double* coefficients, double u)
+{
+	return ((coefficients[0]*u + coefficients[1])*u + coefficients[2])*u + coefficients[3];
+}
+
+/*
+ * Integral of the cubic of interleaved coefficients {a, b, c, d} from the lower node of its interval up to the distance u.
+ */
+__hydra_host__ __hydra_device__
+inline double primitive(const double* coefficients, double u)
+{
+	return (((0.25*coefficients[0]*u + coefficients[1]/3.0)*u + 0.5*coefficients[2])*u + coefficients[3])*u;
+}
+
+/*
+ * Coefficients {a, b, c, d} of the Steffen spline y = ((a*u + b)*u + c)*u + d, u = x - x_i, in each of
+ * the n-1 intervals of the nodes x[0, n), for the values y[0, n), appended to table.
+ */
+inline void steffen_coefficients(const double* x, size_t n, const double* y, std::vector<double>& table)
+{
+	std::vector<double> h(n - 1), s(n - 1), slope(n);
+
+	for(size_t i=0; i+1<n; i++){
+
+		h[i] = x[i + 1] - x[i];
+		s[i] = (y[i + 1] - y[i])/h[i];
+	}
+
+	if( n==2 ){
+
+		slope[0] = s[0];
+		slope[1] = s[0];
+	}
+	else {
+
+		slope[0]     = steffen_border_slope(s[0], s[1], h[0], h[1]);
+		slope[n - 1] = steffen_border_slope(s[n - 2], s[n - 3], h[n - 2], h[n - 3]);
+
+		for(size_t i=1; i+1<n; i++)
+			slope[i] = steffen_slope(s[i - 1], s[i], h[i - 1], h[i]);
+	}
+
+	for(size_t i=0; i+1<n; i++){
+
+		table.push_back( (slope[i] + slope[i + 1] - 2.0*s[i])/(h[i]*h[i]) );
+		table.push_back( (3.0*s[i] - 2.0*slope[i] - slope[i + 1])/h[i] );
+		table.push_back( slope[i] );
+		table.push_back( y[i] );
+	}
+}
+
+}  // namespace spline
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* SPLINETABLE_INL_ */
@@ -44,8 +44,10 @@
 #include <utility>
 
 //thrust
-#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
-#include <hydra/detail/external/hydra_thrust/sort.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
 
 
 #define USE_ORIGINAL_CHISQ_FORMULA 0
@@ -59,6 +61,14 @@ std::pair<GReal_t, GReal_t>
 Vegas<N,hydra::detail::BackendPolicy<BACKEND>, GRND >::Integrate(FUNCTOR const& fFunctor )
 {
 
+	//warm start: reuse the available grid
+	if( fState.IsWarmStart() && fState.IsGridTrained() ){
+
+		fState.SetStage(1);
+
+		return IntegIterator(fFunctor, 0 );
+	}
+
 	fState.SetStage(0);
 
 	auto temp = IntegIterator(fFunctor, 1 );
@@ -147,11 +157,6 @@ Vegas<N,hydra::detail::BackendPolicy<BACKEND>, GRND >::IntegIterator(FUNCTOR con
 
 	cum_int = 0.0;
 	cum_sig = 0.0;
-	size_t nkeys  = N*fState.GetCalls(training);
-	fFValInput.resize(nkeys);
-	fGlobalBinInput.resize(nkeys);
-	fFValOutput.resize(nkeys);
-	fGlobalBinOutput.resize(nkeys);
 
 	//for (size_t it = 0; it < fState.GetIterations()+fState.GetTrainingIterations(); it++)
 
@@ -309,11 +314,7 @@ Vegas<N,hydra::detail::BackendPolicy<BACKEND>, GRND >::IntegIterator(FUNCTOR con
 	 estimates based on the same grid, although it may be rebinned. */
 
 	fState.SetStage(1);
-
-	fFValInput=rvector_backend();
-	fGlobalBinInput=uvector_backend();
-	fFValOutput=rvector_backend();
-	fGlobalBinOutput=uvector_backend();
+	fState.SetGridTrained(1);
 
 	return std::make_pair(cum_int, cum_sig);
 
@@ -605,40 +606,65 @@ void Vegas<N,hydra::detail::BackendPolicy<BACKEND>, GRND >::ProcessFuncionCalls(
 {
 	typedef hydra::detail::BackendPolicy<BACKEND> system_t;
 	size_t ncalls = fState.GetCalls(training);
-	size_t nkeys  = N*fState.GetCalls(training);
+	size_t nbins  = fState.GetNBins();
+
+	/*
+	 * the calls are split in partitions, each one filling a private
+	 * copy of the grid distribution, that are merged afterwards.
+	 */
+	size_t npartitions = fState.GetNPartitions();
+
+	if(npartitions == 0)
+	{
+		size_t max_partitions = detail::vegas::max_distribution_size/(N*nbins);
+
+		npartitions = (ncalls + detail::vegas::CallsPerPartition<BACKEND>::value - 1)/detail::vegas::CallsPerPartition<BACKEND>::value;
+		npartitions = npartitions < max_partitions ? npartitions : max_partitions;
+		npartitions = npartitions > 0 ? npartitions : 1;
+	}
+
+	size_t calls_per_partition = (ncalls + npartitions - 1)/npartitions;
+	npartitions = (ncalls + calls_per_partition - 1)/calls_per_partition;
 
 	// create iterators
 	hydra::thrust::counting_iterator<size_t> first(0);
-	hydra::thrust::counting_iterator<size_t> last = first + ncalls;
+	hydra::thrust::counting_iterator<size_t> last = first + npartitions;
 
 
 	fState.CopyStateToDevice();
 
+	auto distributions = hydra::thrust::get_temporary_buffer<GReal_t>(system_t(), npartitions*N*nbins);
+	auto results = hydra::thrust::get_temporary_buffer<detail::ResultVegas>(system_t(), npartitions);
 
-	detail::ResultVegas init = detail::ResultVegas();
-	detail::ResultVegas result = hydra::thrust::transform_reduce(system_t(), first, last,
+	hydra::thrust::for_each(system_t(), first, last,
 			detail::ProcessCallsVegas<FUNCTOR,N,system_t ,rvector_iterator,
-			uvector_iterator , GRND>(ncalls, fState, fGlobalBinInput.begin(),fFValInput.begin(), fFunctor)
-	, init,	detail::ProcessBoxesVegas());
+			decltype(distributions.first), decltype(results.first), GRND>(ncalls, calls_per_partition,
+					fState, distributions.first, results.first, fFunctor) );
 
+	// the private distributions are merged on the back end, so that only N*nbins entries are copied
+	auto distribution = hydra::thrust::get_temporary_buffer<GReal_t>(system_t(), N*nbins);
 
-	/*
-	for(size_t i=0; i< hydra::thrust::distance( fGlobalBinInput.begin(),fGlobalBinInput.end() ); i++)
-			std::cout <<"<< " << i << " " << fGlobalBinInput[i] << " " << fFValInput[i] << std::endl;
-	 */
+	hydra::thrust::transform(system_t(), first, first + N*nbins, distribution.first,
+			detail::SumDistributionsVegas<decltype(distributions.first)>(distributions.first, npartitions, N*nbins) );
 
-	hydra::thrust::sort_by_key(system_t(),fGlobalBinInput.begin(),fGlobalBinInput.end(), fFValInput.begin());
-	/*
-	for(size_t i=0; i< hydra::thrust::distance( fGlobalBin.begin(),fGlobalBin.end() ); i++)
-		std::cout <<"<< " << i << " " << fGlobalBin[i] << " " << fFVal[i] << std::endl;
-	 */
+	std::vector<GReal_t> host_distribution(N*nbins);
+	std::vector<detail::ResultVegas> host_results(npartitions);
+
+	hydra::thrust::copy(distribution.first, distribution.first + N*nbins, host_distribution.begin());
+	hydra::thrust::copy(results.first, results.first + npartitions, host_results.begin());
+
+	hydra::thrust::return_temporary_buffer(system_t(), distributions.first, distributions.second);
+	hydra::thrust::return_temporary_buffer(system_t(), distribution.first, distribution.second);
+	hydra::thrust::return_temporary_buffer(system_t(), results.first, results.second);
 
-	auto end_iterators = hydra::thrust::reduce_by_key(system_t(),fGlobalBinInput.begin(),fGlobalBinInput.end(),fFValInput.begin(),
-			fGlobalBinOutput.begin(),  fFValOutput.begin());
+	detail::ResultVegas result = host_results[0];
 
+	for(size_t p=1; p< npartitions; p++)
+		result = detail::ProcessBoxesVegas()(result, host_results[p]);
 
+	for(size_t k=0; k< N*nbins; k++)
+		fState.GetDistribution()[k] += host_distribution[k];
 
-	hydra::thrust::copy( fFValOutput.begin(), end_iterators.second, fState.GetDistribution().begin());
 	integral=result.fMean*result.fN  ;
 	tss=::sqrt( result.fM2 );
 
@@ -60,6 +60,9 @@ VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::VegasState(std::array<GRea
 		fCallsPerBox(0),
 		fCalls(5000),
 		fTrainingCalls(5000),
+		fNPartitions(0),
+		fWarmStart(0),
+		fGridTrained(0),
 		fMaxError(0.5e-3),
 		fUseRelativeError(kTrue),
 		fOStream(std::cout),
@@ -117,6 +120,9 @@ VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::VegasState(const GReal_t x
 		fCallsPerBox(0),
 		fCalls(5000),
 		fTrainingCalls(5000),
+		fNPartitions(0),
+		fWarmStart(0),
+		fGridTrained(0),
 		fMaxError(0.5e-3),
 		fUseRelativeError(kTrue),
 		fOStream(std::cout),
@@ -176,6 +182,9 @@ VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::VegasState(VegasState<N,hy
 		fCallsPerBox(other.GetCallsPerBox()),
 		fCalls(other.GetCalls()),
 		fTrainingCalls(other.GetTrainingCalls()),
+		fNPartitions(other.GetNPartitions()),
+		fWarmStart(other.IsWarmStart()),
+		fGridTrained(other.IsGridTrained()),
 		fDeltaX(other.GetDeltaX()),
 		fDistribution(other.GetDistribution()),
 		fXi(other.GetXi()),
@@ -225,6 +234,9 @@ VegasState( VegasState<N, hydra::detail::BackendPolicy <BACKEND2>> const& other)
 		fCallsPerBox(other.GetCallsPerBox()),
 		fCalls(other.GetCalls()),
 		fTrainingCalls(other.GetTrainingCalls()),
+		fNPartitions(other.GetNPartitions()),
+		fWarmStart(other.IsWarmStart()),
+		fGridTrained(other.IsGridTrained()),
 		fDeltaX(other.GetDeltaX()),
 		fDistribution(other.GetDistribution()),
 		fXi(other.GetXi()),
@@ -277,6 +289,9 @@ VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::operator=(VegasState<N,hyd
 		fCallsPerBox=other.GetCallsPerBox();
 		fCalls=other.GetCalls();
 		fTrainingCalls=other.GetTrainingCalls();
+		fNPartitions=other.GetNPartitions();
+		fWarmStart=other.IsWarmStart();
+		fGridTrained=other.IsGridTrained();
 		fDeltaX=other.GetDeltaX();
 		fDistribution=other.GetDistribution();
 		fXi=other.GetXi();
@@ -332,6 +347,9 @@ VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::operator=( VegasState<N, h
 		fCallsPerBox=other.GetCallsPerBox();
 		fCalls=other.GetCalls();
 		fTrainingCalls=other.GetTrainingCalls();
+		fNPartitions=other.GetNPartitions();
+		fWarmStart=other.IsWarmStart();
+		fGridTrained=other.IsGridTrained();
 		fDeltaX=other.GetDeltaX();
 		fDistribution=other.GetDistribution();
 		fXi=other.GetXi();
@@ -366,6 +384,112 @@ void VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::ClearStoredIterations
 	fFunctionCallsDuration.clear();
 
 }
+
+/*
+ * Grid file layout (native endianness):
+ * magic "HYDVEGAS", uint32 version, uint64 dimensions, uint64 bins,
+ * double lower limits[N], double upper limits[N], double xi[(bins+1)*N].
+ */
+template<size_t N , hydra::detail::Backend BACKEND>
+void VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::SaveGrid(std::ostream& stream) const
+{
+	const char magic[8] = {'H','Y','D','V','E','G','A','S'};
+	uint32_t version    = 1;
+	uint64_t dimensions = N;
+	uint64_t bins       = fNBins;
+
+	stream.write(magic, 8);
+	stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	stream.write(reinterpret_cast<const char*>(&dimensions), sizeof(dimensions));
+	stream.write(reinterpret_cast<const char*>(&bins), sizeof(bins));
+	stream.write(reinterpret_cast<const char*>(fXLow.data()), N*sizeof(GReal_t));
+	stream.write(reinterpret_cast<const char*>(fXUp.data()), N*sizeof(GReal_t));
+	stream.write(reinterpret_cast<const char*>(fXi.data()), (fNBins+1)*N*sizeof(GReal_t));
+
+	if(!stream)
+		throw std::runtime_error("[hydra::VegasState]: Failed to write the grid. (!stream)");
+}
+
+template<size_t N , hydra::detail::Backend BACKEND>
+void VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::LoadGrid(std::istream& stream)
+{
+	char magic[8];
+	uint32_t version    = 0;
+	uint64_t dimensions = 0;
+	uint64_t bins       = 0;
+
+	stream.read(magic, 8);
+	stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+	stream.read(reinterpret_cast<char*>(&dimensions), sizeof(dimensions));
+	stream.read(reinterpret_cast<char*>(&bins), sizeof(bins));
+
+	if(!stream || std::string(magic, 8) != "HYDVEGAS" || version != 1)
+		throw std::invalid_argument("[hydra::VegasState]: Input is not a Vegas grid. (magic != HYDVEGAS)");
+
+	if(dimensions != N)
+		throw std::invalid_argument("[hydra::VegasState]: Grid dimension mismatch. (dimensions != N)");
+
+	if(bins == 0 || bins > fNBinsMax)
+		throw std::invalid_argument("[hydra::VegasState]: Number of bins out of range. (bins == 0 || bins > fNBinsMax)");
+
+	std::vector<GReal_t> xlow(N), xup(N), xi((bins+1)*N);
+
+	stream.read(reinterpret_cast<char*>(xlow.data()), N*sizeof(GReal_t));
+	stream.read(reinterpret_cast<char*>(xup.data()), N*sizeof(GReal_t));
+	stream.read(reinterpret_cast<char*>(xi.data()), (bins+1)*N*sizeof(GReal_t));
+
+	if(!stream)
+		throw std::invalid_argument("[hydra::VegasState]: Truncated Vegas grid. (!stream)");
+
+	//the grid is defined relative to the integration region
+	for(size_t i=0; i<N; i++)
+	{
+		if( ::fabs(xlow[i] - fXLow[i]) > 1.0e-12*(1.0 + ::fabs(fXLow[i])) ||
+			::fabs(xup[i] - fXUp[i]) > 1.0e-12*(1.0 + ::fabs(fXUp[i])) )
+			throw std::invalid_argument("[hydra::VegasState]: Grid integration limits mismatch. (xlow != fXLow || xup != fXUp)");
+	}
+
+	GReal_t volume = 1.0;
+
+	for(size_t i=0; i<N; i++)
+	{
+		fDeltaX[i] = fXUp[i] - fXLow[i];
+		volume *= fDeltaX[i];
+	}
+
+	std::copy(xi.begin(), xi.end(), fXi.begin());
+
+	fNBins  = bins;
+	fVolume = volume;
+	fStage  = 1;
+	fGridTrained = 1;
+
+	SendGridToBackend();
+	CopyStateToDevice();
+}
+
+template<size_t N , hydra::detail::Backend BACKEND>
+void VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::SaveGrid(std::string const& filename) const
+{
+	std::ofstream file(filename, std::ios::binary);
+
+	if(!file)
+		throw std::runtime_error("[hydra::VegasState]: Failed to open the grid file for writing. (!file)");
+
+	SaveGrid(file);
+}
+
+template<size_t N , hydra::detail::Backend BACKEND>
+void VegasState<N, hydra::detail::BackendPolicy<BACKEND>>::LoadGrid(std::string const& filename)
+{
+	std::ifstream file(filename, std::ios::binary);
+
+	if(!file)
+		throw std::invalid_argument("[hydra::VegasState]: Failed to open the grid file for reading. (!file)");
+
+	LoadGrid(file);
+}
+
 }
 
 #endif /* VEGASSTATE_INL_ */
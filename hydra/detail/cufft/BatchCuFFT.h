@@ -0,0 +1,110 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * BatchCuFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef BATCHCUFFT_H_
+#define BATCHCUFFT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/BatchFFT.h>
+
+#include <map>
+
+//CuFFT
+#include <cufft.h>
+
+//Hydra wrappers
+#include<hydra/detail/cufft/WrappersCuFFT.h>
+
+namespace hydra {
+
+namespace detail {
+
+namespace convolution {
+
+/*
+ * cuFFT runs the whole batch through one batched plan, cached per batch size,
+ * directly on the sequences in device memory.
+ */
+template<typename T>
+class BatchFFT<T, detail::CuFFT>
+{
+	typedef hydra::complex<T> complex_type;
+	typedef typename std::conditional< std::is_same<double,T>::value,
+			cufft::_Planner<CUFFT_Z2Z>, cufft::_Planner<CUFFT_C2C> >::type planner_type;
+
+public:
+
+	BatchFFT(size_t n, int sign):
+		fN(n),
+		fSign(sign)
+	{}
+
+	BatchFFT(BatchFFT<T, detail::CuFFT> const&)=delete;
+
+	BatchFFT<T, detail::CuFFT>& operator=(BatchFFT<T, detail::CuFFT> const&)=delete;
+
+	~BatchFFT()
+	{
+		for(auto& plan: fPlans)
+			cufft::_PlanDestroyer()(plan.second);
+	}
+
+	template<typename Policy>
+	inline void Execute(Policy, const complex_type* input, complex_type* output, size_t batch)
+	{
+		if(batch == 0) return;
+
+		auto search = fPlans.find(batch);
+
+		if(search == fPlans.end())
+			search = fPlans.emplace(batch, planner_type()(int(fN), int(batch))).first;
+
+		cufft::_PlanExecutor()(search->second, const_cast<complex_type*>(input), output, fSign);
+	}
+
+	inline size_t GetSize() const {
+		return fN;
+	}
+
+private:
+
+	size_t fN;
+	int    fSign;
+	std::map<size_t, cufftHandle> fPlans;
+};
+
+}  // namespace convolution
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* BATCHCUFFT_H_ */
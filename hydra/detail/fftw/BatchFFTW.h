@@ -0,0 +1,158 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * BatchFFTW.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef BATCHFFTW_H_
+#define BATCHFFTW_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/BatchFFT.h>
+
+#include <map>
+#include <stdexcept>
+
+//FFTW3
+#include <fftw3.h>
+
+//Hydra wrappers
+#include<hydra/detail/fftw/WrappersFFTW.h>
+
+namespace hydra {
+
+namespace detail {
+
+namespace fftw {
+
+/*
+ * advanced-interface plans of batches of contiguous one dimensional complex transforms
+ */
+struct _ManyPlanner
+{
+	inline fftw_plan operator()(int n, int batch, hydra::complex<double>* in, hydra::complex<double>* out, int sign)
+	{
+		return fftw_plan_many_dft(1, &n, batch,
+				reinterpret_cast<fftw_complex*>(in),  NULL, 1, n,
+				reinterpret_cast<fftw_complex*>(out), NULL, 1, n,
+				sign, FFTW_ESTIMATE | FFTW_UNALIGNED);
+	}
+
+	inline fftwf_plan operator()(int n, int batch, hydra::complex<float>* in, hydra::complex<float>* out, int sign)
+	{
+		return fftwf_plan_many_dft(1, &n, batch,
+				reinterpret_cast<fftwf_complex*>(in),  NULL, 1, n,
+				reinterpret_cast<fftwf_complex*>(out), NULL, 1, n,
+				sign, FFTW_ESTIMATE | FFTW_UNALIGNED);
+	}
+};
+
+struct _ManyExecutor
+{
+	inline void operator()(fftw_plan plan, hydra::complex<double>* in, hydra::complex<double>* out)
+	{
+		fftw_execute_dft(plan, reinterpret_cast<fftw_complex*>(in), reinterpret_cast<fftw_complex*>(out));
+	}
+
+	inline void operator()(fftwf_plan plan, hydra::complex<float>* in, hydra::complex<float>* out)
+	{
+		fftwf_execute_dft(plan, reinterpret_cast<fftwf_complex*>(in), reinterpret_cast<fftwf_complex*>(out));
+	}
+};
+
+}  // namespace fftw
+
+namespace convolution {
+
+/*
+ * FFTW runs the whole batch through one plan of the advanced interface, cached per batch size.
+ * The plans are made unaligned, so that they can be executed on the arrays of any call.
+ */
+template<typename T>
+class BatchFFT<T, detail::FFTW>
+{
+	typedef hydra::complex<T> complex_type;
+	typedef typename std::conditional<std::is_same<T, double>::value, fftw_plan, fftwf_plan>::type plan_type;
+
+public:
+
+	BatchFFT(size_t n, int sign):
+		fN(n),
+		fSign(sign)
+	{}
+
+	BatchFFT(BatchFFT<T, detail::FFTW> const&)=delete;
+
+	BatchFFT<T, detail::FFTW>& operator=(BatchFFT<T, detail::FFTW> const&)=delete;
+
+	~BatchFFT()
+	{
+		for(auto& plan: fPlans)
+			fftw::_PlanDestroyer()(plan.second);
+	}
+
+	template<typename Policy>
+	inline void Execute(Policy, const complex_type* input, complex_type* output, size_t batch)
+	{
+		if(batch == 0) return;
+
+		complex_type* in = const_cast<complex_type*>(input);
+
+		auto search = fPlans.find(batch);
+
+		if(search == fPlans.end())
+		{
+			plan_type plan = fftw::_ManyPlanner()(int(fN), int(batch), in, output, fSign);
+
+			if(!plan)
+				throw std::runtime_error("[hydra::BatchFFT]: can not allocate fftw_plan.");
+
+			search = fPlans.emplace(batch, plan).first;
+		}
+
+		fftw::_ManyExecutor()(search->second, in, output);
+	}
+
+	inline size_t GetSize() const {
+		return fN;
+	}
+
+private:
+
+	size_t fN;
+	int    fSign;
+	std::map<size_t, plan_type> fPlans;
+};
+
+}  // namespace convolution
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* BATCHFFTW_H_ */
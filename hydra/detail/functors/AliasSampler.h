@@ -0,0 +1,186 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * AliasSampler.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup random
+ */
+
+
+#ifndef ALIASSAMPLER_H_
+#define ALIASSAMPLER_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
+#include <hydra/detail/external/hydra_thrust/random.h>
+
+#include <array>
+
+namespace hydra{
+
+namespace detail {
+
+/**
+ * Draws the global bin index of a Walker/Vose alias table.
+ * Each call consumes a fixed block of random numbers, starting at
+ * (index + jump)*NDraws, so that sample `index` is reproducible in isolation.
+ */
+template<typename GRND, typename IteratorProb, typename IteratorAlias, size_t NDraws>
+struct AliasIndex
+{
+
+	AliasIndex(size_t seed, size_t jump, size_t nbins,
+			IteratorProb probabilities, IteratorAlias aliases ):
+		fSeed(seed),
+		fJump(jump),
+		fNBins(nbins),
+		fProbabilities(probabilities),
+		fAliases(aliases)
+	{}
+
+	__hydra_host__ __hydra_device__
+	AliasIndex( AliasIndex<GRND, IteratorProb, IteratorAlias, NDraws> const& other):
+		fSeed(other.fSeed),
+		fJump(other.fJump),
+		fNBins(other.fNBins),
+		fProbabilities(other.fProbabilities),
+		fAliases(other.fAliases)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline size_t GetBin(GRND& randEng) const
+	{
+		hydra::thrust::uniform_real_distribution<double> dist(0.0, 1.0);
+
+		size_t column = static_cast<size_t>( dist(randEng)*fNBins );
+		column = column < fNBins ? column : fNBins-1;
+
+		return dist(randEng) < fProbabilities[column] ? column : size_t(fAliases[column]);
+	}
+
+	__hydra_host__ __hydra_device__
+	inline size_t operator()(size_t index) const
+	{
+		GRND randEng(fSeed);
+		randEng.discard( (index + fJump)*NDraws );
+
+		return GetBin(randEng);
+	}
+
+	size_t fSeed;
+	size_t fJump;
+	size_t fNBins;
+	IteratorProb  fProbabilities;
+	IteratorAlias fAliases;
+};
+
+/**
+ * Draws a point distributed according to a histogram, represented by an alias table.
+ * The bin is picked in O(1) through the alias table and the point is
+ * uniformly distributed inside the bin.
+ */
+template<size_t N, typename GRND, typename IteratorProb, typename IteratorAlias>
+struct AliasSampler
+{
+	typedef AliasIndex<GRND, IteratorProb, IteratorAlias, N+2> index_type;
+
+	typedef typename std::conditional< N==1, double,
+			typename hydra::detail::tuple_type<N, double>::type >::type return_type;
+
+	AliasSampler(size_t seed, size_t jump, size_t nbins,
+			IteratorProb probabilities, IteratorAlias aliases,
+			std::array<size_t, N> const& grid,
+			std::array<double, N> const& lowerlimits,
+			std::array<double, N> const& upperlimits ):
+		fIndex(seed, jump, nbins, probabilities, aliases)
+	{
+		for(size_t i=0; i<N; i++){
+			fGrid[i]  = grid[i];
+			fLowerLimits[i] = lowerlimits[i];
+			fDelta[i] = (upperlimits[i] - lowerlimits[i])/grid[i];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	AliasSampler( AliasSampler<N, GRND, IteratorProb, IteratorAlias> const& other):
+		fIndex(other.fIndex)
+	{
+		for(size_t i=0; i<N; i++){
+			fGrid[i]  = other.fGrid[i];
+			fLowerLimits[i] = other.fLowerLimits[i];
+			fDelta[i] = other.fDelta[i];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	inline return_type operator()(size_t index) const
+	{
+		GRND randEng(fIndex.fSeed);
+		randEng.discard( (index + fIndex.fJump)*(N+2) );
+
+		size_t bin = fIndex.GetBin(randEng);
+
+		hydra::thrust::uniform_real_distribution<double> dist(0.0, 1.0);
+
+		//k = i_1*(dim_2*...*dim_n) + i_2*(dim_3*...*dim_n) + ... + i_{n-1}*dim_n + i_n
+		double x[N];
+		for(size_t i=N; i>0; i--){
+
+			size_t j = bin%fGrid[i-1];
+			bin /= fGrid[i-1];
+
+			x[i-1] = fLowerLimits[i-1] + (j + dist(randEng))*fDelta[i-1];
+		}
+
+		return get_point(x);
+	}
+
+private:
+
+	template<size_t M=N>
+	__hydra_host__ __hydra_device__
+	inline typename std::enable_if<M==1, return_type>::type
+	get_point(double (&x)[N]) const { return x[0]; }
+
+	template<size_t M=N>
+	__hydra_host__ __hydra_device__
+	inline typename std::enable_if<(M>1), return_type>::type
+	get_point(double (&x)[N]) const { return hydra::detail::arrayToTuple<double, N>(&x[0]); }
+
+	index_type fIndex;
+	size_t fGrid[N];
+	double fLowerLimits[N];
+	double fDelta[N];
+};
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* ALIASSAMPLER_H_ */
@@ -33,6 +33,7 @@
 #include <hydra/detail/Config.h>
 #include <hydra/detail/BackendPolicy.h>
 #include <hydra/Types.h>
+#include <hydra/detail/utility/SortingNetwork.h>
 
 #include <hydra/Vector3R.h>
 #include <hydra/Vector4R.h>
@@ -97,29 +98,6 @@ struct AverageMothers
 		return ::sqrt( (a - b - c) * (a + b + c) * (a - b + c) * (a + b - c) ) / (2 * a);;
 	}
 
-	__hydra_host__ __hydra_device__ void bbsort(GReal_t *array, GInt_t n)
-	{
-		// Improved bubble sort
-		for (GInt_t c = 0; c < n; c++)
-		{
-			GInt_t nswap = 0;
-
-			for (GInt_t d = 0; d < n - c - 1; d++)
-			{
-				if (array[d] > array[d + 1]) /* For decreasing order use < */
-				{
-					GReal_t swap = array[d];
-					array[d] = array[d + 1];
-					array[d + 1] = swap;
-					nswap++;
-				}
-			}
-			if (nswap == 0)
-				break;
-		}
-
-	}
-
 	__hydra_host__   __hydra_device__ inline
 	constexpr static size_t hash(const size_t a, const size_t b)
 		{
@@ -152,7 +130,7 @@ struct AverageMothers
 //#pragma unroll N
 			for (size_t n = 1; n < N - 1; n++)
 				rno[n] = uniDist(randEng) ;
-			    bbsort(&rno[1], N - 2);
+			    hydra::detail::sort_network<N-2>(&rno[1]);
 
 		}
 
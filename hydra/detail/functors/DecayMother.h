@@ -37,6 +37,7 @@
 //hydra
 #include <hydra/detail/Config.h>
 #include <hydra/Types.h>
+#include <hydra/detail/utility/SortingNetwork.h>
 
 #include <hydra/Vector3R.h>
 #include <hydra/Vector4R.h>
@@ -125,32 +126,6 @@ struct DecayMother
 		return ::sqrt( (a - b - c) * (a + b + c) * (a - b + c) * (a + b - c) ) / (2 * a);
 	}
 
-	__hydra_host__ __hydra_device__ inline
-	void bbsort( GReal_t *array, GInt_t n)
-	{
-		// Improved bubble sort
-
-		for (GInt_t c = 0; c < n; c++)
-		{
-			GInt_t nswap = 0;
-
-			for (GInt_t d = 0; d < n - c - 1; d++)
-			{
-				if (array[d] > array[d + 1]) /* For decreasing order use < */
-				{
-					GReal_t swap = array[d];
-					array[d] = array[d + 1];
-					array[d + 1] = swap;
-					nswap++;
-				}
-			}
-			if (nswap == 0)
-				break;
-		}
-
-	}
-
-
 	__hydra_host__   __hydra_device__ inline
 	constexpr static size_t hash(const size_t a, const size_t b)
 	{
@@ -181,7 +156,7 @@ struct DecayMother
 
 			}
 
-			bbsort(&rno[1], N -2);
+			hydra::detail::sort_network<N-2>(&rno[1]);
 
 		}
 
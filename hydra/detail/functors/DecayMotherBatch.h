@@ -0,0 +1,239 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * DecayMotherBatch.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef DECAYMOTHERBATCH_H_
+#define DECAYMOTHERBATCH_H_
+
+//hydra
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/utility/SortingNetwork.h>
+#include <hydra/Vector4R.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
+#include <hydra/detail/functors/DecayMother.h>
+//thrust
+#include <hydra/detail/external/hydra_thrust/random.h>
+
+namespace hydra {
+
+namespace detail {
+
+/**
+ * Generates a block of L consecutive events per call, with the same
+ * random numbers and kinematics as DecayMother. The intermediate four-vectors
+ * are kept in structure-of-arrays form, with the events of the block in the
+ * innermost dimension, so that the Raubold-Lynch rotations and boosts
+ * are applied lane-wise and can be vectorized by the compiler.
+ * The arithmetic follows DecayMother operation by operation, so both
+ * functors produce the same bits unless the compiler contracts the
+ * multiply-adds into FMAs differently in the two paths (e.g. -march=native
+ * without -ffp-contract=off). Then they agree up to rounding.
+ */
+template <size_t N, typename GRND, typename Iterator, size_t L=8>
+struct DecayMotherBatch
+{
+	typedef typename tuple_type<N, hydra::Vector4R>::type particles_tuple_type;
+
+	static constexpr size_t block_size = L;
+
+	DecayMotherBatch(DecayMother<N, GRND> const& decayer, Iterator output, size_t offset, size_t nevents):
+		fDecayer(decayer),
+		fOutput(output),
+		fOffset(offset),
+		fNEvents(nevents)
+	{}
+
+	__hydra_host__ __hydra_device__
+	DecayMotherBatch( DecayMotherBatch<N, GRND, Iterator, L> const& other ):
+		fDecayer(other.fDecayer),
+		fOutput(other.fOutput),
+		fOffset(other.fOffset),
+		fNEvents(other.fNEvents)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t block)
+	{
+		//number of random numbers per event
+		constexpr size_t NR = N > 2 ? 3*N - 4 : 2*N - 2;
+
+		size_t first = block*L;
+		size_t lanes = fNEvents - first < L ? fNEvents - first : L;
+
+		GReal_t rnd[NR][L];
+		GReal_t invMas[N][L];
+		GReal_t pd[N][L];
+
+		GReal_t E[N][L], X[N][L], Y[N][L], Z[N][L];
+
+		//---> random numbers, in the same order as DecayMother
+		for (size_t l = 0; l < L; l++)
+		{
+			GRND randEng(fDecayer.fSeed);
+			randEng.discard(fOffset + first + (l < lanes ? l : 0) + 3*N);
+			hydra::thrust::uniform_real_distribution<GReal_t> uniDist(0.0, 1.0);
+
+			GReal_t rno[N];
+			rno[0] = 0.0;
+			rno[N - 1] = 1.0;
+
+			for (size_t n = 1; n < N - 1; n++)
+				rno[n] = uniDist(randEng);
+
+			hydra::detail::sort_network<N-2>(&rno[1]);
+
+			GReal_t sum = 0.0;
+
+			for (size_t n = 0; n < N; n++)
+			{
+				sum += fDecayer.fMasses[n];
+				invMas[n][l] = rno[n] * fDecayer.fECM + sum;
+			}
+
+			for (size_t r = 0; r < 2*N - 2; r++)
+				rnd[r][l] = uniDist(randEng);
+		}
+
+		//---> momenta in the rest frames
+		for (size_t n = 0; n < N - 1; n++)
+		{
+			GReal_t m = fDecayer.fMasses[n + 1];
+
+			for (size_t l = 0; l < L; l++)
+				pd[n][l] = DecayMother<N, GRND>::pdk(invMas[n + 1][l], invMas[n][l], m);
+		}
+
+		//---> Raubold-Lynch method
+		for (size_t l = 0; l < L; l++)
+		{
+			E[0][l] = ::sqrt(pd[0][l] * pd[0][l] + fDecayer.fMasses[0] * fDecayer.fMasses[0]);
+			X[0][l] = 0.0;
+			Y[0][l] = pd[0][l];
+			Z[0][l] = 0.0;
+		}
+
+		for (size_t i = 1; i < N; i++)
+		{
+			GReal_t m2 = fDecayer.fMasses[i] * fDecayer.fMasses[i];
+
+			for (size_t l = 0; l < L; l++)
+			{
+				E[i][l] = ::sqrt(pd[i - 1][l] * pd[i - 1][l] + m2);
+				X[i][l] = 0.0;
+				Y[i][l] = -pd[i - 1][l];
+				Z[i][l] = 0.0;
+			}
+
+			GReal_t cZ[L], sZ[L], cY[L], sY[L];
+
+			for (size_t l = 0; l < L; l++)
+			{
+				cZ[l] = 2 * rnd[2*(i - 1)][l] - 1;
+				sZ[l] = ::sqrt(1 - cZ[l] * cZ[l]);
+
+				GReal_t angY = 2 * PI * rnd[2*(i - 1) + 1][l];
+				cY[l] = ::cos(angY);
+				sY[l] = ::sin(angY);
+			}
+
+			for (size_t j = 0; j <= i; j++)
+			{
+				for (size_t l = 0; l < L; l++)
+				{
+					// rotation around Z
+					GReal_t x = cZ[l] * X[j][l] - sZ[l] * Y[j][l];
+					Y[j][l]   = sZ[l] * X[j][l] + cZ[l] * Y[j][l];
+
+					// rotation around Y
+					X[j][l] = cY[l] * x - sY[l] * Z[j][l];
+					Z[j][l] = sY[l] * x + cY[l] * Z[j][l];
+				}
+			}
+
+			if (i == (N - 1))
+				break;
+
+			// boost along Y, with the coefficients and the operation order of
+			// Vector4R::applyBoostTo(Vector3R(0, beta, 0)), so the lanes reproduce
+			// the scalar functor. A null boost leaves the lane untouched.
+			GReal_t gamma[L], gbeta[L], gb2yy[L];
+
+			for (size_t l = 0; l < L; l++)
+			{
+				GReal_t beta = pd[i][l] / ::sqrt(pd[i][l] * pd[i][l] + invMas[i][l] * invMas[i][l]);
+				GReal_t b2   = beta * beta;
+				bool boost   = b2 > 0.0 && b2 < 1.0;
+
+				gamma[l] = boost ? 1.0 / ::sqrt(1.0 - b2) : 1.0;
+				gbeta[l] = boost ? gamma[l] * beta : 0.0;
+				gb2yy[l] = boost ? ((gamma[l] - 1.0) / b2) * b2 : 0.0;
+			}
+
+			for (size_t j = 0; j <= i; j++)
+			{
+				for (size_t l = 0; l < L; l++)
+				{
+					GReal_t e = E[j][l];
+					GReal_t y = Y[j][l];
+
+					E[j][l] = gamma[l] * e + gbeta[l] * y;
+					Y[j][l] = gbeta[l] * e + gb2yy[l] * y + y;
+				}
+			}
+		}
+
+		//---> final boost of all particles to the mother's frame and store
+		for (size_t l = 0; l < lanes; l++)
+		{
+			Vector4R particles[N];
+
+			for (size_t n = 0; n < N; n++)
+			{
+				particles[n].set(E[n][l], X[n][l], Y[n][l], Z[n][l]);
+				particles[n].applyBoostTo(Vector3R(fDecayer.fBeta0, fDecayer.fBeta1, fDecayer.fBeta2));
+			}
+
+			particles_tuple_type event{};
+
+			assignArrayToTuple(event, particles);
+
+			fOutput[first + l] = event;
+		}
+	}
+
+	DecayMother<N, GRND> fDecayer;
+	Iterator fOutput;
+	size_t   fOffset;
+	size_t   fNEvents;
+};
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* DECAYMOTHERBATCH_H_ */
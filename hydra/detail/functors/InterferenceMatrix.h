@@ -0,0 +1,152 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * InterferenceMatrix.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+#ifndef INTERFERENCEMATRIX_H_
+#define INTERFERENCEMATRIX_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/PlainState.h>
+
+#include <array>
+
+namespace hydra {
+
+namespace detail {
+
+/*
+ * Contribution of the event `index` to the row fRow of the interference matrix,
+ * w*s_row*conj(s_j), for j in [0, K). The shapes are stored as [amplitude*fNEvents + event].
+ * The real and imaginary parts are returned interleaved, to be reduced with MultiIntegrandPlus<2K>.
+ */
+template<size_t K>
+struct InterferenceMatrixRow
+{
+	InterferenceMatrixRow(hydra::complex<GReal_t>* shapes, GReal_t* weights, size_t nevents, size_t row):
+		fNEvents(nevents),
+		fRow(row),
+		fShapes(shapes),
+		fWeights(weights)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	InterferenceMatrixRow(InterferenceMatrixRow<K> const& other):
+		fNEvents(other.fNEvents),
+		fRow(other.fRow),
+		fShapes(other.fShapes),
+		fWeights(other.fWeights)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	std::array<GReal_t, 2*K> operator()(size_t index) const
+	{
+		hydra::complex<GReal_t> s = fWeights[index]*fShapes[fRow*fNEvents + index];
+
+		std::array<GReal_t, 2*K> result;
+
+		for(size_t j=0; j<K; j++)
+		{
+			hydra::complex<GReal_t> p = s*hydra::conj(fShapes[j*fNEvents + index]);
+
+			result[2*j]   = p.real();
+			result[2*j+1] = p.imag();
+		}
+
+		return result;
+	}
+
+	size_t fNEvents;
+	size_t fRow;
+	hydra::complex<GReal_t>* __restrict__ fShapes;
+	GReal_t* __restrict__ fWeights;
+};
+
+/*
+ * Value of the model w*|sum_i c_i s_i|^2 at the event `index`, packed in a PlainState
+ * to estimate the statistical error of the normalization.
+ */
+template<size_t K>
+struct InterferenceMatrixCall
+{
+	InterferenceMatrixCall(hydra::complex<GReal_t>* shapes, GReal_t* weights, size_t nevents,
+			std::array<hydra::complex<GReal_t>, K> const& couplings):
+		fNEvents(nevents),
+		fShapes(shapes),
+		fWeights(weights)
+	{
+		for(size_t i=0; i<K; i++)
+			fCouplings[i] = couplings[i];
+	}
+
+	__hydra_host__ __hydra_device__ inline
+	InterferenceMatrixCall(InterferenceMatrixCall<K> const& other):
+		fNEvents(other.fNEvents),
+		fShapes(other.fShapes),
+		fWeights(other.fWeights)
+	{
+		for(size_t i=0; i<K; i++)
+			fCouplings[i] = other.fCouplings[i];
+	}
+
+	__hydra_host__ __hydra_device__ inline
+	PlainState operator()(size_t index) const
+	{
+		hydra::complex<GReal_t> amplitude(0.0, 0.0);
+
+		for(size_t i=0; i<K; i++)
+			amplitude += fCouplings[i]*fShapes[i*fNEvents + index];
+
+		GReal_t fval = fWeights[index]*hydra::norm(amplitude);
+
+		PlainState result;
+		result.fN    = 1;
+		result.fMin  = fval;
+		result.fMax  = fval;
+		result.fMean = fval;
+		result.fM2   = 0;
+
+		return result;
+	}
+
+	size_t fNEvents;
+	hydra::complex<GReal_t>* __restrict__ fShapes;
+	GReal_t* __restrict__ fWeights;
+	hydra::complex<GReal_t> fCouplings[K];
+};
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* INTERFERENCEMATRIX_H_ */
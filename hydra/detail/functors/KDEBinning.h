@@ -0,0 +1,386 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * KDEBinning.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef KDEBINNING_H_
+#define KDEBINNING_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Tuple.h>
+
+#include <math.h>
+#include <array>
+
+namespace hydra {
+
+namespace detail {
+
+namespace kde {
+
+/**
+ * Count, sum, sum of squares, minimum and maximum of a sample.
+ */
+struct Moments
+{
+	__hydra_host__ __hydra_device__
+	Moments():
+		fN(0.0),
+		fSum(0.0),
+		fSum2(0.0),
+		fMin( HUGE_VAL),
+		fMax(-HUGE_VAL)
+	{}
+
+	__hydra_host__ __hydra_device__
+	Moments(double x):
+		fN(1.0),
+		fSum(x),
+		fSum2(x*x),
+		fMin(x),
+		fMax(x)
+	{}
+
+	__hydra_host__ __hydra_device__
+	Moments(Moments const& other):
+		fN(other.fN),
+		fSum(other.fSum),
+		fSum2(other.fSum2),
+		fMin(other.fMin),
+		fMax(other.fMax)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline Moments& operator=(Moments const& other)
+	{
+		if(this == &other) return *this;
+
+		fN    = other.fN;
+		fSum  = other.fSum;
+		fSum2 = other.fSum2;
+		fMin  = other.fMin;
+		fMax  = other.fMax;
+
+		return *this;
+	}
+
+	double fN;
+	double fSum;
+	double fSum2;
+	double fMin;
+	double fMax;
+};
+
+struct MomentsTransform
+{
+	template<typename T>
+	__hydra_host__ __hydra_device__
+	inline Moments operator()(T const& x) const
+	{
+		return Moments(double(x));
+	}
+};
+
+struct MomentsPlus
+{
+	__hydra_host__ __hydra_device__
+	inline Moments operator()(Moments const& a, Moments const& b) const
+	{
+		Moments r;
+
+		r.fN    = a.fN + b.fN;
+		r.fSum  = a.fSum + b.fSum;
+		r.fSum2 = a.fSum2 + b.fSum2;
+		r.fMin  = a.fMin < b.fMin ? a.fMin : b.fMin;
+		r.fMax  = a.fMax > b.fMax ? a.fMax : b.fMax;
+
+		return r;
+	}
+};
+
+/**
+ * Selects the values below a threshold.
+ */
+struct LessThan
+{
+	LessThan(double x):
+		fX(x)
+	{}
+
+	__hydra_host__ __hydra_device__
+	LessThan(LessThan const& other):
+		fX(other.fX)
+	{}
+
+	template<typename T>
+	__hydra_host__ __hydra_device__
+	inline bool operator()(T const& x) const
+	{
+		return double(x) < fX;
+	}
+
+	double fX;
+};
+
+/**
+ * Linear binning of the events of one partition on the grid g_j = fMin + j*fDelta, j in [0, fNPoints).
+ * Each event is shared between the two nearest grid points, in proportion to its distance to the other one.
+ * Events outside the grid are dropped. The partial counts of the partition p are stored in
+ * [p*fNPoints, (p+1)*fNPoints).
+ */
+template<typename Iterator, typename Pointer>
+struct LinearBinning
+{
+	LinearBinning(Iterator data, Pointer partials, size_t nentries, size_t chunk,
+			size_t npoints, double min, double delta):
+		fData(data),
+		fPartials(partials),
+		fNEntries(nentries),
+		fChunk(chunk),
+		fNPoints(npoints),
+		fMin(min),
+		fDelta(delta)
+	{}
+
+	__hydra_host__ __hydra_device__
+	LinearBinning(LinearBinning<Iterator, Pointer> const& other):
+		fData(other.fData),
+		fPartials(other.fPartials),
+		fNEntries(other.fNEntries),
+		fChunk(other.fChunk),
+		fNPoints(other.fNPoints),
+		fMin(other.fMin),
+		fDelta(other.fDelta)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t partition)
+	{
+		Pointer counts = fPartials + partition*fNPoints;
+
+		for(size_t j=0; j<fNPoints; j++)
+			counts[j] = 0.0;
+
+		size_t first = partition*fChunk;
+		size_t last  = first + fChunk < fNEntries ? first + fChunk : fNEntries;
+
+		double upper = double(fNPoints - 1);
+
+		for(size_t i=first; i<last; i++){
+
+			double u = (double(fData[i]) - fMin)/fDelta;
+
+			if( !(u >= 0.0) || u > upper ) continue;
+
+			size_t j = size_t(u);
+			double f = u - double(j);
+
+			counts[j] += 1.0 - f;
+
+			if( j + 1 < fNPoints ) counts[j + 1] += f;
+		}
+	}
+
+	Iterator fData;
+	Pointer  fPartials;
+	size_t   fNEntries;
+	size_t   fChunk;
+	size_t   fNPoints;
+	double   fMin;
+	double   fDelta;
+};
+
+/**
+ * Coordinates of a point of one, two or three dimensions, stored as a scalar or a tuple.
+ */
+template<typename T>
+__hydra_host__ __hydra_device__
+inline void coordinates(T const& point, double (&x)[1])
+{
+	x[0] = point;
+}
+
+template<typename T>
+__hydra_host__ __hydra_device__
+inline void coordinates(T const& point, double (&x)[2])
+{
+	x[0] = hydra::thrust::get<0>(point);
+	x[1] = hydra::thrust::get<1>(point);
+}
+
+template<typename T>
+__hydra_host__ __hydra_device__
+inline void coordinates(T const& point, double (&x)[3])
+{
+	x[0] = hydra::thrust::get<0>(point);
+	x[1] = hydra::thrust::get<1>(point);
+	x[2] = hydra::thrust::get<2>(point);
+}
+
+/**
+ * Coordinate of a point along one axis, to build transform iterators over the marginals.
+ */
+template<size_t N>
+struct AxisCoordinate
+{
+	AxisCoordinate(size_t axis):
+		fAxis(axis)
+	{}
+
+	__hydra_host__ __hydra_device__
+	AxisCoordinate(AxisCoordinate<N> const& other):
+		fAxis(other.fAxis)
+	{}
+
+	template<typename T>
+	__hydra_host__ __hydra_device__
+	inline double operator()(T const& point) const
+	{
+		double x[N];
+		coordinates(point, x);
+
+		return x[fAxis];
+	}
+
+	size_t fAxis;
+};
+
+/**
+ * Multilinear binning of the events of one partition on the regular grid of fNPoints[a] points
+ * fMin[a] + j*fDelta[a] along each axis a, the axis 0 running fastest. Each event is shared between the
+ * 2^N corners of its grid cell. Events outside the grid are dropped. The partial counts of the partition p
+ * are stored in [p*fSize, (p+1)*fSize).
+ */
+template<size_t N, typename Iterator, typename Pointer>
+struct LinearBinningND
+{
+	LinearBinningND(Iterator data, Pointer partials, size_t nentries, size_t chunk,
+			std::array<size_t, N> const& npoints, std::array<double, N> const& min, std::array<double, N> const& delta):
+		fData(data),
+		fPartials(partials),
+		fNEntries(nentries),
+		fChunk(chunk),
+		fSize(1)
+	{
+		for(size_t a=0; a<N; a++){
+
+			fNPoints[a] = npoints[a];
+			fMin[a]     = min[a];
+			fDelta[a]   = delta[a];
+			fSize      *= npoints[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	LinearBinningND(LinearBinningND<N, Iterator, Pointer> const& other):
+		fData(other.fData),
+		fPartials(other.fPartials),
+		fNEntries(other.fNEntries),
+		fChunk(other.fChunk),
+		fSize(other.fSize)
+	{
+		for(size_t a=0; a<N; a++){
+
+			fNPoints[a] = other.fNPoints[a];
+			fMin[a]     = other.fMin[a];
+			fDelta[a]   = other.fDelta[a];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t partition)
+	{
+		Pointer counts = fPartials + partition*fSize;
+
+		for(size_t j=0; j<fSize; j++)
+			counts[j] = 0.0;
+
+		size_t first = partition*fChunk;
+		size_t last  = first + fChunk < fNEntries ? first + fChunk : fNEntries;
+
+		for(size_t i=first; i<last; i++){
+
+			double x[N];
+			coordinates(fData[i], x);
+
+			size_t index[N];
+			double frac[N];
+			bool   inside = true;
+
+			for(size_t a=0; a<N; a++){
+
+				double u = (x[a] - fMin[a])/fDelta[a];
+
+				if( !(u >= 0.0) || u > double(fNPoints[a] - 1) ){ inside = false; break; }
+
+				index[a] = size_t(u);
+				frac[a]  = u - double(index[a]);
+
+				//an event on the last grid point goes to the lower cell
+				if( index[a] + 1 == fNPoints[a] ){ index[a]--; frac[a] = 1.0; }
+			}
+
+			if(!inside) continue;
+
+			for(size_t corner=0; corner < (size_t(1)<<N); corner++){
+
+				double weight = 1.0;
+				size_t offset = 0;
+				size_t stride = 1;
+
+				for(size_t a=0; a<N; a++){
+
+					size_t upper = (corner >> a) & 1;
+
+					weight *= upper ? frac[a] : 1.0 - frac[a];
+					offset += (index[a] + upper)*stride;
+					stride *= fNPoints[a];
+				}
+
+				counts[offset] += weight;
+			}
+		}
+	}
+
+	Iterator fData;
+	Pointer  fPartials;
+	size_t   fNEntries;
+	size_t   fChunk;
+	size_t   fSize;
+	size_t   fNPoints[N];
+	double   fMin[N];
+	double   fDelta[N];
+};
+
+}  // namespace kde
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* KDEBINNING_H_ */
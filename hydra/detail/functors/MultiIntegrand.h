@@ -0,0 +1,140 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * MultiIntegrand.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+#ifndef MULTIINTEGRAND_H_
+#define MULTIINTEGRAND_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/utility/Generic.h>
+#include <hydra/detail/external/hydra_thrust/tuple.h>
+
+#include <array>
+#include <utility>
+#include <type_traits>
+
+namespace hydra {
+
+namespace detail {
+
+/*
+ * Bundles K functors in a single functor, returning std::array<GReal_t, K>
+ * with the values of all of them at the same point.
+ */
+template<typename ...Functors>
+struct MultiIntegrand
+{
+	typedef std::array<GReal_t, sizeof...(Functors)> return_type;
+
+	MultiIntegrand(Functors const& ...functors):
+		fFunctors(functors...)
+	{}
+
+	MultiIntegrand(hydra::thrust::tuple<Functors...> const& functors):
+		fFunctors(functors)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	MultiIntegrand(MultiIntegrand<Functors...> const& other):
+		fFunctors(other.fFunctors)
+	{}
+
+	template<typename T>
+	__hydra_host__ __hydra_device__ inline
+	return_type operator()(T const& x) const
+	{
+		return call(x, make_index_sequence<sizeof...(Functors)>{});
+	}
+
+private:
+
+	template<typename T, size_t ...I>
+	__hydra_host__ __hydra_device__ inline
+	return_type call(T const& x, index_sequence<I...>) const
+	{
+		return return_type{{ GReal_t(hydra::thrust::get<I>(fFunctors)(x))... }};
+	}
+
+	hydra::thrust::tuple<Functors...> fFunctors;
+};
+
+/*
+ * Number of integrands of a functor returning std::array<GReal_t, K>.
+ */
+template<typename Functor>
+using multi_integrand_size = std::tuple_size<typename std::decay<typename Functor::return_type>::type>;
+
+/*
+ * Return type of the MultiIntegrate(...) methods: one (result, error) pair per integrand.
+ */
+template<typename Functor>
+using multi_integral_t = std::array<std::pair<GReal_t, GReal_t>,
+		std::tuple_size<typename std::decay<typename Functor::return_type>::type>::value>;
+
+template<size_t K>
+struct MultiIntegrandPlus
+{
+	__hydra_host__ __hydra_device__ inline
+	std::array<GReal_t, K> operator()(std::array<GReal_t, K> const& x, std::array<GReal_t, K> const& y) const
+	{
+		std::array<GReal_t, K> result;
+
+		for(size_t k=0; k<K; k++)
+			result[k] = x[k] + y[k];
+
+		return result;
+	}
+};
+
+/*
+ * Adds the values of the integrands to a running sum, one or K of them.
+ */
+__hydra_host__ __hydra_device__ inline
+void add_integrands(GReal_t& sum, GReal_t value)
+{
+	sum += value;
+}
+
+template<size_t K>
+__hydra_host__ __hydra_device__ inline
+void add_integrands(std::array<GReal_t, K>& sum, std::array<GReal_t, K> const& value)
+{
+	for(size_t k=0; k<K; k++)
+		sum[k] += value[k];
+}
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* MULTIINTEGRAND_H_ */
@@ -0,0 +1,265 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * PoissonBootstrapWeight.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup random
+ */
+
+
+#ifndef POISSONBOOTSTRAPWEIGHT_H_
+#define POISSONBOOTSTRAPWEIGHT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/external/hydra_thrust/random.h>
+
+namespace hydra {
+
+namespace detail {
+
+/**
+ * Poisson(1) weight of the event `index` in the bootstrap replica `replica`.
+ * The weight is drawn by inversion of the Poisson(1) cumulative distribution,
+ * from the uniform number at position index*nreplicas + replica of the counter-based
+ * generator, so nothing needs to be stored and any weight can be regenerated in isolation.
+ */
+template<typename GRND>
+struct PoissonWeight
+{
+	PoissonWeight(size_t seed, size_t nreplicas):
+		fSeed(seed),
+		fNReplicas(nreplicas)
+	{}
+
+	__hydra_host__ __hydra_device__
+	PoissonWeight(PoissonWeight<GRND> const& other):
+		fSeed(other.fSeed),
+		fNReplicas(other.fNReplicas)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline unsigned operator()(size_t replica, size_t index) const
+	{
+		GRND randEng(fSeed);
+		randEng.discard(index*fNReplicas + replica);
+
+		hydra::thrust::uniform_real_distribution<double> dist(0.0, 1.0);
+
+		double u = dist(randEng);
+
+		//P(k) = e^{-1}/k!
+		double p = 0.36787944117144233;
+		double F = p;
+		unsigned k = 0;
+
+		while( u > F && k < 20 ){
+			++k;
+			p /= k;
+			F += p;
+		}
+
+		return k;
+	}
+
+	size_t fSeed;
+	size_t fNReplicas;
+};
+
+/**
+ * Lazy weights of a single replica, to be used with transform iterators.
+ */
+template<typename GRND>
+struct ReplicaWeight
+{
+	ReplicaWeight(PoissonWeight<GRND> const& weight, size_t replica):
+		fWeight(weight),
+		fReplica(replica)
+	{}
+
+	__hydra_host__ __hydra_device__
+	ReplicaWeight(ReplicaWeight<GRND> const& other):
+		fWeight(other.fWeight),
+		fReplica(other.fReplica)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline double operator()(size_t index) const
+	{
+		return fWeight(fReplica, index);
+	}
+
+	PoissonWeight<GRND> fWeight;
+	size_t fReplica;
+};
+
+/**
+ * Accumulates sum_i w_{b,i}*f(x_i) and sum_i w_{b,i} for all replicas b over the
+ * events of one partition. The functor is evaluated once per event.
+ * The partial sums of the partition p are stored in [p*2*nreplicas, (p+1)*2*nreplicas).
+ */
+template<typename GRND, typename Iterator, typename Functor, typename Pointer>
+struct BootstrapPartialSums
+{
+	BootstrapPartialSums(PoissonWeight<GRND> const& weight, Iterator data, Functor const& functor,
+			Pointer partials, size_t nentries, size_t chunk):
+		fWeight(weight),
+		fData(data),
+		fFunctor(functor),
+		fPartials(partials),
+		fNEntries(nentries),
+		fChunk(chunk)
+	{}
+
+	__hydra_host__ __hydra_device__
+	BootstrapPartialSums(BootstrapPartialSums<GRND, Iterator, Functor, Pointer> const& other):
+		fWeight(other.fWeight),
+		fData(other.fData),
+		fFunctor(other.fFunctor),
+		fPartials(other.fPartials),
+		fNEntries(other.fNEntries),
+		fChunk(other.fChunk)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t partition)
+	{
+		size_t nreplicas = fWeight.fNReplicas;
+
+		Pointer sums    = fPartials + partition*2*nreplicas;
+		Pointer weights = sums + nreplicas;
+
+		for(size_t b=0; b<nreplicas; b++){
+			sums[b]    = 0.0;
+			weights[b] = 0.0;
+		}
+
+		size_t first = partition*fChunk;
+		size_t last  = first + fChunk < fNEntries ? first + fChunk : fNEntries;
+
+		for(size_t i=first; i<last; i++){
+
+			double value = fFunctor(fData[i]);
+
+			for(size_t b=0; b<nreplicas; b++){
+
+				double w = fWeight(b, i);
+
+				sums[b]    += w*value;
+				weights[b] += w;
+			}
+		}
+	}
+
+	PoissonWeight<GRND> fWeight;
+	Iterator fData;
+	Functor  fFunctor;
+	Pointer  fPartials;
+	size_t   fNEntries;
+	size_t   fChunk;
+};
+
+/**
+ * Fills the histograms of all replicas with the events of one partition.
+ * The bin of each event is calculated once. The partial histograms of the partition p
+ * are stored in [p*nreplicas*nbins, (p+1)*nreplicas*nbins), replica-major.
+ */
+template<typename GRND, typename Iterator, typename Functor, typename Pointer>
+struct BootstrapPartialHistogram
+{
+	BootstrapPartialHistogram(PoissonWeight<GRND> const& weight, Iterator data, Functor const& functor,
+			Pointer partials, size_t nentries, size_t chunk, size_t nbins, double min, double max):
+		fWeight(weight),
+		fData(data),
+		fFunctor(functor),
+		fPartials(partials),
+		fNEntries(nentries),
+		fChunk(chunk),
+		fNBins(nbins),
+		fMin(min),
+		fMax(max)
+	{}
+
+	__hydra_host__ __hydra_device__
+	BootstrapPartialHistogram(BootstrapPartialHistogram<GRND, Iterator, Functor, Pointer> const& other):
+		fWeight(other.fWeight),
+		fData(other.fData),
+		fFunctor(other.fFunctor),
+		fPartials(other.fPartials),
+		fNEntries(other.fNEntries),
+		fChunk(other.fChunk),
+		fNBins(other.fNBins),
+		fMin(other.fMin),
+		fMax(other.fMax)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t partition)
+	{
+		size_t nreplicas = fWeight.fNReplicas;
+
+		Pointer histograms = fPartials + partition*nreplicas*fNBins;
+
+		for(size_t k=0; k<nreplicas*fNBins; k++)
+			histograms[k] = 0.0;
+
+		size_t first = partition*fChunk;
+		size_t last  = first + fChunk < fNEntries ? first + fChunk : fNEntries;
+
+		double delta = (fMax - fMin)/fNBins;
+
+		for(size_t i=first; i<last; i++){
+
+			double x = fFunctor(fData[i]);
+
+			if( !(x >= fMin && x < fMax) ) continue;
+
+			size_t bin = static_cast<size_t>((x - fMin)/delta);
+			bin = bin < fNBins ? bin : fNBins-1;
+
+			for(size_t b=0; b<nreplicas; b++)
+				histograms[b*fNBins + bin] += fWeight(b, i);
+		}
+	}
+
+	PoissonWeight<GRND> fWeight;
+	Iterator fData;
+	Functor  fFunctor;
+	Pointer  fPartials;
+	size_t   fNEntries;
+	size_t   fChunk;
+	size_t   fNBins;
+	double   fMin;
+	double   fMax;
+};
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* POISSONBOOTSTRAPWEIGHT_H_ */
@@ -43,6 +43,8 @@
 #include <hydra/detail/utility/Utility_Tuple.h>
 #include <hydra/detail/external/hydra_thrust/random.h>
 
+#include <array>
+
 namespace hydra {
 
 namespace detail {
@@ -148,6 +150,107 @@ struct ProcessCallsPlainBinary
     }
 };
 
+// MultiPlainState holds the running mean and sum of squared deviations of K
+// integrands evaluated at the same points.
+template<size_t K>
+struct MultiPlainState
+{
+	__hydra_host__ __hydra_device__
+	MultiPlainState():
+		fN(0)
+	{
+		for(size_t k=0; k<K; k++){
+			fMean[k] = 0;
+			fM2[k]   = 0;
+		}
+	}
+
+	size_t  fN;
+	GReal_t fMean[K];
+	GReal_t fM2[K];
+};
+
+// ProcessCallsPlainMultiUnary evaluates a functor returning std::array<GReal_t,K>
+// at the point x and returns a MultiPlainState with the means initialized to f(x).
+template <typename FUNCTOR, size_t N, size_t K, typename GRND=hydra::thrust::random::default_random_engine>
+struct ProcessCallsPlainMultiUnary
+{
+
+	ProcessCallsPlainMultiUnary(GReal_t* XLow, GReal_t  *DeltaX, size_t seed, FUNCTOR const& functor):
+		fSeed(seed),
+		fXLow(XLow),
+		fDeltaX(DeltaX),
+		fFunctor(functor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	ProcessCallsPlainMultiUnary( ProcessCallsPlainMultiUnary<FUNCTOR,N,K,GRND> const& other):
+	fSeed(other.fSeed),
+	fXLow(other.fXLow),
+	fDeltaX(other.fDeltaX),
+	fFunctor(other.fFunctor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	MultiPlainState<K> operator()(size_t index)
+	 {
+
+		GRND randEng(fSeed);
+		randEng.discard(index);
+		hydra::thrust::uniform_real_distribution<GReal_t> uniDist(0.0, 1.0);
+
+		GReal_t x[N];
+
+		for (size_t j = 0; j < N; j++) {
+			GReal_t r =  uniDist(randEng);
+			x[j] = fXLow[j] + r*fDeltaX[j];
+		}
+
+		std::array<GReal_t, K> fval = fFunctor( detail::arrayToTuple<GReal_t, N>(x));
+
+		MultiPlainState<K> result;
+		result.fN = 1;
+
+		for(size_t k=0; k<K; k++)
+			result.fMean[k] = fval[k];
+
+		return result;
+	}
+
+	size_t fSeed;
+	FUNCTOR fFunctor;
+	GReal_t* __restrict__ fXLow;
+	GReal_t* __restrict__ fDeltaX;
+};
+
+// ProcessCallsPlainMultiBinary merges two MultiPlainState, integrand by integrand,
+// in the same way as ProcessCallsPlainBinary.
+template<size_t K>
+struct ProcessCallsPlainMultiBinary
+{
+    __hydra_host__ __hydra_device__ inline
+    MultiPlainState<K> operator()(const MultiPlainState<K>& x, const MultiPlainState<K>& y)
+    {
+    	MultiPlainState<K> result;
+
+        size_t n  = x.fN + y.fN;
+
+        result.fN = n;
+
+        if( n == 0 ) return result;
+
+        for(size_t k=0; k<K; k++){
+
+        	GReal_t delta  = y.fMean[k] - x.fMean[k];
+
+        	result.fMean[k] = (x.fMean[k]* x.fN +  y.fMean[k]* y.fN) / n;
+        	result.fM2[k]   = x.fM2[k] + y.fM2[k] + delta * delta * x.fN * y.fN / n;
+        }
+
+        return result;
+    }
+};
+
 }// namespace detail
 
 }// namespace hydra
@@ -0,0 +1,185 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * ProcessCallsQuasiMonteCarlo.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+
+#ifndef PROCESSCALLSQUASIMONTECARLO_H_
+#define PROCESSCALLSQUASIMONTECARLO_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
+#include <hydra/detail/utility/LSB.h>
+#include <hydra/detail/functors/MultiIntegrand.h>
+
+#include <stdint.h>
+
+namespace hydra {
+
+namespace detail {
+
+namespace quasi_monte_carlo {
+
+__hydra_host__ __hydra_device__
+inline uint32_t reverse_bits(uint32_t x)
+{
+#ifdef __CUDA_ARCH__
+	return __brev(x);
+#else
+	x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+	x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+	x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+	x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+	return (x >> 16) | (x << 16);
+#endif
+}
+
+/*
+ * Hash-based nested uniform (Owen) scrambling, following
+ * B. Burley, "Practical Hash-based Owen Scrambling", JCGT 9 (4), 1-20 (2020).
+ * The Laine-Karras permutation only propagates the bits upwards, so it is applied
+ * to the bit-reversed value to make each digit depend on all the preceding ones.
+ */
+__hydra_host__ __hydra_device__
+inline uint32_t owen_scramble(uint32_t x, uint32_t seed)
+{
+	x = reverse_bits(x);
+
+	x += seed;
+	x ^= x * 0x6c50b47cu;
+	x ^= x * 0xb82f1e52u;
+	x ^= x * 0xc7afe638u;
+	x ^= x * 0x8d22f6e6u;
+
+	return reverse_bits(x);
+}
+
+}  // namespace quasi_monte_carlo
+
+/*
+ * Sums the integrand over the points [chunk*fChunkSize, (chunk+1)*fChunkSize) of a randomized Sobol sequence.
+ * The first point of the chunk is built from its index through the Gray code, as the XOR of the
+ * direction numbers of the bits set in index^(index>>1), so that any chunk is reached in a fixed number
+ * of operations. The following points are obtained with one XOR per dimension, as consecutive Gray codes
+ * differ by a single bit. The direction numbers are stored row-major, [bit*N + dimension], and the seeds
+ * of the randomization, one per dimension, are in fSeeds[0, N).
+ * ResultType is GReal_t, or std::array<GReal_t,K> for functors returning K integrands.
+ */
+template <typename FUNCTOR, size_t N, typename ResultType=GReal_t>
+struct ProcessCallsQuasiMonteCarlo
+{
+
+	ProcessCallsQuasiMonteCarlo(GReal_t* XLow, GReal_t* DeltaX,
+			uint32_t* Directions, uint32_t* Seeds, bool owen,
+			size_t npoints, size_t chunk_size, FUNCTOR const& functor):
+		fOwen(owen),
+		fNPoints(npoints),
+		fChunkSize(chunk_size),
+		fXLow(XLow),
+		fDeltaX(DeltaX),
+		fDirections(Directions),
+		fSeeds(Seeds),
+		fFunctor(functor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	ProcessCallsQuasiMonteCarlo( ProcessCallsQuasiMonteCarlo<FUNCTOR,N,ResultType> const& other):
+		fOwen(other.fOwen),
+		fNPoints(other.fNPoints),
+		fChunkSize(other.fChunkSize),
+		fXLow(other.fXLow),
+		fDeltaX(other.fDeltaX),
+		fDirections(other.fDirections),
+		fSeeds(other.fSeeds),
+		fFunctor(other.fFunctor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	ResultType operator()(size_t chunk)
+	{
+		size_t first = chunk*fChunkSize;
+		size_t last  = first + fChunkSize < fNPoints ? first + fChunkSize : fNPoints;
+
+		uint32_t point[N]{};
+
+		for(uint32_t code = uint32_t(first ^ (first >> 1)); code != 0; code &= code - 1)
+		{
+			unsigned bit = lsb(code);
+
+			for (size_t j = 0; j < N; j++)
+				point[j] ^= fDirections[bit*N + j];
+		}
+
+		ResultType sum{};
+
+		for(size_t index = first; index < last; index++)
+		{
+			GReal_t x[N];
+
+			for (size_t j = 0; j < N; j++)
+			{
+				uint32_t u = fOwen ? quasi_monte_carlo::owen_scramble(point[j], fSeeds[j])
+						           : point[j]^fSeeds[j];
+
+				//center of the elementary interval, never 0 or 1
+				x[j] = fXLow[j] + (GReal_t(u) + 0.5)*2.3283064365386963e-10*fDeltaX[j];
+			}
+
+			add_integrands(sum, fFunctor( detail::arrayToTuple<GReal_t, N>(x)));
+
+			if( index + 1 == last ) break;
+
+			//next point in Gray code order
+			unsigned bit = lsb(uint64_t(index + 1));
+
+			for (size_t j = 0; j < N; j++)
+				point[j] ^= fDirections[bit*N + j];
+		}
+
+		return sum;
+	}
+
+	bool   fOwen;
+	size_t fNPoints;
+	size_t fChunkSize;
+	GReal_t*  __restrict__ fXLow;
+	GReal_t*  __restrict__ fDeltaX;
+	uint32_t* __restrict__ fDirections;
+	uint32_t* __restrict__ fSeeds;
+	FUNCTOR fFunctor;
+};
+
+}// namespace detail
+
+}// namespace hydra
+
+#endif /* PROCESSCALLSQUASIMONTECARLO_H_ */
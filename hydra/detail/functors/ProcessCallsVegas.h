@@ -86,27 +86,95 @@ struct ProcessBoxesVegas
 };
 
 
+namespace vegas {
+
+/*
+ * Calls per partition of the automatic partitioning. On CUDA each partition is a thread, so they are kept
+ * short to fill the device; on the host back ends the partitions are balanced over a few threads, so they are kept
+ * long to limit the number of private grid distributions to merge.
+ */
+template<hydra::detail::Backend BACKEND>
+struct CallsPerPartition { static constexpr size_t value = 8192; };
+
+template<>
+struct CallsPerPartition<hydra::detail::Cuda> { static constexpr size_t value = 64; };
+
+#if HYDRA_DEVICE_SYSTEM==CUDA
+template<>
+struct CallsPerPartition<hydra::detail::Device> { static constexpr size_t value = 64; };
+#endif
+
+/*
+ * upper limit of the entries of all private grid distributions, npartitions*N*bins, of the automatic partitioning
+ */
+constexpr size_t max_distribution_size = size_t(1)<<23;
+
+}  // namespace vegas
+
+/**
+ * Sums the entry k of the private copies of the grid distribution of all partitions.
+ */
+template<typename PointerReal>
+struct SumDistributionsVegas
+{
+	SumDistributionsVegas(PointerReal distributions, size_t npartitions, size_t size):
+		fNPartitions(npartitions),
+		fSize(size),
+		fDistributions(distributions)
+	{}
+
+	__hydra_host__ __hydra_device__
+	SumDistributionsVegas(SumDistributionsVegas<PointerReal> const& other):
+		fNPartitions(other.fNPartitions),
+		fSize(other.fSize),
+		fDistributions(other.fDistributions)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	GReal_t operator()(size_t k) const
+	{
+		GReal_t sum = 0.0;
+
+		for(size_t p=0; p<fNPartitions; p++)
+			sum += fDistributions[p*fSize + k];
+
+		return sum;
+	}
+
+	size_t fNPartitions;
+	size_t fSize;
+	PointerReal fDistributions;
+};
+
+/**
+ * Processes the calls of one partition of the sample: evaluates the integrand,
+ * accumulates the partial mean and variance and fills a private copy of the
+ * grid distribution, with N*fNBins entries, stored at fDistribution + partition*N*fNBins.
+ * The private copies are merged after all partitions are processed, so no storage
+ * proportional to the number of calls is needed.
+ */
 template<typename FUNCTOR, size_t NDimensions, typename  BACKEND,
-typename IteratorBackendReal, typename IteratorBackendUInt,
+typename IteratorBackendReal, typename PointerReal, typename PointerResult,
 typename GRND=hydra::thrust::random::default_random_engine>
 struct ProcessCallsVegas;
 
 template<typename FUNCTOR, size_t NDimensions,  hydra::detail::Backend  BACKEND,
-typename IteratorBackendReal, typename IteratorBackendUInt, typename GRND>
+typename IteratorBackendReal, typename PointerReal, typename PointerResult, typename GRND>
 struct ProcessCallsVegas<FUNCTOR,  NDimensions, hydra::detail::BackendPolicy<BACKEND>,
-IteratorBackendReal,  IteratorBackendUInt, GRND>
+IteratorBackendReal, PointerReal, PointerResult, GRND>
 {
 
 	typedef   ProcessCallsVegas<FUNCTOR,  NDimensions, hydra::detail::BackendPolicy<BACKEND>,
-			IteratorBackendReal,  IteratorBackendUInt, GRND> this_t;
+			IteratorBackendReal, PointerReal, PointerResult, GRND> this_t;
 
 	typedef  hydra::VegasState<NDimensions,hydra::detail::BackendPolicy<BACKEND>> state_t;
 
 public :
 
-	ProcessCallsVegas( size_t NBoxes, state_t& fState,	IteratorBackendUInt begin_bins,
-			IteratorBackendReal begin_real,  FUNCTOR const& functor):
-				fNBoxes( NBoxes ),
+	ProcessCallsVegas( size_t NCalls, size_t NCallsPerPartition, state_t& fState,
+			PointerReal distribution, PointerResult results, FUNCTOR const& functor):
+				fNCalls( NCalls ),
+				fNCallsPerPartition( NCallsPerPartition ),
 				fSeed(fState.GetItNum()),
 				fNBins(fState.GetNBins()),
 				fNBoxesPerDimension(fState.GetNBoxes()),
@@ -115,8 +183,8 @@ public :
 				fXi(fState.GetBackendXi().begin() ),
 				fXLow( fState.GetBackendXLow().begin() ),
 				fDeltaX( fState.GetBackendDeltaX().begin() ),
-				fGlobalBin( begin_bins ),
-				fFVals( begin_real ),
+				fDistribution( distribution ),
+				fResults( results ),
 				fFunctor(functor)
 				{}
 
@@ -124,19 +192,19 @@ public :
 	ProcessCallsVegas( this_t const& other):
 	fSeed(other.fSeed),
 	fNBins(other.fNBins),
-	fNBoxes(other.fNBoxes),
+	fNCalls(other.fNCalls),
+	fNCallsPerPartition(other.fNCallsPerPartition),
 	fNBoxesPerDimension(other.fNBoxesPerDimension),
 	fNCallsPerBox(other.fNCallsPerBox),
 	fJacobian(other.fJacobian),
 	fXi(other.fXi),
 	fXLow(other.fXLow),
 	fDeltaX(other.fDeltaX),
-	fGlobalBin(other.fGlobalBin),
-	fFVals(other.fFVals),
+	fDistribution(other.fDistribution),
+	fResults(other.fResults),
 	fFunctor(other.fFunctor)
 	{}
 
-
 	__hydra_host__ __hydra_device__
 	inline GInt_t GetBoxCoordinate(GInt_t idx, GInt_t dim, GInt_t nboxes, GInt_t j)
 	{
@@ -205,55 +273,63 @@ public :
 
 	}
 
-	__hydra_host__ __hydra_device__ inline
-	size_t GetDistributionIndex(size_t index,  const GUInt_t dim) const
-	{ return index*NDimensions + dim; }
-
 	__hydra_host__ __hydra_device__ inline
 	GUInt_t GetDistributionKey( const GUInt_t bin, const GUInt_t dim) const
 	{ return bin * NDimensions + dim; }
 
 
 	__hydra_host__ __hydra_device__ inline
-	ResultVegas operator()( size_t index)
+	void operator()( size_t partition)
 	{
+		PointerReal distribution = fDistribution + partition*NDimensions*fNBins;
 
-		GReal_t volume = 1.0;
-		GReal_t x[NDimensions];
-		GInt_t bin[NDimensions];
-		ResultVegas result;
+		for (size_t i = 0; i < NDimensions*fNBins; i++)
+			distribution[i] = 0.0;
 
-		get_point( index, volume, bin, x );
+		size_t first = partition*fNCallsPerPartition;
+		size_t last  = first + fNCallsPerPartition < fNCalls ? first + fNCallsPerPartition : fNCalls;
 
-		GReal_t fval = fJacobian*volume*fFunctor( detail::arrayToTuple<GReal_t, NDimensions>(x));
+		ResultVegas result;
+		result.fN    = 0.0;
+		result.fMean = 0.0;
+		result.fM2   = 0.0;
 
-		for (GUInt_t j = 0; j < NDimensions; j++)
+		for(size_t index = first; index < last; index++)
 		{
+			GReal_t volume = 1.0;
+			GReal_t x[NDimensions];
+			GInt_t bin[NDimensions];
 
-		    fGlobalBin[ GetDistributionIndex(index, j ) ] = GetDistributionKey(bin[j], j);
-			fFVals[GetDistributionIndex(index, j )]=fval*fval;
+			get_point( index, volume, bin, x );
 
-		}
+			GReal_t fval = fJacobian*volume*fFunctor( detail::arrayToTuple<GReal_t, NDimensions>(x));
 
-		result.fN    = 1.0;
-		result.fMean = fval;
-		result.fM2   = 0.0;
+			for (GUInt_t j = 0; j < NDimensions; j++)
+				distribution[ GetDistributionKey(bin[j], j) ] += fval*fval;
 
-		return result;
+			ResultVegas call;
+			call.fN    = 1.0;
+			call.fMean = fval;
+			call.fM2   = 0.0;
+
+			result = ProcessBoxesVegas()(result, call);
+		}
 
+		fResults[partition] = result;
 	}
 
 private:
 
 	size_t  fNBins;
-	size_t  fNBoxes;
+	size_t  fNCalls;
+	size_t  fNCallsPerPartition;
 	size_t  fNBoxesPerDimension;
 	size_t  fNCallsPerBox;
 
 	GReal_t fJacobian;
 	GInt_t  fSeed;
-	IteratorBackendUInt fGlobalBin;
-	IteratorBackendReal fFVals;
+	PointerReal   fDistribution;
+	PointerResult fResults;
 	IteratorBackendReal  fXi;
 	IteratorBackendReal  fXLow;
 	IteratorBackendReal  fDeltaX;
@@ -0,0 +1,162 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * ProcessGaussKronrodCubature.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup numerical_integration
+ */
+
+#ifndef PROCESSGAUSSKRONRODCUBATURE_H_
+#define PROCESSGAUSSKRONRODCUBATURE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
+#include <hydra/detail/functors/ProcessGaussKronrodQuadrature.h>
+
+namespace hydra {
+
+namespace detail {
+
+/*
+ * Evaluates the node `index` of the tensor product of N one-dimensional composite Gauss-Kronrod rules.
+ * The nodes and weights of the rule of the dimension j are stored in [fOffsets[j], fOffsets[j] + fSizes[j])
+ * and the index is decomposed in mixed radix, with the first dimension running fastest.
+ */
+template <typename FUNCTOR, size_t N>
+struct GaussKronrodTensorCall
+{
+	GaussKronrodTensorCall(GReal_t* Nodes, GReal_t* KronrodWeights, GReal_t* GaussWeights,
+			size_t const (&sizes)[N], FUNCTOR const& functor):
+		fNodes(Nodes),
+		fKronrodWeights(KronrodWeights),
+		fGaussWeights(GaussWeights),
+		fFunctor(functor)
+	{
+		size_t offset = 0;
+
+		for(size_t j=0; j<N; j++){
+			fSizes[j]   = sizes[j];
+			fOffsets[j] = offset;
+			offset     += sizes[j];
+		}
+	}
+
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodTensorCall( GaussKronrodTensorCall<FUNCTOR,N> const& other):
+		fNodes(other.fNodes),
+		fKronrodWeights(other.fKronrodWeights),
+		fGaussWeights(other.fGaussWeights),
+		fFunctor(other.fFunctor)
+	{
+		for(size_t j=0; j<N; j++){
+			fSizes[j]   = other.fSizes[j];
+			fOffsets[j] = other.fOffsets[j];
+		}
+	}
+
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodCall operator()(size_t index)
+	{
+		GReal_t x[N];
+		GReal_t kronrod_weight = 1.0;
+		GReal_t gauss_weight   = 1.0;
+
+		for(size_t j=0; j<N; j++)
+		{
+			size_t node = fOffsets[j] + index%fSizes[j];
+			index /= fSizes[j];
+
+			x[j]            = fNodes[node];
+			kronrod_weight *= fKronrodWeights[node];
+			gauss_weight   *= fGaussWeights[node];
+		}
+
+		GReal_t function_call = fFunctor( detail::arrayToTuple<GReal_t, N>(x));
+
+		return GaussKronrodCall(function_call*gauss_weight, function_call*kronrod_weight);
+	}
+
+	size_t fSizes[N];
+	size_t fOffsets[N];
+	GReal_t* __restrict__ fNodes;
+	GReal_t* __restrict__ fKronrodWeights;
+	GReal_t* __restrict__ fGaussWeights;
+	FUNCTOR fFunctor;
+};
+
+/*
+ * Evaluates the node `index` of a sparse grid. The coordinates are stored as [dimension*fNPoints + index]
+ * and the weights already include the coefficients of the combination of the tensor products.
+ */
+template <typename FUNCTOR, size_t N>
+struct GaussKronrodSparseCall
+{
+	GaussKronrodSparseCall(GReal_t* Nodes, GReal_t* KronrodWeights, GReal_t* GaussWeights,
+			size_t npoints, FUNCTOR const& functor):
+		fNPoints(npoints),
+		fNodes(Nodes),
+		fKronrodWeights(KronrodWeights),
+		fGaussWeights(GaussWeights),
+		fFunctor(functor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodSparseCall( GaussKronrodSparseCall<FUNCTOR,N> const& other):
+		fNPoints(other.fNPoints),
+		fNodes(other.fNodes),
+		fKronrodWeights(other.fKronrodWeights),
+		fGaussWeights(other.fGaussWeights),
+		fFunctor(other.fFunctor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodCall operator()(size_t index)
+	{
+		GReal_t x[N];
+
+		for(size_t j=0; j<N; j++)
+			x[j] = fNodes[j*fNPoints + index];
+
+		GReal_t function_call = fFunctor( detail::arrayToTuple<GReal_t, N>(x));
+
+		return GaussKronrodCall(function_call*fGaussWeights[index], function_call*fKronrodWeights[index]);
+	}
+
+	size_t fNPoints;
+	GReal_t* __restrict__ fNodes;
+	GReal_t* __restrict__ fKronrodWeights;
+	GReal_t* __restrict__ fGaussWeights;
+	FUNCTOR fFunctor;
+};
+
+}// namespace detail
+
+}// namespace hydra
+
+#endif /* PROCESSGAUSSKRONRODCUBATURE_H_ */
@@ -32,6 +32,8 @@
 #include <hydra/detail/Config.h>
 #include <hydra/Types.h>
 
+#include <array>
+
 
 namespace hydra {
 
@@ -134,6 +136,86 @@ struct GaussKronrodBinary: public hydra::thrust::binary_function<GaussKronrodCal
 };
 
 
+/*
+ * Gauss and Gauss-Kronrod sums of K integrands evaluated at the same abscissas.
+ */
+template<size_t K>
+struct GaussKronrodMultiCall
+{
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodMultiCall()
+	{
+		for(size_t k=0; k<K; k++){
+			fGaussCall[k]        = 0;
+			fGaussKronrodCall[k] = 0;
+		}
+	}
+
+	GReal_t fGaussCall[K];
+	GReal_t fGaussKronrodCall[K];
+};
+
+template <typename FUNCTOR, size_t K>
+struct GaussKronrodMultiUnary
+{
+	GaussKronrodMultiUnary()=delete;
+
+	GaussKronrodMultiUnary(FUNCTOR const& functor):
+	fFunctor(functor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodMultiUnary(GaussKronrodMultiUnary<FUNCTOR,K> const& other ):
+	fFunctor(other.fFunctor)
+	{}
+
+	template<typename T>
+	__hydra_host__ __hydra_device__ inline
+	GaussKronrodMultiCall<K> operator()(T row)
+	{
+		GReal_t abscissa_X_P             = hydra::thrust::get<0>(row);
+		GReal_t abscissa_X_M             = hydra::thrust::get<1>(row);
+		GReal_t abscissa_Weight          = hydra::thrust::get<2>(row);
+		GReal_t rule_GaussKronrod_Weight = hydra::thrust::get<3>(row);
+		GReal_t rule_Gauss_Weight        = hydra::thrust::get<4>(row);
+
+		std::array<GReal_t, K> call_M = fFunctor(abscissa_X_M);
+		std::array<GReal_t, K> call_P = fFunctor(abscissa_X_P);
+
+		GaussKronrodMultiCall<K> result;
+
+		for(size_t k=0; k<K; k++){
+
+			GReal_t function_call = abscissa_Weight*(call_M[k] + call_P[k]);
+
+			result.fGaussCall[k]        = function_call*rule_Gauss_Weight;
+			result.fGaussKronrodCall[k] = function_call*rule_GaussKronrod_Weight;
+		}
+
+		return result;
+	}
+
+	FUNCTOR fFunctor;
+
+};
+
+template<size_t K>
+struct GaussKronrodMultiBinary
+{
+	 __hydra_host__ __hydra_device__ inline
+	 GaussKronrodMultiCall<K> operator()( GaussKronrodMultiCall<K> const& x, GaussKronrodMultiCall<K> const& y)
+	 {
+		 GaussKronrodMultiCall<K> result;
+
+		 for(size_t k=0; k<K; k++){
+			 result.fGaussCall[k]        =  x.fGaussCall[k] + y.fGaussCall[k];
+			 result.fGaussKronrodCall[k] =  x.fGaussKronrodCall[k] + y.fGaussKronrodCall[k];
+		 }
+
+		 return result;
+	 }
+};
+
 }  // namespace hydra
 
 
@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * ProcessSplineTable.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef PROCESSSPLINETABLE_H_
+#define PROCESSSPLINETABLE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Tuple.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+
+#include <stdint.h>
+#include <utility>
+#include <type_traits>
+
+namespace hydra {
+
+namespace detail {
+
+namespace spline {
+
+template<typename Point>
+__hydra_host__ __hydra_device__
+inline typename std::enable_if<std::is_convertible<Point, double>::value, void>::type
+coordinates(Point const& point, double (&x)[1])
+{
+	x[0] = point;
+}
+
+template<typename Point, size_t N, size_t ...I>
+__hydra_host__ __hydra_device__
+inline void coordinates(Point const& point, double (&x)[N], std::index_sequence<I...>)
+{
+	((x[I] = hydra::thrust::get<I>(point)), ...);
+}
+
+template<typename Point, size_t N>
+__hydra_host__ __hydra_device__
+inline typename std::enable_if<!std::is_convertible<Point, double>::value, void>::type
+coordinates(Point const& point, double (&x)[N])
+{
+	coordinates(point, x, std::make_index_sequence<N>{});
+}
+
+/*
+ * Number of consecutive points evaluated by each call of ProcessSplineTable on the system System.
+ * The incremental search pays off on the CPU back-ends, where a chunk is read sequentially by one thread.
+ * On CUDA, threads walking chunks of consecutive points would make the loads of a warp uncoalesced,
+ * so each thread evaluates a single point and neighbouring threads read neighbouring points.
+ */
+template<typename System>
+struct chunk_size: std::integral_constant<size_t,
+#if HYDRA_THRUST_DEVICE_SYSTEM==HYDRA_THRUST_DEVICE_SYSTEM_CUDA
+	std::is_same<System, hydra::thrust::device_system_tag>::value ? 1 : 256
+#else
+	256
+#endif
+	>{};
+
+}  // namespace spline
+
+/*
+ * Evaluates the spline table at the points [chunk*fChunkSize, (chunk+1)*fChunkSize). The result of the point k
+ * is stored at fOrder[k], if fOrder is not null, and at k otherwise. The intervals of each point are searched
+ * from the ones of the previous point.
+ */
+template<typename Functor, typename Iterator, typename OutputIterator, size_t N>
+struct ProcessSplineTable
+{
+	ProcessSplineTable(Functor const& functor, Iterator points, OutputIterator result,
+			const size_t* order, size_t npoints, size_t chunk_size):
+		fFunctor(functor),
+		fPoints(points),
+		fResult(result),
+		fOrder(order),
+		fNPoints(npoints),
+		fChunkSize(chunk_size)
+	{}
+
+	__hydra_host__ __hydra_device__
+	ProcessSplineTable(ProcessSplineTable<Functor, Iterator, OutputIterator, N> const& other):
+		fFunctor(other.fFunctor),
+		fPoints(other.fPoints),
+		fResult(other.fResult),
+		fOrder(other.fOrder),
+		fNPoints(other.fNPoints),
+		fChunkSize(other.fChunkSize)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline void operator()(size_t chunk)
+	{
+		size_t first = chunk*fChunkSize;
+		size_t last  = first + fChunkSize < fNPoints ? first + fChunkSize : fNPoints;
+
+		size_t cell[N]{};
+
+		for(size_t k = first; k < last; k++)
+		{
+			double x[N];
+			spline::coordinates(fPoints[k], x);
+
+			fResult[fOrder ? fOrder[k] : k] = fFunctor.Interpolate(x, cell, k != first);
+		}
+	}
+
+	Functor fFunctor;
+	Iterator fPoints;
+	OutputIterator fResult;
+	const size_t* fOrder;
+	size_t fNPoints;
+	size_t fChunkSize;
+};
+
+/*
+ * Sort key of a point, the index of its cell on a regular grid over the spline table, the last axis being the slowest.
+ * The grid has up to 2^(32/N) cells per axis, matching the table intervals if these are uniform and not more numerous.
+ */
+template<size_t N>
+struct SplineTableKey
+{
+	template<typename Functor>
+	SplineTableKey(Functor const& functor)
+	{
+		for(size_t a=0; a<N; a++){
+
+			size_t max_cells = size_t(1) << (32/N);
+
+			fNCells[a] = functor.GetNKnots(a) - 1 < max_cells ? functor.GetNKnots(a) - 1 : max_cells;
+			fMin[a]    = functor.GetMin(a);
+			fScale[a]  = fNCells[a]/(functor.GetMax(a) - functor.GetMin(a));
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	SplineTableKey(SplineTableKey<N> const& other)
+	{
+		for(size_t a=0; a<N; a++){
+			fNCells[a] = other.fNCells[a];
+			fMin[a]    = other.fMin[a];
+			fScale[a]  = other.fScale[a];
+		}
+	}
+
+	template<typename Point>
+	__hydra_host__ __hydra_device__
+	inline uint32_t operator()(Point const& point) const
+	{
+		double x[N];
+		spline::coordinates(point, x);
+
+		uint32_t key = 0;
+
+		for(size_t a=N; a-- > 0; ){
+
+			double u = (x[a] - fMin[a])*fScale[a];
+
+			size_t cell = u <= 0.0 ? 0 : u >= double(fNCells[a] - 1) ? fNCells[a] - 1 : size_t(u);
+
+			key = key*uint32_t(fNCells[a]) + uint32_t(cell);
+		}
+
+		return key;
+	}
+
+	size_t fNCells[N];
+	double fMin[N];
+	double fScale[N];
+};
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* PROCESSSPLINETABLE_H_ */
@@ -42,6 +42,8 @@
 #include <hydra/detail/external/hydra_thrust/random.h>
 #include <hydra/detail/utility/Utility_Tuple.h>
 
+#include <vector>
+
 namespace hydra{
 
 namespace detail {
@@ -366,6 +368,87 @@ struct RndTrial<T,GRND, FUNCTOR, 1>{
 	GReal_t fMax;
 };
 
+/**
+ * Draws the trial `index` from the density defined by an adapted Vegas grid, which is piecewise
+ * constant with equal probability per bin along each axis, and returns the ratio between the
+ * functor and that density, to be used as accept-reject weight.
+ * The trial uses the N random numbers starting at position (index+jump)*N.
+ */
+template<typename T, typename GRND, typename FUNCTOR, size_t N, typename Pointer>
+struct RndTrialVegas{
+
+	RndTrialVegas(size_t seed, const size_t jump, FUNCTOR const& functor,
+			Pointer xi, size_t nbins,
+			std::vector<T> const& min,
+			std::vector<T> const& max):
+				fFunctor(functor),
+				fSeed(seed),
+				fJump(jump),
+				fXi(xi),
+				fNBins(nbins)
+	{
+		for(size_t i=0; i<N; i++){
+			fMin[i] = min[i];
+			fDelta[i] = max[i] - min[i];
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	RndTrialVegas(RndTrialVegas<T, GRND,FUNCTOR, N, Pointer> const& other):
+		fFunctor(other.fFunctor),
+		fSeed(other.fSeed),
+		fJump(other.fJump),
+		fXi(other.fXi),
+		fNBins(other.fNBins)
+	{
+		for(size_t i=0; i<N; i++){
+			fMin[i] = other.fMin[i];
+			fDelta[i] = other.fDelta[i];
+		}
+	}
+
+
+	template<typename Tuple>
+	__hydra_host__ __hydra_device__
+	inline T operator()(size_t index, Tuple t)
+	{
+		T x[N];
+		T jacobian = 1.0;
+
+		GRND randEng(fSeed);
+		randEng.discard((index+fJump)*N);
+
+		hydra::thrust::uniform_real_distribution<T>  dist(0.0, fNBins);
+
+		for (size_t j = 0; j < N; j++)
+		{
+			T z = dist(randEng);
+
+			size_t k = static_cast<size_t>(z);
+			k = k < fNBins ? k : fNBins - 1;
+
+			T lower = fXi[k*N + j];
+			T width = fXi[(k + 1)*N + j] - lower;
+
+			x[j] = fMin[j] + (lower + (z - k)*width)*fDelta[j];
+
+			jacobian *= fNBins*width*fDelta[j];
+		}
+
+		assignArrayToTuple(t, x);
+
+		return  fFunctor(t)*jacobian;
+	}
+
+	FUNCTOR fFunctor;
+	size_t  fSeed;
+	size_t  fJump;
+	Pointer fXi;
+	size_t  fNBins;
+	T fMin[N];
+	T fDelta[N];
+};
+
 } // namespace detail
 
 }// namespace hydra
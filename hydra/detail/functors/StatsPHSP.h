@@ -52,6 +52,18 @@ struct StatsPHSP
 	fW(other.fW)
 	{}
 
+	__hydra_host__ __hydra_device__ inline
+	StatsPHSP& operator=(StatsPHSP const& other)
+	{
+		if(this == &other) return *this;
+
+		fMean = other.fMean;
+		fM2   = other.fM2;
+		fW    = other.fW;
+
+		return *this;
+	}
+
 	GReal_t fMean;
     GReal_t fM2;
     GReal_t fW;
@@ -0,0 +1,202 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * UnweightingFlag.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+/**
+ * \file
+ * \ingroup random
+ */
+
+
+#ifndef UNWEIGHTINGFLAG_H_
+#define UNWEIGHTINGFLAG_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/external/hydra_thrust/random.h>
+#include <hydra/detail/external/hydra_thrust/tuple.h>
+
+namespace hydra {
+
+namespace detail {
+
+/**
+ * Accept-reject decision against a running maximum weight.
+ * Returns the residual weight of the event: zero if the event is rejected,
+ * one if it is accepted with weight below the maximum and weight/max if the
+ * weight overshoots the maximum (the event is always accepted in this case).
+ */
+template<typename GRND, typename Iterator>
+struct UnweightingFlag
+{
+	UnweightingFlag(size_t seed, size_t jump, double max_weight, Iterator weights):
+		fSeed(seed),
+		fJump(jump),
+		fMaxWeight(max_weight),
+		fWeights(weights)
+	{}
+
+	__hydra_host__ __hydra_device__
+	UnweightingFlag(UnweightingFlag<GRND, Iterator> const& other):
+		fSeed(other.fSeed),
+		fJump(other.fJump),
+		fMaxWeight(other.fMaxWeight),
+		fWeights(other.fWeights)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline double operator()(size_t index) const
+	{
+		double weight = fWeights[index];
+
+		if( !(weight > 0.0) ) return 0.0;
+
+		if( weight >= fMaxWeight ) return weight/fMaxWeight;
+
+		GRND randEng(fSeed);
+		randEng.discard(fJump + index);
+
+		hydra::thrust::uniform_real_distribution<double> dist(0.0, fMaxWeight);
+
+		return dist(randEng) < weight ? 1.0 : 0.0;
+	}
+
+	size_t   fSeed;
+	size_t   fJump;
+	double   fMaxWeight;
+	Iterator fWeights;
+};
+
+struct IsAcceptedEvent
+{
+	template<typename T>
+	__hydra_host__ __hydra_device__
+	inline bool operator()(T x) const
+	{
+		return hydra::thrust::get<1>(x) > 0.0;
+	}
+};
+
+/**
+ * Accumulator for the efficiency statistics of a unweighting batch.
+ */
+struct StatsUnweighting
+{
+	__hydra_host__ __hydra_device__
+	StatsUnweighting():
+		fNTrials(0),
+		fNAccepted(0),
+		fNOvershoot(0),
+		fSumW(0),
+		fSumW2(0),
+		fSumResidual(0),
+		fMaxWeight(0)
+	{}
+
+	__hydra_host__ __hydra_device__
+	StatsUnweighting(StatsUnweighting const& other):
+		fNTrials(other.fNTrials),
+		fNAccepted(other.fNAccepted),
+		fNOvershoot(other.fNOvershoot),
+		fSumW(other.fSumW),
+		fSumW2(other.fSumW2),
+		fSumResidual(other.fSumResidual),
+		fMaxWeight(other.fMaxWeight)
+	{}
+
+	__hydra_host__ __hydra_device__
+	StatsUnweighting& operator=(StatsUnweighting const& other)
+	{
+		if(this==&other) return *this;
+
+		fNTrials     = other.fNTrials;
+		fNAccepted   = other.fNAccepted;
+		fNOvershoot  = other.fNOvershoot;
+		fSumW        = other.fSumW;
+		fSumW2       = other.fSumW2;
+		fSumResidual = other.fSumResidual;
+		fMaxWeight   = other.fMaxWeight;
+
+		return *this;
+	}
+
+	size_t  fNTrials;
+	size_t  fNAccepted;
+	size_t  fNOvershoot;
+	GReal_t fSumW;
+	GReal_t fSumW2;
+	GReal_t fSumResidual;
+	GReal_t fMaxWeight;
+};
+
+struct GetStatsUnweighting
+{
+	template<typename T>
+	__hydra_host__ __hydra_device__
+	inline StatsUnweighting operator()(T x) const
+	{
+		double weight   = hydra::thrust::get<0>(x);
+		double residual = hydra::thrust::get<1>(x);
+
+		StatsUnweighting result;
+
+		result.fNTrials     = 1;
+		result.fNAccepted   = residual > 0.0;
+		result.fNOvershoot  = residual > 1.0;
+		result.fSumW        = weight;
+		result.fSumW2       = weight*weight;
+		result.fSumResidual = residual;
+		result.fMaxWeight   = weight;
+
+		return result;
+	}
+};
+
+struct AddStatsUnweighting
+{
+	__hydra_host__ __hydra_device__
+	inline StatsUnweighting operator()(StatsUnweighting const& x, StatsUnweighting const& y) const
+	{
+		StatsUnweighting result;
+
+		result.fNTrials     = x.fNTrials     + y.fNTrials;
+		result.fNAccepted   = x.fNAccepted   + y.fNAccepted;
+		result.fNOvershoot  = x.fNOvershoot  + y.fNOvershoot;
+		result.fSumW        = x.fSumW        + y.fSumW;
+		result.fSumW2       = x.fSumW2       + y.fSumW2;
+		result.fSumResidual = x.fSumResidual + y.fSumResidual;
+		result.fMaxWeight   = x.fMaxWeight > y.fMaxWeight ? x.fMaxWeight : y.fMaxWeight;
+
+		return result;
+	}
+};
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* UNWEIGHTINGFLAG_H_ */
@@ -41,6 +41,7 @@
 
 //#include <hydra/Events.h>
 #include <hydra/detail/functors/DecayMother.h>
+#include <hydra/detail/functors/DecayMotherBatch.h>
 #include <hydra/detail/functors/DecayMothers.h>
 #include <hydra/detail/functors/EvalMother.h>
 #include <hydra/detail/functors/EvalMothers.h>
@@ -53,6 +54,9 @@
 #include <hydra/detail/external/hydra_thrust/sequence.h>
 #include <hydra/detail/external/hydra_thrust/tuple.h>
 #include <hydra/detail/external/hydra_thrust/tabulate.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+#include <hydra/detail/external/hydra_thrust/system/detail/generic/select_system.h>
 #include <hydra/detail/external/hydra_thrust/transform.h>
 #include <hydra/detail/external/hydra_thrust/transform_reduce.h>
 
@@ -130,11 +134,56 @@ namespace detail {
 
 	//-------------------------------
 
+	/*
+	 * The block-wise generation (DecayMotherBatch) pays off on the CPU back-ends,
+	 * where the events of a block map to vector lanes. On CUDA the per-event functor
+	 * gives better occupancy.
+	 */
+	template<typename Iterator>
+	struct is_block_decayable: std::integral_constant<bool,
+#if HYDRA_THRUST_DEVICE_SYSTEM==HYDRA_THRUST_DEVICE_SYSTEM_CUDA
+	!std::is_same<typename hydra::thrust::iterator_system<Iterator>::type, hydra::thrust::device_system_tag>::value
+#else
+	true
+#endif
+	>{};
+
+	template<size_t N, typename GRND, typename Iterator, typename Policy>
+	inline typename std::enable_if<is_block_decayable<Iterator>::value, void>::type
+	generate_decays( Policy&& policy, Iterator begin, Iterator end, size_t offset,
+			DecayMother<N, GRND> const& decayer)
+	{
+		typedef DecayMotherBatch<N, GRND, Iterator> batch_type;
+
+		size_t nevents = hydra::thrust::distance(begin, end);
+		size_t nblocks = (nevents + batch_type::block_size - 1)/batch_type::block_size;
+
+		hydra::thrust::counting_iterator<size_t> first(0);
+		hydra::thrust::counting_iterator<size_t> last = first + nblocks;
+
+		hydra::thrust::for_each(std::forward<Policy>(policy), first, last,
+				batch_type(decayer, begin, offset, nevents));
+	}
+
+	template<size_t N, typename GRND, typename Iterator, typename Policy>
+	inline typename std::enable_if<!is_block_decayable<Iterator>::value, void>::type
+	generate_decays( Policy&& policy, Iterator begin, Iterator end, size_t offset,
+			DecayMother<N, GRND> const& decayer)
+	{
+		hydra::thrust::counting_iterator<size_t> first(offset);
+		hydra::thrust::counting_iterator<size_t> last = first + hydra::thrust::distance(begin, end);
+
+		hydra::thrust::transform(std::forward<Policy>(policy), first, last, begin, decayer);
+	}
+
 	template<size_t N, typename GRND, typename Iterator>
     inline void launch_decayer(Iterator begin, Iterator end, DecayMother<N, GRND> const& decayer)
 	{
+		using hydra::thrust::system::detail::generic::select_system;
+		typedef typename hydra::thrust::iterator_system<Iterator>::type System;
+		System system;
 
-		hydra::thrust::tabulate(begin, end, decayer);
+		generate_decays(select_system(system), begin, end, 0, decayer);
 		return;
 	}
 
@@ -143,7 +192,17 @@ namespace detail {
 			Iterator begin, Iterator end, DecayMother<N, GRND> const& decayer)
 	{
 
-		hydra::thrust::tabulate(exec_policy , begin, end, decayer);
+		generate_decays(exec_policy, begin, end, 0, decayer);
+		return;
+
+	}
+
+	template<size_t N, typename GRND, typename Iterator, hydra::detail::Backend BACKEND>
+	inline void launch_decayer( hydra::detail::BackendPolicy<BACKEND> const& exec_policy ,
+			Iterator begin, Iterator end, size_t offset, DecayMother<N, GRND> const& decayer)
+	{
+
+		generate_decays(exec_policy, begin, end, offset, decayer);
 		return;
 
 	}
@@ -0,0 +1,190 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * BaseNativeFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef BASENATIVEFFT_H_
+#define BASENATIVEFFT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/detail/Iterable_traits.h>
+#include <hydra/Range.h>
+#include <hydra/Tuple.h>
+#include <hydra/Complex.h>
+#include <hydra/host/System.h>
+#include <hydra/device/System.h>
+#include <hydra/detail/native_fft/NativeFFTPlan.h>
+
+#include <cassert>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hydra {
+
+namespace detail {
+
+namespace native_fft {
+
+// back-end running the passes of the large transforms, the buffers live in the host memory
+#if HYDRA_DEVICE_SYSTEM!=CUDA
+	typedef hydra::device::sys_t default_backend_type;
+#else
+	typedef hydra::host::sys_t default_backend_type;
+#endif
+
+}  // namespace native_fft
+
+}  // namespace detail
+
+/**
+ * \ingroup generic
+ * Storage and interface shared by the native FFT classes, which mirror the FFTW and cuFFT wrappers.
+ * The derived classes implement Execute() and SetSize().
+ */
+template<typename InputType, typename OutputType, typename Backend>
+class BaseNativeFFT
+{
+
+protected:
+
+	typedef hydra::thrust::pointer<InputType, hydra::thrust::host_system_tag> input_tagged_ptr_type;
+	typedef hydra::thrust::pointer<OutputType, hydra::thrust::host_system_tag> output_tagged_ptr_type;
+
+public:
+
+	BaseNativeFFT()=delete;
+
+	BaseNativeFFT(int input_size, int output_size):
+		fNInput(input_size),
+		fNOutput(output_size),
+		fInput(input_size),
+		fOutput(output_size)
+	{}
+
+	BaseNativeFFT(BaseNativeFFT<InputType,OutputType,Backend>&& other)=default;
+
+	BaseNativeFFT<InputType,OutputType,Backend>&
+	operator=(BaseNativeFFT<InputType,OutputType,Backend>&& other)=default;
+
+	template<typename Iterable,
+	typename Type =	typename decltype(*std::declval<Iterable&>().begin())::value_type>
+	inline typename std::enable_if<std::is_convertible<InputType, Type>::value
+	                        && detail::is_iterable<Iterable>::value, void>::type
+	LoadInputData( Iterable&& container)
+	{
+		using hydra::thrust::raw_pointer_cast;
+
+		LoadInput(std::forward<Iterable>(container).size(),
+				reinterpret_cast<const InputType*>(
+						raw_pointer_cast(std::forward<Iterable>(container).data())));
+	}
+
+	inline void	LoadInputData(int size,	input_tagged_ptr_type data)
+	{
+		LoadInput(size, data.get());
+	}
+
+	inline void	LoadInputData(int size, const InputType* data)
+	{
+		LoadInput(size, data);
+	}
+
+	virtual void Execute()=0;
+
+	inline hydra::pair<input_tagged_ptr_type, int>
+	GetInputData()
+	{
+		return hydra::make_pair(input_tagged_ptr_type(fInput.data()), fNInput );
+	}
+
+	inline hydra::pair<output_tagged_ptr_type, int>
+	GetOutputData()
+	{
+		return hydra::make_pair(output_tagged_ptr_type(fOutput.data()), fNOutput );
+	}
+
+	inline int GetSize() const
+	{
+		return  fNInput > fNOutput ? fNInput : fNOutput;
+	}
+
+	int GetNInput() const
+	{
+		return fNInput;
+	}
+
+	int GetNOutput() const
+	{
+		return fNOutput;
+	}
+
+	virtual void SetSize(int logical_size)=0;
+
+	virtual ~BaseNativeFFT()=default;
+
+protected:
+
+	void Reset(int ninput, int noutput)
+	{
+		fNInput  = ninput;
+		fNOutput = noutput;
+
+		fInput.assign(ninput, InputType());
+		fOutput.assign(noutput, OutputType());
+	}
+
+	inline InputType* GetInput() {
+		return fInput.data();
+	}
+
+	inline OutputType* GetOutput() {
+		return fOutput.data();
+	}
+
+private:
+
+	void LoadInput(int size, const InputType* data )
+	{
+		assert(size <= fNInput);
+
+		std::copy(data, data + size, fInput.begin());
+		std::fill(fInput.begin() + size, fInput.end(), InputType());
+	}
+
+	int fNInput;
+	int fNOutput;
+	std::vector<InputType>  fInput;
+	std::vector<OutputType> fOutput;
+};
+
+}  // namespace hydra
+
+#endif /* BASENATIVEFFT_H_ */
@@ -0,0 +1,102 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * ComplexToComplexNativeFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef COMPLEXTOCOMPLEXNATIVEFFT_H_
+#define COMPLEXTOCOMPLEXNATIVEFFT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/native_fft/NativeFFTPlan.h>
+#include <hydra/detail/native_fft/BaseNativeFFT.h>
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+namespace hydra {
+
+/**
+ * \ingroup generic
+ * Unnormalized complex-to-complex transform of `logical_size` points, with the sign convention of
+ * hydra::ComplexToComplexFFTW: -1 for the forward and +1 for the backward transform.
+ */
+template<typename T,
+typename Backend = detail::native_fft::default_backend_type>
+class ComplexToComplexNativeFFT: public BaseNativeFFT<hydra::complex<T>, hydra::complex<T>, Backend >
+{
+	typedef hydra::complex<T> complex_type;
+	typedef detail::native_fft::Plan<T, Backend> plan_type;
+
+public:
+
+	ComplexToComplexNativeFFT()=delete;
+
+	ComplexToComplexNativeFFT(int logical_size, int sign=+1):
+		BaseNativeFFT<complex_type, complex_type, Backend >(logical_size, logical_size),
+		fSign(sign),
+		fPlan(new plan_type(logical_size, sign))
+	{}
+
+	ComplexToComplexNativeFFT(ComplexToComplexNativeFFT<T,Backend>&& other)=default;
+
+	ComplexToComplexNativeFFT<T,Backend>&
+	operator=(ComplexToComplexNativeFFT<T,Backend>&& other)=default;
+
+	void Execute()
+	{
+		fPlan->Execute(this->GetInput(), this->GetOutput());
+	}
+
+	void SetSize(int logical_size){
+		this->Reset(logical_size, logical_size );
+		fPlan.reset(new plan_type(logical_size, fSign));
+	}
+
+	int GetSign() const
+	{
+		return fSign;
+	}
+
+	void SetSign(int sign)
+	{
+		fSign = sign;
+		fPlan.reset(new plan_type(this->GetNInput(), fSign));
+	}
+
+	~ComplexToComplexNativeFFT(){ }
+
+private:
+
+	int fSign;
+	std::unique_ptr<plan_type> fPlan;
+};
+
+}  // namespace hydra
+
+#endif /* COMPLEXTOCOMPLEXNATIVEFFT_H_ */
@@ -0,0 +1,137 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * ComplexToRealNativeFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef COMPLEXTOREALNATIVEFFT_H_
+#define COMPLEXTOREALNATIVEFFT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/native_fft/NativeFFTPlan.h>
+#include <hydra/detail/native_fft/BaseNativeFFT.h>
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+namespace hydra {
+
+/**
+ * \ingroup generic
+ * Unnormalized complex-to-real backward transform, from logical_size/2 + 1 complex coefficients of a
+ * hermitian spectrum to `logical_size` real points, as hydra::ComplexToRealFFTW.
+ * Even sizes are computed with a complex transform of half size, whose output is the packed pairs of points.
+ */
+template<typename T,
+typename Backend = detail::native_fft::default_backend_type>
+class ComplexToRealNativeFFT: public BaseNativeFFT<hydra::complex<T>, T, Backend >
+{
+	typedef hydra::complex<T> complex_type;
+	typedef detail::native_fft::Plan<T, Backend> plan_type;
+
+public:
+
+	ComplexToRealNativeFFT()=delete;
+
+	ComplexToRealNativeFFT(int logical_size):
+		BaseNativeFFT<complex_type, T, Backend >(logical_size/2 +1, logical_size)
+	{
+		Initialize(logical_size);
+	}
+
+	ComplexToRealNativeFFT(ComplexToRealNativeFFT<T,Backend>&& other)=default;
+
+	ComplexToRealNativeFFT<T,Backend>&
+	operator=(ComplexToRealNativeFFT<T,Backend>&& other)=default;
+
+	void Execute()
+	{
+		int n = this->GetNOutput();
+
+		if(n % 2 == 0)
+		{
+			fPlan->Launch(n/2, detail::native_fft::RealBackwardPre<T>(this->GetInput(),
+					fBuffer.data(), fTwiddles.data(), n/2));
+
+			// the n/2 complex outputs are the pairs x[2j] + i*x[2j+1]
+			fPlan->Execute(fBuffer.data(), reinterpret_cast<complex_type*>(this->GetOutput()));
+		}
+		else
+		{
+			const complex_type* input = this->GetInput();
+
+			for(int k=0; k<this->GetNInput(); k++)
+				fBuffer[k] = input[k];
+
+			for(int k=this->GetNInput(); k<n; k++)
+				fBuffer[k] = complex_type(input[n-k].real(), -input[n-k].imag());
+
+			fPlan->Execute(fBuffer.data(), fComplexOutput.data());
+
+			for(int i=0; i<n; i++)
+				this->GetOutput()[i] = fComplexOutput[i].real();
+		}
+	}
+
+	void SetSize(int logical_size){
+		this->Reset(logical_size/2 + 1, logical_size );
+		Initialize(logical_size);
+	}
+
+	~ComplexToRealNativeFFT(){ }
+
+private:
+
+	void Initialize(int logical_size)
+	{
+		if(logical_size % 2 == 0)
+		{
+			fPlan.reset(new plan_type(logical_size/2, +1));
+			fBuffer.resize(logical_size/2);
+			fTwiddles = detail::native_fft::make_twiddles<T>(logical_size, 0, logical_size/2);
+			fComplexOutput.clear();
+		}
+		else
+		{
+			fPlan.reset(new plan_type(logical_size, +1));
+			fBuffer.resize(logical_size);
+			fComplexOutput.resize(logical_size);
+			fTwiddles.clear();
+		}
+	}
+
+	std::unique_ptr<plan_type> fPlan;
+	std::vector<complex_type>  fBuffer;
+	std::vector<complex_type>  fComplexOutput;
+	std::vector<complex_type>  fTwiddles;
+};
+
+}  // namespace hydra
+
+#endif /* COMPLEXTOREALNATIVEFFT_H_ */
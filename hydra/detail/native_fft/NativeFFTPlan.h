@@ -0,0 +1,768 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * NativeFFTPlan.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef NATIVEFFTPLAN_H_
+#define NATIVEFFTPLAN_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+namespace hydra {
+
+namespace detail {
+
+namespace native_fft {
+
+/*
+ * transforms shorter than this run serially, as their stages are too short to pay the parallel dispatch
+ */
+constexpr size_t parallel_threshold = size_t(1)<<15;
+
+/*
+ * largest prime radix of the mixed-radix stages. Sizes with larger prime factors use the Bluestein algorithm.
+ */
+constexpr unsigned max_radix = 13;
+
+/*
+ * butterflies processed by each parallel task
+ */
+constexpr size_t chunk_size = 512;
+
+/*
+ * points of the blocks of short transforms carried through all passes together, so that they stay in cache
+ */
+constexpr size_t block_size = size_t(1)<<12;
+
+/*
+ * One pass of the Stockham autosort FFT, on the sub-transforms of length `stride` already computed.
+ * The butterfly j in [0, n/radix) reads `radix` points spaced by n/radix and writes them spaced by `stride`,
+ * so there is no bit-reversal permutation and all butterflies of a pass are independent.
+ * Each call processes the butterflies [c*fChunk, (c+1)*fChunk) of the transform b, with chunk = b*fNChunks + c,
+ * keeping track of the position in the sub-transform without integer divisions. The transforms of a batch are
+ * stored contiguously, n points apart. The twiddles of the pass are stored contiguously,
+ * [k*(radix-1) + r-1] = exp(sign*2*pi*i*r*k/(stride*radix)), followed, for the generic radix, by the
+ * roots exp(sign*2*pi*i*q/radix).
+ * R is the radix for the specialized passes (2, 3 and 4) and zero for the generic one.
+ */
+template<typename T, unsigned R>
+struct StockhamStage
+{
+	typedef hydra::complex<T> complex_type;
+
+	StockhamStage(const complex_type* input, complex_type* output, const complex_type* twiddles,
+			size_t n, unsigned radix, size_t stride, size_t chunk, size_t nchunks, int sign):
+		fSign(sign),
+		fRadix(R ? R : radix),
+		fN(n),
+		fStride(stride),
+		fChunk(chunk),
+		fNChunks(nchunks),
+		fInput(input),
+		fOutput(output),
+		fTwiddles(twiddles)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	StockhamStage(StockhamStage<T,R> const& other):
+		fSign(other.fSign),
+		fRadix(other.fRadix),
+		fN(other.fN),
+		fStride(other.fStride),
+		fChunk(other.fChunk),
+		fNChunks(other.fNChunks),
+		fInput(other.fInput),
+		fOutput(other.fOutput),
+		fTwiddles(other.fTwiddles)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	void operator()(size_t chunk) const
+	{
+		// known at compile time for the specialized radices
+		const unsigned radix = R ? R : fRadix;
+
+		const size_t m     = fN/radix;
+		const size_t batch = chunk/fNChunks;
+		const size_t first = (chunk - batch*fNChunks)*fChunk;
+		const size_t last  = first + fChunk < m ? first + fChunk : m;
+
+		const complex_type* __restrict__ input  = fInput  + batch*fN;
+		complex_type*       __restrict__ output = fOutput + batch*fN;
+
+		size_t k   = first % fStride;
+		size_t out = (first - k)*radix + k;
+
+		complex_type v[R ? R : max_radix];
+
+		for(size_t j=first; j<last; j++)
+		{
+			const complex_type* w = fTwiddles + k*(radix - 1);
+
+			v[0] = input[j];
+
+			for(unsigned r=1; r<radix; r++)
+				v[r] = input[j + r*m]*w[r-1];
+
+			Butterfly(v);
+
+			for(unsigned r=0; r<radix; r++)
+				output[out + r*fStride] = v[r];
+
+			if(++k == fStride) { k = 0; out += (radix - 1)*fStride + 1; }
+			else ++out;
+		}
+	}
+
+private:
+
+	__hydra_host__ __hydra_device__ inline
+	void Butterfly(complex_type* v) const
+	{
+		if constexpr (R==2)
+		{
+			complex_type a = v[0];
+
+			v[0] = a + v[1];
+			v[1] = a - v[1];
+		}
+		else if constexpr (R==3)
+		{
+			const T c = fSign*T(0.86602540378443864676);
+
+			complex_type t = v[1] + v[2];
+			complex_type d = v[1] - v[2];
+			complex_type m = v[0] - T(0.5)*t;
+			complex_type r(-c*d.imag(), c*d.real());
+
+			v[0] = v[0] + t;
+			v[1] = m + r;
+			v[2] = m - r;
+		}
+		else if constexpr (R==4)
+		{
+			complex_type t0 = v[0] + v[2];
+			complex_type t1 = v[0] - v[2];
+			complex_type t2 = v[1] + v[3];
+			complex_type d  = v[1] - v[3];
+			complex_type r(-fSign*d.imag(), fSign*d.real());
+
+			v[0] = t0 + t2;
+			v[1] = t1 + r;
+			v[2] = t0 - t2;
+			v[3] = t1 - r;
+		}
+		else
+		{
+			const complex_type* roots = fTwiddles + fStride*(fRadix - 1);
+
+			complex_type y[max_radix];
+
+			for(unsigned q=0; q<fRadix; q++)
+			{
+				y[q] = v[0];
+
+				for(unsigned r=1; r<fRadix; r++)
+					y[q] += v[r]*roots[(r*q) % fRadix];
+			}
+
+			for(unsigned q=0; q<fRadix; q++)
+				v[q] = y[q];
+		}
+	}
+
+	int      fSign;
+	unsigned fRadix;
+	size_t   fN;
+	size_t   fStride;
+	size_t   fChunk;
+	size_t   fNChunks;
+	const complex_type* __restrict__ fInput;
+	complex_type*       __restrict__ fOutput;
+	const complex_type* __restrict__ fTwiddles;
+};
+
+/*
+ * All the passes of the transforms [b*fBlock, (b+1)*fBlock) of a batch of short transforms, for the block b.
+ * The intermediate passes are written in the same slices of the two scratch buffers.
+ */
+template<typename T>
+struct StockhamBlock
+{
+	typedef hydra::complex<T> complex_type;
+
+	StockhamBlock(const complex_type* input, complex_type* output, complex_type* buffer0, complex_type* buffer1,
+			const complex_type* twiddles, const size_t* offsets, const unsigned* factors, size_t nfactors,
+			size_t n, size_t batch, size_t block, int sign):
+		fSign(sign),
+		fNFactors(nfactors),
+		fN(n),
+		fBatch(batch),
+		fBlock(block),
+		fInput(input),
+		fOutput(output),
+		fBuffer0(buffer0),
+		fBuffer1(buffer1),
+		fTwiddles(twiddles),
+		fOffsets(offsets),
+		fFactors(factors)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	StockhamBlock(StockhamBlock<T> const& other):
+		fSign(other.fSign),
+		fNFactors(other.fNFactors),
+		fN(other.fN),
+		fBatch(other.fBatch),
+		fBlock(other.fBlock),
+		fInput(other.fInput),
+		fOutput(other.fOutput),
+		fBuffer0(other.fBuffer0),
+		fBuffer1(other.fBuffer1),
+		fTwiddles(other.fTwiddles),
+		fOffsets(other.fOffsets),
+		fFactors(other.fFactors)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	void operator()(size_t block) const
+	{
+		const size_t first = block*fBlock;
+		const size_t count = first + fBlock < fBatch ? fBlock : fBatch - first;
+
+		const complex_type* source = fInput + first*fN;
+
+		size_t stride = 1;
+
+		for(size_t s=0; s<fNFactors; s++)
+		{
+			complex_type* destination = (s + 1 == fNFactors ? fOutput : (s % 2 == 0 ? fBuffer0 : fBuffer1)) + first*fN;
+
+			switch(fFactors[s])
+			{
+			case 2:  Run<2>(s, source, destination, stride, count); break;
+			case 3:  Run<3>(s, source, destination, stride, count); break;
+			case 4:  Run<4>(s, source, destination, stride, count); break;
+			default: Run<0>(s, source, destination, stride, count); break;
+			}
+
+			source  = destination;
+			stride *= fFactors[s];
+		}
+	}
+
+	template<unsigned R>
+	__hydra_host__ __hydra_device__ inline
+	void Run(size_t s, const complex_type* source, complex_type* destination, size_t stride, size_t count) const
+	{
+		StockhamStage<T,R> pass(source, destination, fTwiddles + fOffsets[s], fN, fFactors[s], stride, fN/fFactors[s], 1, fSign);
+
+		for(size_t b=0; b<count; b++) pass(b);
+	}
+
+	int    fSign;
+	size_t fNFactors;
+	size_t fN;
+	size_t fBatch;
+	size_t fBlock;
+	const complex_type* fInput;
+	complex_type*       fOutput;
+	complex_type*       fBuffer0;
+	complex_type*       fBuffer1;
+	const complex_type* fTwiddles;
+	const size_t*       fOffsets;
+	const unsigned*     fFactors;
+};
+
+/*
+ * output[k] = scale*input[k]*chirp[k] for k < n and zero for k >= n, used by the Bluestein algorithm
+ */
+template<typename T>
+struct ChirpMultiply
+{
+	typedef hydra::complex<T> complex_type;
+
+	ChirpMultiply(const complex_type* input, complex_type* output, const complex_type* chirp, size_t n, T scale):
+		fN(n),
+		fScale(scale),
+		fInput(input),
+		fOutput(output),
+		fChirp(chirp)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	ChirpMultiply(ChirpMultiply<T> const& other):
+		fN(other.fN),
+		fScale(other.fScale),
+		fInput(other.fInput),
+		fOutput(other.fOutput),
+		fChirp(other.fChirp)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	void operator()(size_t k) const
+	{
+		fOutput[k] = k < fN ? fScale*fInput[k]*fChirp[k] : complex_type(0.0, 0.0);
+	}
+
+	size_t fN;
+	T      fScale;
+	const complex_type* fInput;
+	complex_type*       fOutput;
+	const complex_type* fChirp;
+};
+
+/*
+ * data[k] *= factor[k]
+ */
+template<typename T>
+struct SpectrumMultiply
+{
+	typedef hydra::complex<T> complex_type;
+
+	SpectrumMultiply(complex_type* data, const complex_type* factor):
+		fData(data),
+		fFactor(factor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	SpectrumMultiply(SpectrumMultiply<T> const& other):
+		fData(other.fData),
+		fFactor(other.fFactor)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	void operator()(size_t k) const
+	{
+		fData[k] *= fFactor[k];
+	}
+
+	complex_type*       fData;
+	const complex_type* fFactor;
+};
+
+/*
+ * Spectrum X[k], k in [0, h], of n=2h real points, from the transform Z of the h complex points x[2j] + i*x[2j+1].
+ * The twiddles are exp(-2*pi*i*k/n).
+ */
+template<typename T>
+struct RealForwardPost
+{
+	typedef hydra::complex<T> complex_type;
+
+	RealForwardPost(const complex_type* input, complex_type* output, const complex_type* twiddles, size_t h):
+		fH(h),
+		fInput(input),
+		fOutput(output),
+		fTwiddles(twiddles)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	RealForwardPost(RealForwardPost<T> const& other):
+		fH(other.fH),
+		fInput(other.fInput),
+		fOutput(other.fOutput),
+		fTwiddles(other.fTwiddles)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	void operator()(size_t k) const
+	{
+		complex_type z  = fInput[k < fH ? k : 0];
+		complex_type zc = fInput[k > 0 ? fH - k : 0];
+
+		zc = complex_type(zc.real(), -zc.imag());
+
+		complex_type even = T(0.5)*(z + zc);
+		complex_type diff = z - zc;
+		complex_type odd(T(0.5)*diff.imag(), -T(0.5)*diff.real());
+
+		fOutput[k] = even + fTwiddles[k]*odd;
+	}
+
+	size_t fH;
+	const complex_type* fInput;
+	complex_type*       fOutput;
+	const complex_type* fTwiddles;
+};
+
+/*
+ * Inverse of RealForwardPost: builds, from the spectrum X[k], k in [0, h], of n=2h real points,
+ * the spectrum Z of the h complex points x[2j] + i*x[2j+1], scaled by two to keep the unnormalized convention.
+ */
+template<typename T>
+struct RealBackwardPre
+{
+	typedef hydra::complex<T> complex_type;
+
+	RealBackwardPre(const complex_type* input, complex_type* output, const complex_type* twiddles, size_t h):
+		fH(h),
+		fInput(input),
+		fOutput(output),
+		fTwiddles(twiddles)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	RealBackwardPre(RealBackwardPre<T> const& other):
+		fH(other.fH),
+		fInput(other.fInput),
+		fOutput(other.fOutput),
+		fTwiddles(other.fTwiddles)
+	{}
+
+	__hydra_host__ __hydra_device__ inline
+	void operator()(size_t k) const
+	{
+		complex_type x  = fInput[k];
+		complex_type xc = fInput[fH - k];
+		complex_type w  = fTwiddles[k];
+
+		xc = complex_type(xc.real(), -xc.imag());
+
+		complex_type even = x + xc;
+		complex_type odd  = (x - xc)*complex_type(w.real(), -w.imag());
+
+		fOutput[k] = even + complex_type(-odd.imag(), odd.real());
+	}
+
+	size_t fH;
+	const complex_type* fInput;
+	complex_type*       fOutput;
+	const complex_type* fTwiddles;
+};
+
+/*
+ * exp(-2*pi*i*k/n), for k in [first, last)
+ */
+template<typename T>
+inline std::vector<hydra::complex<T>> make_twiddles(size_t n, size_t first, size_t last)
+{
+	std::vector<hydra::complex<T>> twiddles(last - first);
+
+	for(size_t k=first; k<last; k++)
+	{
+		double angle = -2.0*PI*double(k)/double(n);
+
+		twiddles[k - first] = hydra::complex<T>(::cos(angle), ::sin(angle));
+	}
+
+	return twiddles;
+}
+
+/*
+ * Unnormalized complex-to-complex transform of fixed size and sign, output[k] = sum_j input[j] exp(sign*2*pi*i*j*k/n).
+ * Sizes factorizable in primes up to max_radix are computed with Stockham passes of radix 4, 2, 3 and the generic
+ * prime radices; the other sizes are mapped by the Bluestein algorithm to a convolution computed with power-of-two
+ * transforms. The passes of transforms of size above parallel_threshold are split in chunks of chunk_size
+ * butterflies, processed in parallel on the back-end Backend. Batches of transforms stored contiguously are
+ * processed in the same passes. When the batch as a whole is above parallel_threshold, the short transforms
+ * are grouped in blocks of about block_size points, each carried through all passes while in cache,
+ * and the blocks run in parallel.
+ */
+template<typename T, typename Backend>
+class Plan
+{
+	typedef hydra::complex<T> complex_type;
+
+public:
+
+	Plan()=delete;
+
+	Plan(size_t n, int sign):
+		fN(n),
+		fSign(sign < 0 ? -1 : +1)
+	{
+		if(n==0)
+			throw std::invalid_argument("[hydra::NativeFFT]: Transform size is zero. (n==0)");
+
+		Initialize();
+	}
+
+	Plan(Plan<T,Backend> const&)=delete;
+	Plan<T,Backend>& operator=(Plan<T,Backend> const&)=delete;
+
+	/**
+	 * computes the transform of input in output, which must not overlap.
+	 */
+	inline void Execute(const complex_type* input, complex_type* output)
+	{
+		Execute(input, output, 1);
+	}
+
+	/**
+	 * computes the transforms of the batch of `batch` sequences stored contiguously in input, writing them
+	 * in output, which must not overlap.
+	 */
+	inline void Execute(const complex_type* input, complex_type* output, size_t batch)
+	{
+		if(fBluestein)
+		{
+			for(size_t b=0; b<batch; b++)
+				ExecuteBluestein(input + b*fN, output + b*fN);
+
+			return;
+		}
+
+		if(fFactors.empty())
+		{
+			for(size_t b=0; b<batch; b++) output[b] = input[b];
+
+			return;
+		}
+
+		if(fFactors.size() > 1 && fBuffer0.size() < batch*fN) fBuffer0.resize(batch*fN);
+		if(fFactors.size() > 2 && fBuffer1.size() < batch*fN) fBuffer1.resize(batch*fN);
+
+		if(batch > 1 && batch*fN >= parallel_threshold && fN < parallel_threshold)
+		{
+			size_t block   = fN < block_size ? block_size/fN : 1;
+			size_t nblocks = (batch + block - 1)/block;
+
+			hydra::thrust::counting_iterator<size_t> first(0);
+
+			hydra::thrust::for_each(Backend(), first, first + nblocks,
+					StockhamBlock<T>(input, output, fBuffer0.data(), fBuffer1.data(), fTwiddles.data(),
+							fOffsets.data(), fFactors.data(), fFactors.size(), fN, batch, block, fSign));
+
+			return;
+		}
+
+		const complex_type* source = input;
+
+		size_t stride = 1;
+
+		for(size_t s=0; s<fFactors.size(); s++)
+		{
+			complex_type* destination = s + 1 == fFactors.size() ? output :
+					(s % 2 == 0 ? fBuffer0.data() : fBuffer1.data());
+
+			switch(fFactors[s])
+			{
+			case 2:  RunStage<2>(s, source, destination, 2, stride, batch); break;
+			case 3:  RunStage<3>(s, source, destination, 3, stride, batch); break;
+			case 4:  RunStage<4>(s, source, destination, 4, stride, batch); break;
+			default: RunStage<0>(s, source, destination, fFactors[s], stride, batch); break;
+			}
+
+			source  = destination;
+			stride *= fFactors[s];
+		}
+	}
+
+	inline size_t GetSize() const {
+		return fN;
+	}
+
+	inline int GetSign() const {
+		return fSign;
+	}
+
+	inline bool IsBluestein() const {
+		return fBluestein;
+	}
+
+	inline std::vector<unsigned> const& GetFactors() const {
+		return fFactors;
+	}
+
+	template<typename Functor>
+	inline void Launch(size_t count, Functor const& functor) const
+	{
+		if(fN < parallel_threshold)
+		{
+			for(size_t i=0; i<count; i++) functor(i);
+		}
+		else
+		{
+			hydra::thrust::counting_iterator<size_t> first(0);
+
+			hydra::thrust::for_each(Backend(), first, first + count, functor);
+		}
+	}
+
+private:
+
+	void Initialize()
+	{
+		size_t n = fN;
+
+		while(n % 4 == 0){ fFactors.push_back(4); n /= 4; }
+		while(n % 2 == 0){ fFactors.push_back(2); n /= 2; }
+
+		for(unsigned p=3; p<=max_radix; p+=2)
+			while(n % p == 0){ fFactors.push_back(p); n /= p; }
+
+		fBluestein = n > 1;
+
+		if(!fBluestein)
+		{
+			InitializeTwiddles();
+
+			if(fFactors.size() > 1) fBuffer0.resize(fN);
+			if(fFactors.size() > 2) fBuffer1.resize(fN);
+
+			return;
+		}
+
+		/*
+		 * Bluestein: X[k] = c[k] sum_j (x[j] c[j]) conj(c[k-j]), with c[k]=exp(sign*i*pi*k^2/n),
+		 * a circular convolution of size m >= 2n-1, m power of two
+		 */
+		fFactors.clear();
+
+		size_t m = 1;
+		while(m < 2*fN - 1) m <<= 1;
+
+		fForward.reset(new Plan<T,Backend>(m, -1));
+		fBackward.reset(new Plan<T,Backend>(m, +1));
+
+		fChirp.resize(fN);
+
+		for(size_t k=0; k<fN; k++)
+		{
+			// k^2 mod 2n keeps the argument small
+			double angle = fSign*PI*double((k*k) % (2*fN))/double(fN);
+
+			fChirp[k] = complex_type(::cos(angle), ::sin(angle));
+		}
+
+		fBuffer0.assign(m, complex_type(0.0, 0.0));
+		fBuffer1.resize(m);
+
+		fBuffer0[0] = complex_type(fChirp[0].real(), -fChirp[0].imag());
+
+		for(size_t k=1; k<fN; k++)
+		{
+			fBuffer0[k]     = complex_type(fChirp[k].real(), -fChirp[k].imag());
+			fBuffer0[m - k] = fBuffer0[k];
+		}
+
+		fChirpSpectrum.resize(m);
+
+		fForward->Execute(fBuffer0.data(), fChirpSpectrum.data());
+	}
+
+	/*
+	 * twiddles of all passes, see StockhamStage
+	 */
+	void InitializeTwiddles()
+	{
+		size_t stride = 1;
+
+		for(auto radix: fFactors)
+		{
+			fOffsets.push_back(fTwiddles.size());
+
+			for(size_t k=0; k<stride; k++)
+				for(unsigned r=1; r<radix; r++)
+					fTwiddles.push_back(Root(r*k, stride*radix));
+
+			if(radix > 4)
+				for(unsigned q=0; q<radix; q++)
+					fTwiddles.push_back(Root(q, radix));
+
+			stride *= radix;
+		}
+	}
+
+	// exp(sign*2*pi*i*k/n)
+	inline complex_type Root(size_t k, size_t n) const
+	{
+		double angle = fSign*2.0*PI*double(k)/double(n);
+
+		return complex_type(::cos(angle), ::sin(angle));
+	}
+
+	template<unsigned R>
+	inline void RunStage(size_t stage, const complex_type* input, complex_type* output, unsigned radix,
+			size_t stride, size_t batch)
+	{
+		size_t m = fN/radix;
+
+		if(batch*fN < parallel_threshold)
+		{
+			StockhamStage<T,R> pass(input, output, fTwiddles.data() + fOffsets[stage], fN, radix, stride, m, 1, fSign);
+
+			for(size_t b=0; b<batch; b++) pass(b);
+		}
+		else
+		{
+			size_t nchunks = (m + chunk_size - 1)/chunk_size;
+
+			hydra::thrust::counting_iterator<size_t> first(0);
+
+			hydra::thrust::for_each(Backend(), first, first + batch*nchunks,
+					StockhamStage<T,R>(input, output, fTwiddles.data() + fOffsets[stage], fN, radix, stride, chunk_size, nchunks, fSign));
+		}
+	}
+
+	inline void ExecuteBluestein(const complex_type* input, complex_type* output)
+	{
+		size_t m = fChirpSpectrum.size();
+
+		Launch(m, ChirpMultiply<T>(input, fBuffer0.data(), fChirp.data(), fN, T(1.0)));
+
+		fForward->Execute(fBuffer0.data(), fBuffer1.data());
+
+		Launch(m, SpectrumMultiply<T>(fBuffer1.data(), fChirpSpectrum.data()));
+
+		fBackward->Execute(fBuffer1.data(), fBuffer0.data());
+
+		Launch(fN, ChirpMultiply<T>(fBuffer0.data(), output, fChirp.data(), fN, T(1.0)/m));
+	}
+
+	size_t fN;
+	int    fSign;
+	bool   fBluestein;
+	std::vector<unsigned>     fFactors;
+	std::vector<size_t>       fOffsets;
+	std::vector<complex_type> fTwiddles;
+	std::vector<complex_type> fBuffer0;
+	std::vector<complex_type> fBuffer1;
+	std::vector<complex_type> fChirp;
+	std::vector<complex_type> fChirpSpectrum;
+	std::unique_ptr<Plan<T,Backend>> fForward;
+	std::unique_ptr<Plan<T,Backend>> fBackward;
+};
+
+}  // namespace native_fft
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* NATIVEFFTPLAN_H_ */
@@ -0,0 +1,131 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * RealToComplexNativeFFT.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef REALTOCOMPLEXNATIVEFFT_H_
+#define REALTOCOMPLEXNATIVEFFT_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/native_fft/NativeFFTPlan.h>
+#include <hydra/detail/native_fft/BaseNativeFFT.h>
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+namespace hydra {
+
+/**
+ * \ingroup generic
+ * Unnormalized real-to-complex forward transform of `logical_size` points, producing logical_size/2 + 1
+ * complex coefficients, as hydra::RealToComplexFFTW.
+ * Even sizes are computed with a complex transform of half size on the packed pairs of points.
+ */
+template<typename T,
+typename Backend = detail::native_fft::default_backend_type>
+class RealToComplexNativeFFT: public BaseNativeFFT<T, hydra::complex<T>, Backend >
+{
+	typedef hydra::complex<T> complex_type;
+	typedef detail::native_fft::Plan<T, Backend> plan_type;
+
+public:
+
+	RealToComplexNativeFFT()=delete;
+
+	RealToComplexNativeFFT(int logical_size):
+		BaseNativeFFT<T, complex_type, Backend >(logical_size, logical_size/2 +1)
+	{
+		Initialize(logical_size);
+	}
+
+	RealToComplexNativeFFT(RealToComplexNativeFFT<T,Backend>&& other)=default;
+
+	RealToComplexNativeFFT<T,Backend>&
+	operator=(RealToComplexNativeFFT<T,Backend>&& other)=default;
+
+	void Execute()
+	{
+		int n = this->GetNInput();
+
+		if(n % 2 == 0)
+		{
+			// the real buffer is read as n/2 complex points x[2j] + i*x[2j+1]
+			fPlan->Execute(reinterpret_cast<const complex_type*>(this->GetInput()), fBuffer.data());
+
+			fPlan->Launch(n/2 + 1, detail::native_fft::RealForwardPost<T>(fBuffer.data(),
+					this->GetOutput(), fTwiddles.data(), n/2));
+		}
+		else
+		{
+			for(int i=0; i<n; i++)
+				fComplexInput[i] = complex_type(this->GetInput()[i], 0.0);
+
+			fPlan->Execute(fComplexInput.data(), fBuffer.data());
+
+			std::copy(fBuffer.begin(), fBuffer.begin() + this->GetNOutput(), this->GetOutput());
+		}
+	}
+
+	void SetSize(int logical_size){
+		this->Reset(logical_size, logical_size/2 + 1 );
+		Initialize(logical_size);
+	}
+
+	~RealToComplexNativeFFT(){ }
+
+private:
+
+	void Initialize(int logical_size)
+	{
+		if(logical_size % 2 == 0)
+		{
+			fPlan.reset(new plan_type(logical_size/2, -1));
+			fBuffer.resize(logical_size/2);
+			fTwiddles = detail::native_fft::make_twiddles<T>(logical_size, 0, logical_size/2 + 1);
+			fComplexInput.clear();
+		}
+		else
+		{
+			fPlan.reset(new plan_type(logical_size, -1));
+			fBuffer.resize(logical_size);
+			fComplexInput.resize(logical_size);
+			fTwiddles.clear();
+		}
+	}
+
+	std::unique_ptr<plan_type> fPlan;
+	std::vector<complex_type>  fBuffer;
+	std::vector<complex_type>  fComplexInput;
+	std::vector<complex_type>  fTwiddles;
+};
+
+}  // namespace hydra
+
+#endif /* REALTOCOMPLEXNATIVEFFT_H_ */
@@ -0,0 +1,123 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+/*
+ * SortingNetwork.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SORTINGNETWORK_H_
+#define SORTINGNETWORK_H_
+
+#include <hydra/detail/Config.h>
+
+#include <stddef.h>
+
+namespace hydra {
+
+namespace detail {
+
+namespace sorting_network {
+
+//smallest power of two not smaller than n
+constexpr size_t ceil_pow2(size_t n, size_t p=1)
+{
+	return p >= n ? p : ceil_pow2(n, 2*p);
+}
+
+//branch-free compare-exchange of the elements I and J (I<J).
+//Comparators touching the padding (J >= M) are dropped.
+template<size_t I, size_t J, size_t M, typename T>
+__hydra_host__ __hydra_device__
+inline void compare_exchange(T* array)
+{
+	if constexpr (J < M)
+	{
+		T a = array[I];
+		T b = array[J];
+		array[I] = a < b ? a : b;
+		array[J] = a < b ? b : a;
+	}
+}
+
+template<size_t I, size_t End, size_t R, size_t Step, size_t M, typename T>
+__hydra_host__ __hydra_device__
+inline void merge_pairs(T* array)
+{
+	if constexpr (I + R < End)
+	{
+		compare_exchange<I, I + R, M>(array);
+		merge_pairs<I + Step, End, R, Step, M>(array);
+	}
+}
+
+//Batcher's odd-even merge of the subsequence lo, lo+r, lo+2r, ... of length n
+template<size_t Lo, size_t N, size_t R, size_t M, typename T>
+__hydra_host__ __hydra_device__
+inline void odd_even_merge(T* array)
+{
+	if constexpr (2*R < N)
+	{
+		odd_even_merge<Lo, N, 2*R, M>(array);
+		odd_even_merge<Lo + R, N, 2*R, M>(array);
+		merge_pairs<Lo + R, Lo + N, R, 2*R, M>(array);
+	}
+	else
+	{
+		compare_exchange<Lo, Lo + R, M>(array);
+	}
+}
+
+template<size_t Lo, size_t N, size_t M, typename T>
+__hydra_host__ __hydra_device__
+inline void odd_even_merge_sort(T* array)
+{
+	if constexpr (N > 1)
+	{
+		odd_even_merge_sort<Lo, N/2, M>(array);
+		odd_even_merge_sort<Lo + N/2, N/2, M>(array);
+		odd_even_merge<Lo, N, 1, M>(array);
+	}
+}
+
+}  // namespace sorting_network
+
+/**
+ * Sort the M elements starting at `array` in ascending order, using a
+ * Batcher odd-even merge sorting network generated at compile time.
+ * The network is built for the next power of two, and the comparators
+ * touching the padding elements are discarded, so the sequence of
+ * compare-exchanges is fixed and free of data-dependent branches.
+ */
+template<size_t M, typename T>
+__hydra_host__ __hydra_device__
+inline void sort_network(T* array)
+{
+	sorting_network::odd_even_merge_sort<0, sorting_network::ceil_pow2(M), M>(array);
+}
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* SORTINGNETWORK_H_ */
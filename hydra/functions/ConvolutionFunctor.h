@@ -189,7 +189,8 @@ typedef typename detail::convolution::_traits<hydra::thrust::tuple<Functor, Kern
 		fMax(kmax),
 	    fXMin(abiscissae_type{}),
 		fXMax(abiscissae_type{}),
-		fInterpolate(interpolate)
+		fInterpolate(interpolate),
+		fEngine(new ConvolutionEngine<fft_type>())
 	{
 		//std::cout << ">>ConvolutionFunctor()"<<std::endl;
 
@@ -221,7 +222,8 @@ typedef typename detail::convolution::_traits<hydra::thrust::tuple<Functor, Kern
 	fInterpolate(other.IsInterpolated()),
 	fDeviceData(other.GetDeviceData()),
 	fHostData(other.GetHostData()),
-	fFFTData(other.GetFFTData())
+	fFFTData(other.GetFFTData()),
+	fEngine(other.GetEngine())
 	{}
 
 	__hydra_host__ __hydra_device__
@@ -240,6 +242,7 @@ typedef typename detail::convolution::_traits<hydra::thrust::tuple<Functor, Kern
 		fDeviceData  = other.GetDeviceData();
 		fHostData    = other.GetHostData();
 		fFFTData     = other.GetFFTData();
+		fEngine      = other.GetEngine();
 
 		return *this;
 	}
@@ -275,7 +278,8 @@ typedef typename detail::convolution::_traits<hydra::thrust::tuple<Functor, Kern
 
 		auto data = make_range(fFFTData, fFFTData + fNSamples );
 
-		hydra::convolute(fft_system_type(), fft_type(),
+		// the engine keeps the plans and skips the kernel transform if its parameters did not change
+		fEngine->Convolute(fft_system_type(),
 				hydra::thrust::get<0>(this->GetFunctors()),
 				hydra::thrust::get<1>(this->GetFunctors()),
 				fMin, fMax, data, false);
@@ -328,6 +332,8 @@ void Dispose(){
 		return_temporary_buffer(  host_system_type(),   fHostData, fNSamples );
 		return_temporary_buffer(  fft_system_type()  , fFFTData, fNSamples );
 
+		delete fEngine;
+		fEngine = nullptr;
 	}
 
 	virtual ~ConvolutionFunctor()=default;
@@ -352,6 +358,15 @@ void Dispose(){
 	const host_pointer_type& GetHostData() const {
 		return fHostData;
 	}
+
+	/**
+	 * @brief FFT plans, buffers and kernel spectrum, shared by the copies of this functor and released by Dispose().
+	 */
+	__hydra_host__ __hydra_device__
+	ConvolutionEngine<fft_type>* GetEngine() const {
+		return fEngine;
+	}
+
 private:
 
 
@@ -380,6 +395,7 @@ private:
     device_pointer_type fDeviceData;
     host_pointer_type   fHostData;
     fft_pointer_type    fFFTData ;
+    ConvolutionEngine<fft_type>* fEngine;
 
 
 };
@@ -0,0 +1,433 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * ConvolutionFunctorND.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef CONVOLUTIONFUNCTORND_H_
+#define CONVOLUTIONFUNCTORND_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/detail/BaseCompositeFunctor.h>
+#include <hydra/detail/utility/Utility_Tuple.h>
+#include <hydra/Parameter.h>
+#include <hydra/Tuple.h>
+#include <hydra/Range.h>
+#include <hydra/Spline.h>
+#include <hydra/Convolution.h>
+#include <hydra/ConvolutionEngine.h>
+#include <hydra/functions/ConvolutionFunctor.h>
+#include <hydra/detail/FFTPolicy.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/fill.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/transform_iterator.h>
+
+#include <array>
+#include <type_traits>
+
+
+namespace hydra {
+
+namespace detail {
+
+	namespace convolution {
+
+		template<typename T, typename ...ArgTypes>
+		struct _traits_nd;
+
+		template<typename Functor, typename Kernel, typename ...ArgTypes>
+		struct _traits_nd< hydra::thrust::tuple<Functor, Kernel>, ArgTypes...>
+		{
+			typedef typename std::common_type<
+					typename Functor::return_type,
+					typename Kernel::return_type
+					>::type return_type;
+
+			using signature = return_type(ArgTypes...) ;
+		};
+
+	}  // namespace convolution
+
+}  // namespace detail
+
+/**
+ * \ingroup common_functions
+ *
+ * \brief Convolution of two functors of two or three variables, sampled over a regular grid with FFTs
+ * and evaluated at arbitrary points with hydra::spline2D or hydra::spline3D.
+ *
+ * The grid has nsamples[a] points spanning [min[a], max[a]) along the axis a and is
+ * computed by ConvolutionEngine::Convolute, whose plans, buffers and kernel spectrum are shared by the copies of
+ * the functor and released by Dispose(), as for hydra::ConvolutionFunctor. The samples are the Riemann sums approximating the
+ * convolution integral. With interpolation disabled, the functor returns the sample of the grid cell containing the point.
+ *
+ * \tparam Functor signal, function of the variables ArgTypes...
+ * \tparam Kernel convolution kernel, function of the displacements along each axis.
+ * \tparam Backend memory space keeping the samples evaluated by the device.
+ * \tparam FFT hydra::detail::FFTPolicy, which sets the precision and the FFT library.
+ */
+template<typename Functor, typename Kernel, typename Backend, typename FFT, typename ...ArgTypes>
+class ConvolutionFunctorND;
+
+template<typename Functor, typename Kernel, detail::Backend BACKEND, typename T, detail::FFTCalculator FFT, typename ...ArgTypes>
+class ConvolutionFunctorND< Functor, Kernel, detail::BackendPolicy<BACKEND>, detail::FFTPolicy<T, FFT>, ArgTypes...> :
+	public BaseCompositeFunctor<
+		ConvolutionFunctorND< Functor, Kernel, detail::BackendPolicy<BACKEND>, detail::FFTPolicy<T, FFT>, ArgTypes...>,
+		hydra::thrust::tuple<Functor, Kernel>,
+		typename  detail::convolution::_traits_nd<hydra::thrust::tuple<Functor, Kernel>, ArgTypes...>::signature
+	>
+{
+	static constexpr size_t N = sizeof...(ArgTypes);
+
+	static_assert( N==2 || N==3, "[hydra::ConvolutionFunctorND]: Only functors of two or three variables are supported." );
+
+	typedef T value_type;
+
+	typedef ConvolutionFunctorND< Functor, Kernel, detail::BackendPolicy<BACKEND>, detail::FFTPolicy<T, FFT>, ArgTypes...> this_type;
+
+	typedef BaseCompositeFunctor< this_type, hydra::thrust::tuple<Functor, Kernel>,
+			typename  detail::convolution::_traits_nd<hydra::thrust::tuple<Functor, Kernel>, ArgTypes...>::signature
+	> super_type;
+
+	typedef hydra::detail::FFTPolicy<value_type, FFT>    fft_type;
+
+	//hydra backend
+	typedef typename detail::BackendPolicy<BACKEND> device_system_type;
+	typedef typename fft_type::host_backend_type      host_system_type;
+	typedef typename fft_type::device_backend_type     fft_system_type;
+
+	//raw thrust backend
+	typedef typename std::remove_const<decltype(   std::declval<fft_system_type>().backend)>::type	raw_fft_system_type;
+	typedef typename std::remove_const<decltype(std::declval<device_system_type>().backend)>::type  raw_device_system_type;
+	typedef typename std::remove_const<decltype( std::declval< host_system_type>().backend)>::type  raw_host_system_type;
+
+	//pointers
+	typedef hydra::thrust::pointer<value_type, raw_host_system_type>      host_pointer_type;
+	typedef hydra::thrust::pointer<value_type, raw_device_system_type>  device_pointer_type;
+	typedef hydra::thrust::pointer<value_type, raw_fft_system_type>        fft_pointer_type;
+
+	//iterator
+	typedef hydra::thrust::transform_iterator< detail::convolution::_delta<value_type>,
+	          hydra::thrust::counting_iterator<unsigned> > abiscissae_type;
+
+public:
+
+	typedef typename detail::convolution::_traits_nd<hydra::thrust::tuple<Functor, Kernel>, ArgTypes...>::return_type return_t;
+
+	ConvolutionFunctorND() = delete;
+
+	/**
+	 * @param functor signal.
+	 * @param kernel convolution kernel.
+	 * @param min lower limits of the sampling region.
+	 * @param max upper limits of the sampling region.
+	 * @param nsamples number of samples along each axis.
+	 * @param interpolate evaluate the convolution with a cubic spline over the grid.
+	 */
+	ConvolutionFunctorND( Functor const& functor, Kernel const& kernel,
+			std::array<value_type, N> const& min, std::array<value_type, N> const& max,
+			std::array<size_t, N> const& nsamples, bool interpolate=true):
+		super_type(functor,kernel),
+		fNValues(1),
+		fNBuffer(0),
+		fInterpolate(interpolate),
+		fEngine(nullptr)
+	{
+		using hydra::thrust::get_temporary_buffer;
+
+		for(size_t a=0; a<N; a++)
+		{
+			if( nsamples[a] < 2 )
+				throw std::invalid_argument("[hydra::ConvolutionFunctorND]: Less than two samples per axis. (nsamples[a] < 2)");
+
+			fNSamples[a] = nsamples[a];
+			fMin[a]      = min[a];
+			fMax[a]      = max[a];
+			fX[a]        = abiscissae_type(hydra::thrust::counting_iterator<unsigned>(0),
+					detail::convolution::_delta<value_type>(min[a], (max[a]-min[a])/nsamples[a]) );
+
+			fNValues *= nsamples[a];
+		}
+
+		// the splines read up to two rows (planes) past the end of the grid
+		fNBuffer = fNValues + 3*(fNValues/fNSamples[N-1]) + 3;
+
+		fEngine = new ConvolutionEngine<fft_type>();
+
+		fFFTData    = get_temporary_buffer<value_type>(raw_fft_system_type(), fNValues).first;
+		fHostData   = get_temporary_buffer<value_type>(raw_host_system_type(), fNBuffer).first;
+		fDeviceData = get_temporary_buffer<value_type>(raw_device_system_type(), fNBuffer).first;
+
+		hydra::thrust::fill_n( fHostData   + fNValues, fNBuffer - fNValues, value_type(0.0) );
+		hydra::thrust::fill_n( fDeviceData + fNValues, fNBuffer - fNValues, value_type(0.0) );
+
+		Update();
+	}
+
+	__hydra_host__ __hydra_device__
+	ConvolutionFunctorND( this_type const& other):
+		super_type(other),
+		fNValues(other.GetNValues()),
+		fNBuffer(other.GetNBuffer()),
+		fInterpolate(other.IsInterpolated()),
+		fDeviceData(other.GetDeviceData()),
+		fHostData(other.GetHostData()),
+		fFFTData(other.GetFFTData()),
+		fEngine(other.GetEngine())
+	{
+		for(size_t a=0; a<N; a++){
+			fNSamples[a] = other.GetNSamples(a);
+			fMin[a]      = other.GetMin(a);
+			fMax[a]      = other.GetMax(a);
+			fX[a]        = other.GetAbscissae(a);
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	this_type& operator=(this_type const& other){
+
+		if(this == &other) return *this;
+
+		super_type::operator=(other);
+
+		for(size_t a=0; a<N; a++){
+			fNSamples[a] = other.GetNSamples(a);
+			fMin[a]      = other.GetMin(a);
+			fMax[a]      = other.GetMax(a);
+			fX[a]        = other.GetAbscissae(a);
+		}
+
+		fNValues     = other.GetNValues();
+		fNBuffer     = other.GetNBuffer();
+		fInterpolate = other.IsInterpolated();
+		fDeviceData  = other.GetDeviceData();
+		fHostData    = other.GetHostData();
+		fFFTData     = other.GetFFTData();
+		fEngine      = other.GetEngine();
+
+		return *this;
+	}
+
+	virtual void Update() override
+	{
+		std::array<value_type, N> min, max;
+		std::array<size_t, N> nsamples;
+
+		for(size_t a=0; a<N; a++){
+			min[a]      = fMin[a];
+			max[a]      = fMax[a];
+			nsamples[a] = fNSamples[a];
+		}
+
+		auto data = make_range(fFFTData, fFFTData + fNValues );
+
+		fEngine->Convolute(fft_system_type(),
+				hydra::thrust::get<0>(this->GetFunctors()),
+				hydra::thrust::get<1>(this->GetFunctors()),
+				min, max, nsamples, data);
+
+		sync_data<FFT>();
+	}
+
+	__hydra_host__ __hydra_device__
+	inline return_t Evaluate(ArgTypes... X) const	{
+
+#ifdef __CUDA_ARCH__
+		return Interpolate(fDeviceData, X...);
+#else
+		return Interpolate(fHostData, X...);
+#endif
+	}
+
+	void Dispose(){
+
+		using hydra::thrust::return_temporary_buffer;
+
+		return_temporary_buffer(  device_system_type(), fDeviceData, fNBuffer );
+		return_temporary_buffer(  host_system_type(),   fHostData,   fNBuffer );
+		return_temporary_buffer(  fft_system_type()  ,  fFFTData,    fNValues );
+
+		delete fEngine;
+		fEngine = nullptr;
+	}
+
+	virtual ~ConvolutionFunctorND()=default;
+
+	__hydra_host__ __hydra_device__
+	inline bool IsInterpolated() const{
+		return fInterpolate;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline void SetInterpolate(bool interpolate){
+		fInterpolate = interpolate;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline size_t GetNSamples(size_t axis) const {
+		return fNSamples[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline value_type GetMin(size_t axis) const {
+		return fMin[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline value_type GetMax(size_t axis) const {
+		return fMax[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline const abiscissae_type& GetAbscissae(size_t axis) const {
+		return fX[axis];
+	}
+
+	/**
+	 * @brief Number of grid points.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNValues() const {
+		return fNValues;
+	}
+
+	/**
+	 * @brief Size of the buffers holding the samples, including the padding read by the splines.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNBuffer() const {
+		return fNBuffer;
+	}
+
+	__hydra_host__ __hydra_device__
+	const device_pointer_type& GetDeviceData() const {
+		return fDeviceData;
+	}
+
+	__hydra_host__ __hydra_device__
+	const fft_pointer_type& GetFFTData() const {
+		return fFFTData;
+	}
+
+	__hydra_host__ __hydra_device__
+	const host_pointer_type& GetHostData() const {
+		return fHostData;
+	}
+
+	/**
+	 * @brief FFT plans, buffers and kernel spectrum, shared by the copies of this functor and released by Dispose().
+	 */
+	__hydra_host__ __hydra_device__
+	ConvolutionEngine<fft_type>* GetEngine() const {
+		return fEngine;
+	}
+
+private:
+
+	__hydra_host__ __hydra_device__
+	inline size_t Bin(size_t axis, value_type x) const
+	{
+		if( !(x > fMin[axis]) ) return 0;
+
+		size_t bin = fNSamples[axis]*(x - fMin[axis])/(fMax[axis] - fMin[axis]);
+
+		return bin < fNSamples[axis] ? bin : fNSamples[axis] - 1;
+	}
+
+	template<typename Pointer, typename TX, typename TY>
+	__hydra_host__ __hydra_device__
+	inline return_t Interpolate(Pointer data, TX X, TY Y) const
+	{
+		value_type x = X, y = Y;
+
+		if( fInterpolate )
+			return spline2D(fX[0], fX[0] + fNSamples[0], fX[1], fX[1] + fNSamples[1], data, x, y);
+
+		return data[ Bin(0, x) + fNSamples[0]*Bin(1, y) ];
+	}
+
+	template<typename Pointer, typename TX, typename TY, typename TZ>
+	__hydra_host__ __hydra_device__
+	inline return_t Interpolate(Pointer data, TX X, TY Y, TZ Z) const
+	{
+		value_type x = X, y = Y, z = Z;
+
+		if( fInterpolate )
+			return spline3D(fX[0], fX[0] + fNSamples[0], fX[1], fX[1] + fNSamples[1],
+					fX[2], fX[2] + fNSamples[2], data, x, y, z);
+
+		return data[ Bin(0, x) + fNSamples[0]*(Bin(1, y) + fNSamples[1]*Bin(2, z)) ];
+	}
+
+	template<detail::FFTCalculator FFTC=FFT>
+	inline typename std::enable_if<FFTC ==detail::CuFFT>::type
+	sync_data()
+	{
+		hydra::thrust::copy_n( fFFTData, fNValues, fDeviceData );
+		hydra::thrust::copy_n( fFFTData, fNValues, fHostData );
+	}
+
+	template<detail::FFTCalculator FFTC=FFT>
+	inline typename std::enable_if<FFTC !=detail::CuFFT>::type
+	sync_data()
+	{
+		hydra::thrust::copy_n(device_system_type(), fFFTData, fNValues, fDeviceData );
+		hydra::thrust::copy_n(device_system_type(), fFFTData, fNValues, fHostData );
+	}
+
+	size_t          fNSamples[N];
+	value_type      fMin[N];
+	value_type      fMax[N];
+	abiscissae_type fX[N];
+	size_t          fNValues;
+	size_t          fNBuffer;
+	bool            fInterpolate;
+	device_pointer_type fDeviceData;
+	host_pointer_type   fHostData;
+	fft_pointer_type    fFFTData ;
+	ConvolutionEngine<fft_type>* fEngine;
+};
+
+/**
+ * Builds the convolution of two functors of the variables ArgTypes..., two or three, sampled on a grid
+ * with nsamples[a] points spanning [min[a], max[a]) along the axis a.
+ */
+template<typename ...ArgTypes, typename Functor, typename Kernel, detail::Backend BACKEND, detail::FFTCalculator FFT, typename T, size_t N>
+inline typename std::enable_if< std::is_floating_point<T>::value && (N == sizeof...(ArgTypes)),
+	ConvolutionFunctorND<Functor, Kernel, detail::BackendPolicy<BACKEND>, detail::FFTPolicy<T, FFT>, ArgTypes...>>::type
+make_convolution( detail::BackendPolicy<BACKEND> const&, detail::FFTPolicy<T, FFT> const&, Functor const& functor, Kernel const& kernel,
+		std::array<T, N> const& min, std::array<T, N> const& max, std::array<size_t, N> const& nsamples, bool interpolate=true)
+{
+	return ConvolutionFunctorND<Functor, Kernel,
+			detail::BackendPolicy<BACKEND>, detail::FFTPolicy<T, FFT>, ArgTypes...>(functor, kernel, min, max, nsamples, interpolate);
+}
+
+}  // namespace hydra
+
+#endif /* CONVOLUTIONFUNCTORND_H_ */
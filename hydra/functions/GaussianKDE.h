@@ -42,8 +42,9 @@
 #include <hydra/Integrator.h>
 #include <hydra/detail/utility/CheckValue.h>
 #include <hydra/Parameter.h>
-#include <hydra/CubicSpiline.h>
+#include <hydra/Spline.h>
 #include <hydra/Tuple.h>
+#include <hydra/functions/detail/BinnedKDE.h>
 #include <tuple>
 #include <limits>
 #include <stdexcept>
@@ -55,11 +56,22 @@ namespace hydra {
 /**
  *  \ingroup common_functions
  *  \class GaussianKDE
+ *
+ *  Gaussian kernel density estimate of a sample, tabulated on NBins knots spanning [min, max]
+ *  and interpolated with a cubic spline. Outside [min, max] the value at the nearest limit is returned.
+ *  The knots are calculated either directly, in O(NBins n) operations, or from the linear binning
+ *  of the sample convolved with the Gaussian kernel via FFT, in O(n + NBins log NBins) operations.
+ *  The bandwidth is given or chosen with one of the KDEBandwidth rules.
  */
 template< size_t NBins, typename ArgType, typename Signature=double(ArgType)>
-class GaussianKDE: public BaseFunctor<GaussianKDE<NBins, ArgType>, Signature, 0>
+class GaussianKDE: public BaseFunctor<GaussianKDE<NBins, ArgType, Signature>, Signature, 0>
 {
-	using BaseFunctor<GaussianKDE<NBins, ArgType>, Signature, 0>::_par;
+	static_assert(NBins > 2, "[hydra::GaussianKDE]: At least three knots are needed.");
+
+	typedef BaseFunctor<GaussianKDE<NBins, ArgType, Signature>, Signature, 0> super_type;
+
+	// two knots beyond max are stored, as the spline looks ahead two knots
+	static constexpr size_t NKnots = NBins + 2;
 
 public:
 
@@ -91,10 +103,10 @@ public:
 		}
 
 		__hydra_host__ __hydra_device__
-		inline 	double operator()(double x){
+		inline 	double operator()(double x) const {
 
 			double m = (x - fX)/fH;
-			return  hydra::math_constants::inverse_sqrt2Pi*exp(-0.5*m*m);
+			return  hydra::math_constants::inverse_sqrt2Pi*::exp(-0.5*m*m);
 		}
 
 		double fX;
@@ -106,39 +118,98 @@ public:
 
 	GaussianKDE() = delete;
 
+	/**
+	 * KDE with bandwidth h, calculated directly or, if binned is true, via linear binning and FFT.
+	 */
 	template<typename Iterator>
-	GaussianKDE(double min, double max, double h, Iterator begin, Iterator end):
-	BaseFunctor<GaussianKDE<NBins, ArgType>, Signature, 0>()
+	GaussianKDE(double min, double max, double h, Iterator begin, Iterator end, bool binned=false):
+	super_type(),
+	fBandwidth(h)
 	{
-		fSpiline=BuildKDE(min, max, h, begin, end);
+		if( !(h > 0.0) )
+			throw std::invalid_argument("[hydra::GaussianKDE]: Bandwidth is not positive. (h <= 0)");
+
+		if(binned) BuildBinnedKDE(min, max, h, begin, end);
+		else BuildKDE(min, max, h, begin, end);
 	}
 
+	/**
+	 * KDE with the bandwidth chosen by the rule, calculated via linear binning and FFT.
+	 */
+	template<typename Iterator>
+	GaussianKDE(double min, double max, KDEBandwidth rule, Iterator begin, Iterator end):
+	super_type(),
+	fBandwidth(Bandwidth(rule, begin, end))
+	{
+		BuildBinnedKDE(min, max, fBandwidth, begin, end);
+	}
 
 	__hydra_host__ __hydra_device__
-	GaussianKDE(GaussianKDE<NBins, ArgType> const& other):
-	BaseFunctor<GaussianKDE<NBins, ArgType>,  Signature, 0>(other),
-	fSpiline(other.GetSpiline())
-	{}
+	GaussianKDE(GaussianKDE<NBins, ArgType, Signature> const& other):
+	super_type(other),
+	fBandwidth(other.GetBandwidth())
+	{
+		for(size_t i=0; i<NKnots; i++){
+
+			fX[i] = other.GetX()[i];
+			fD[i] = other.GetD()[i];
+		}
+	}
 
 	__hydra_host__ __hydra_device__
-	inline 	GaussianKDE<NBins, ArgType>&
-	operator=(GaussianKDE<NBins, ArgType> const& other)
+	inline 	GaussianKDE<NBins, ArgType, Signature>&
+	operator=(GaussianKDE<NBins, ArgType, Signature> const& other)
 	{
 		if(this == &other) return *this;
-		BaseFunctor<GaussianKDE<NBins, ArgType>,  Signature, 0>::operator=(other);
-		fSpiline=other.GetSpiline();
+
+		super_type::operator=(other);
+
+		fBandwidth=other.GetBandwidth();
+
+		for(size_t i=0; i<NKnots; i++){
+
+			fX[i] = other.GetX()[i];
+			fD[i] = other.GetD()[i];
+		}
+
 		return *this;
 	}
 
+	/**
+	 * Bandwidth of the sample [begin, end) according to the rule.
+	 */
+	template<typename Iterator>
+	static double Bandwidth(KDEBandwidth rule, Iterator begin, Iterator end) {
+		return detail::kde::bandwidth(rule, begin, end);
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetBandwidth() const {
+		return fBandwidth;
+	}
+
+	/**
+	 * abscissae of the knots.
+	 */
+	__hydra_host__ __hydra_device__
+	inline const double* GetX() const {
+		return fX;
+	}
+
+	/**
+	 * density at the knots.
+	 */
 	__hydra_host__ __hydra_device__
-	inline 	const CubicSpiline<NBins, ArgType>& GetSpiline() const {
-		return fSpiline;
+	inline const double* GetD() const {
+		return fD;
 	}
 
 	__hydra_host__ __hydra_device__
-	inline double Evaluate(unsigned int n, ArgType x)  const {
+	inline double Evaluate(ArgType x)  const {
 
-		GReal_t r = fSpiline(x);
+		double X = x;
+
+		GReal_t r = X<=fX[0] ? fD[0] : X>=fX[NBins-1] ? fD[NBins-1] : spline(fX, fX + NBins, fD, X);
 
 		return  CHECK_VALUE( r, "r=%f",r) ;
 	}
@@ -147,11 +218,14 @@ public:
 private:
 
 	template<typename Iterator>
-	__hydra_host__ __hydra_device__
-	inline 	CubicSpiline<NBins>  BuildKDE(double min, double max, double h, Iterator begin, Iterator end);
+	inline void BuildKDE(double min, double max, double h, Iterator begin, Iterator end);
 
-	CubicSpiline<NBins> fSpiline;
+	template<typename Iterator>
+	inline void BuildBinnedKDE(double min, double max, double h, Iterator begin, Iterator end);
 
+	double fBandwidth;
+	double fX[NKnots];
+	double fD[NKnots];
 
 };
 
@@ -37,6 +37,7 @@
 #include <hydra/detail/Config.h>
 #include <hydra/detail/BackendPolicy.h>
 #include <hydra/cpp/System.h>
+#include <hydra/device/System.h>
 
 #include <hydra/Types.h>
 #include <hydra/Function.h>
@@ -48,6 +49,8 @@
 #include <hydra/Parameter.h>
 #include <hydra/Tuple.h>
 #include <tuple>
+#include <array>
+#include <numeric>
 #include <limits>
 #include <stdexcept>
 #include <cassert>
@@ -147,133 +150,201 @@ private:
 
 };
 
-template<typename ArgType>
-class IntegrationFormula< Ipatia<ArgType>, 1>
-{
+namespace detail {
 
-protected:
+namespace ipatia {
 
-	inline std::pair<GReal_t, GReal_t>
-	EvalFormula( Ipatia<ArgType>const& functor, double LowerLimit, double UpperLimit )const
+/*
+ * Ipatia over [lower, upper], mapped onto [0, 1], so that the call table
+ * of the quadrature is built once and reused for any range.
+ */
+template<typename Functor>
+struct CoreIntegrand
+{
+	CoreIntegrand()=delete;
+
+	CoreIntegrand(Functor const& functor, double lower, double upper):
+		fLower(lower),
+		fWidth(upper - lower),
+		fFunctor(functor)
+	{}
+
+	__hydra_host__ __hydra_device__
+	CoreIntegrand(CoreIntegrand<Functor> const& other):
+		fLower(other.fLower),
+		fWidth(other.fWidth),
+		fFunctor(other.fFunctor)
+	{}
+
+	__hydra_host__ __hydra_device__
+	CoreIntegrand<Functor>& operator=(CoreIntegrand<Functor> const& other)
 	{
+		if(this == &other) return *this;
 
-		double output = integral(LowerLimit-functor[0], UpperLimit-functor[0],
-				functor[1], functor[2], functor[3], functor[4], functor[5], functor[6], functor[7]);
+		fLower   = other.fLower;
+		fWidth   = other.fWidth;
+		fFunctor = other.fFunctor;
 
-		if(::isnan(output)){
+		return *this;
+	}
 
-			if (WARNING >= Print::Level()  )
-			{
-				std::ostringstream stringStream;
+	__hydra_host__ __hydra_device__
+	inline double operator()(double t) const
+	{
+		return fWidth*fFunctor(fLower + fWidth*t);
+	}
 
-				stringStream << "Detected NaN in analytical integration\n";
-				stringStream << "Switching to numerical integration.\n";
+	double  fLower;
+	double  fWidth;
+	Functor fFunctor;
+};
 
-				HYDRA_LOG(WARNING, stringStream.str().c_str() )
+}  // namespace ipatia
 
-			}
+}  // namespace detail
 
-			hydra::GaussKronrodQuadrature<61,500, hydra::cpp::sys_t> fNumIntegrator(LowerLimit, UpperLimit);
+/*
+ * The power-law tails are integrated in closed form. The core is integrated in closed form
+ * through the hypergeometric function for beta = 0, and otherwise by a Gauss-Kronrod rule whose
+ * call table is built once, on [0, 1], and evaluated on the device back end. The last result is
+ * kept with the parameters and limits it was computed for, so a repeated call is served without evaluations.
+ */
+template<typename ArgType>
+class IntegrationFormula< Ipatia<ArgType>, 1>
+{
+	typedef GaussKronrodQuadrature<61, 16, hydra::device::sys_t> quadrature_type;
 
-			return fNumIntegrator(functor);
-		}
-		else{
+	typedef std::array<double, 10> key_type;
 
-		return std::make_pair(
-				CHECK_VALUE(output," par[0] = %f par[1] = %f par[2] = %f par[3] = %f par[4] = %f par[5] = %f par[6] = %f par[7] = %f LowerLimit = %f UpperLimit = %f",
-						functor[0], functor[1], functor[2], functor[3],
-						functor[4], functor[5], functor[6], functor[7],
-						LowerLimit, UpperLimit ) ,0.0);
-		}
+protected:
 
+	IntegrationFormula():
+		fQuadrature(0.0, 1.0),
+		fCacheValid(false),
+		fCacheKey(),
+		fCacheValue(0.0, 0.0)
+	{}
 
-	}
-private:
+	inline std::pair<GReal_t, GReal_t>
+	EvalFormula( Ipatia<ArgType>const& functor, double LowerLimit, double UpperLimit )const
+	{
+		key_type key{ functor[0], functor[1], functor[2], functor[3],
+			functor[4], functor[5], functor[6], functor[7], LowerLimit, UpperLimit };
 
+		if(fCacheValid && fCacheKey == key)
+			return fCacheValue;
 
-	inline double integral(const double d0, const double d1, const double sigma,
-			const double A1, const double N1, const double A2, const double N2,
-			const double l, const  double beta ) const
-	{
+		double mu    = functor[0];
+		double sigma = functor[1];
+		double A1    = functor[2];
+		double N1    = functor[3];
+		double A2    = functor[4];
+		double N2    = functor[5];
+		double l     = functor[6];
+		double beta  = functor[7];
 
+		double d0 = LowerLimit - mu;
+		double d1 = UpperLimit - mu;
 
-		double ASigma1 = A1*sigma;
-		double ASigma2 = A2*sigma;
-		double I0 = 0;
-		double I1 = 0;
-		double I1a = 0;
-		double I1b = 0;
+		double core_lower = -A1*sigma;
+		double core_upper =  A2*sigma;
 
-		double delta = (l<-1.0)? sigma*::sqrt(-2.0 -2.*l) : sigma;
+		std::pair<GReal_t, GReal_t> result(0.0, 0.0);
 
-		double delta2 = delta*delta;
+		if(d0 < core_lower)
+			result.first += left_tail(d0, std::min(d1, core_lower), sigma, A1, N1, l, beta);
 
-		if ((d0 > -ASigma1) && (d1 < ASigma2)){
-			return  d_hypergeometric(d1,delta, l) - d_hypergeometric(d0,delta, l);
-		}
+		if(d1 > core_upper)
+			result.first += right_tail(std::max(d0, core_upper), d1, sigma, A2, N2, l, beta);
 
-		if (d0 > ASigma2) {
+		double lower = std::max(d0, core_lower);
+		double upper = std::min(d1, core_upper);
 
-			double cons1 = 1.;
-			double phi = 1. + ASigma2*ASigma2/delta2;
-			double k1 = cons1*::pow(phi,l-0.5);
-			double k2 = beta*k1+ cons1*(l-0.5)*::pow(phi,l-1.5)*2.*ASigma2/delta2;
-			double B = -ASigma2 - N2*k1/k2;
-			double A = k1*::pow(B+ASigma2,N2);
-			return A*(::pow(B+d1,1.0-N2)/(1.0-N2) -::pow(B+d0,1.0-N2)/(1.0-N2) );
+		if(lower < upper)
+		{
+			auto core = this->core(functor, lower, upper);
 
+			result.first  += core.first;
+			result.second += core.second;
 		}
 
-		if (d1 < -ASigma1) {
+		result.first = CHECK_VALUE(result.first, " par[0] = %f par[1] = %f par[2] = %f par[3] = %f par[4] = %f par[5] = %f par[6] = %f par[7] = %f LowerLimit = %f UpperLimit = %f",
+				functor[0], functor[1], functor[2], functor[3],
+				functor[4], functor[5], functor[6], functor[7],
+				LowerLimit, UpperLimit );
 
-			double cons1 = 1.;
-			double phi = 1. + ASigma1*ASigma1/delta2;
-			double k1 = cons1*::pow(phi,l-0.5);
-			double k2 = beta*k1- cons1*(l-0.5)*::pow(phi,l-1.5)*2.0*ASigma1/delta2;
-			double B = -ASigma1 + N1*k1/k2;
-			double A = k1*::pow(B+ASigma1,N1);
-			I0 = A*::pow(B-d0,1.0-N1)/(N1-1.0);
-			I1 = A*::pow(B-d1,1.0-N1)/(N1-1.0);
+		fCacheKey   = key;
+		fCacheValue = result;
+		fCacheValid = true;
 
-			return I1 - I0;
-		}
+		return result;
+	}
 
+private:
 
+	inline std::pair<GReal_t, GReal_t>
+	core(Ipatia<ArgType> const& functor, double d0, double d1) const
+	{
+		double sigma = functor[1];
+		double l     = functor[6];
+		double beta  = functor[7];
 
-		if (d0 <-ASigma1) {
+		if(beta == 0.0)
+		{
+			double delta = (l<-1.0)? sigma*::sqrt(-2.0 -2.*l) : sigma;
 
-			double cons1 = 1.;
-			double phi = 1. + ASigma1*ASigma1/delta2;
-			double 	k1 = cons1*::pow(phi,l-0.5);
-			double 	k2 = beta*k1- cons1*(l-0.5)*::pow(phi,l-1.5)*2.0*ASigma1/delta2;
-			double 	B = -ASigma1 + N1*k1/k2;
-			double A = k1*::pow(B+ASigma1,N1);
-			I0 = A*::pow(B-d0,1.0-N1)/(N1-1.0);
-			I1a = A*::pow(B+ASigma1,1.0-N1)/(N1-1.0) - d_hypergeometric(-ASigma1,delta, l);
+			double output = d_hypergeometric(d1, delta, l) - d_hypergeometric(d0, delta, l);
 
+			if(!::isnan(output)) return std::make_pair(output, 0.0);
 		}
 
-		else {
-			I0 = d_hypergeometric(d0,delta, l);
-		}
+		double mu = functor[0];
+
+		return fQuadrature.Integrate(detail::ipatia::CoreIntegrand<Ipatia<ArgType>>(functor, mu + d0, mu + d1));
+	}
 
-		if (d1 > ASigma2) {
+	// closed-form integral of Ipatia::left over [d0, d1], d1 <= -A1*sigma
+	inline double left_tail(const double d0, const double d1, const double sigma,
+			const double A1, const double N1, const double l, const double beta ) const
+	{
+		double asigma = A1*sigma;
+		double delta2 = (l>=-1.0)? sigma : sigma*::sqrt(-2.0 - 2.*l);
 
-			double cons1 = 1.;
-			double phi = 1. + ASigma2*ASigma2/delta2;
-			double k1 = cons1*::pow(phi,l-0.5);
-			double k2 = beta*k1+ cons1*(l-0.5)*::pow(phi,l-1.5)*2.*ASigma2/delta2;
-			double B  = -ASigma2 - N2*k1/k2;
-			double A  = k1*::pow(B+ASigma2,N2);
-			I1b = A*(::pow(B+d1,1.0-N2)/(1.0-N2) -::pow(B+ASigma2,1.0-N2)/(1.0-N2) ) - d_hypergeometric(d1,delta, l) +  d_hypergeometric(ASigma2,delta, l);
+		delta2 *= delta2;
 
-		}
+		double cons1 = ::exp(-beta*asigma);
+		double phi   = 1.0 + asigma*asigma/delta2;
+		double k1    = cons1*::pow(phi,l-0.5);
+		double k2    = beta*k1 - cons1*(l-0.5)*::pow(phi,l-1.5)*2.0*asigma/delta2;
+		double B     = -asigma + N1*k1/k2;
+		double A     = k1*::pow(B+asigma,N1);
+
+		if( ::fabs(N1-1.0) < 1.0e-05 )
+			return A*( ::log(B-d0) - ::log(B-d1) );
+
+		return A*( ::pow(B-d1,1.0-N1) - ::pow(B-d0,1.0-N1) )/(N1-1.0);
+	}
+
+	// closed-form integral of Ipatia::right over [d0, d1], d0 >= A2*sigma
+	inline double right_tail(const double d0, const double d1, const double sigma,
+			const double A2, const double N2, const double l, const double beta ) const
+	{
+		double asigma = A2*sigma;
+		double delta2 = (l>=-1.0)? sigma : sigma*::sqrt(-2.0 - 2.*l);
 
-		I1 = d_hypergeometric(d1,delta, l) + I1a + I1b;
+		delta2 *= delta2;
 
-		return I1 - I0;
+		double cons1 = ::exp(beta*asigma);
+		double phi   = 1.0 + asigma*asigma/delta2;
+		double k1    = cons1*::pow(phi,l-0.5);
+		double k2    = beta*k1 + cons1*(l-0.5)*::pow(phi,l-1.5)*2.0*asigma/delta2;
+		double B     = -asigma - N2*k1/k2;
+		double A     = k1*::pow(B+asigma,N2);
 
+		if( ::fabs(N2-1.0) < 1.0e-05 )
+			return A*( ::log(B+d1) - ::log(B+d0) );
 
+		return A*( ::pow(B+d1,1.0-N2) - ::pow(B+d0,1.0-N2) )/(1.0-N2);
 	}
 
 	double hypergeometric_2F1(double a, double b, double c, double x) const {
@@ -427,12 +498,16 @@ private:
 	    return A.back() / B.back();
 	  }
 
-	double d_hypergeometric(double d1, double delta,double l) const {
+	inline double d_hypergeometric(double d1, double delta,double l) const {
 
 		return d1*hypergeometric_2F1(0.5,0.5-l,1.5,-d1*d1/(delta*delta));
 
 	}
 
+	mutable quadrature_type fQuadrature;
+	mutable bool     fCacheValid;
+	mutable key_type fCacheKey;
+	mutable std::pair<GReal_t, GReal_t> fCacheValue;
 };
 
 }  // namespace hydra
@@ -0,0 +1,352 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * KDE.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef KDE_H_
+#define KDE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Function.h>
+#include <hydra/Integrator.h>
+#include <hydra/detail/utility/CheckValue.h>
+#include <hydra/functions/detail/BinnedKDE.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hydra {
+
+/**
+ * \ingroup common_functions
+ *
+ * \brief Adaptive Gaussian kernel density estimate of a sample of points of one, two or three dimensions,
+ * tabulated on a regular grid.
+ *
+ * The grid has nbins[a] nodes spanning [min[a], max[a]] along the axis a. The sample is binned linearly on the grid,
+ * extended on each side by kernel_cutoff times the widest bandwidth in use (max_bandwidth_factor*bandwidth_class_ratio*h[a]
+ * in the adaptive case), so that the events in the tails and their wide kernels are not cut at the grid edge, and smoothed with the product of Gaussian kernels of bandwidths h[a]
+ * via FFT. This pilot estimate f sets the local bandwidth factors of Abramson's adaptive estimator,
+ * lambda = (f/g)^(-alpha), where g is the geometric mean of f over the sample. The factors are
+ * assigned per grid node and capped at max_bandwidth_factor. The node counts are shared among bandwidth classes
+ * spaced by the factor bandwidth_class_ratio, and each class is smoothed with its own kernel.
+ * alpha=0 gives the fixed-bandwidth estimate. The cost is O(n) for the sample and O(K G log G) for the K classes
+ * and G extended grid nodes.
+ *
+ * The density is evaluated with multilinear or tensor-product Catmull-Rom cubic interpolation and is zero outside the grid.
+ * Both interpolations are linear in the grid values, so the integral over any box is an exact weighted sum
+ * of the nodes, exposed through Integral() and hydra::AnalyticalIntegral, which makes the estimate usable in hydra::Pdf.
+ *
+ * The grid is kept in host and device memory, shared by the copies of the functor and released by Dispose().
+ *
+ * \tparam N number of dimensions.
+ * \tparam Backend memory space keeping the grid evaluated by the device.
+ * \tparam ArgTypes arguments of the functor, one per dimension.
+ */
+template<size_t N, typename Backend, typename ...ArgTypes>
+class KDE;
+
+template<size_t N, detail::Backend BACKEND, typename ...ArgTypes>
+class KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>:
+	public BaseFunctor<KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>, double(ArgTypes...), 0>
+{
+	static_assert( N>=1 && N<=3, "[hydra::KDE]: Only densities of one, two or three variables are supported." );
+
+	static_assert( N==sizeof...(ArgTypes), "[hydra::KDE]: The number of arguments must match the number of dimensions." );
+
+	typedef KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...> this_type;
+
+	typedef BaseFunctor<this_type, double(ArgTypes...), 0> super_type;
+
+	//hydra backend
+	typedef typename detail::BackendPolicy<BACKEND> device_system_type;
+	typedef hydra::host::sys_t                       host_system_type;
+
+	//raw thrust backend
+	typedef typename std::remove_const<decltype(std::declval<device_system_type>().backend)>::type  raw_device_system_type;
+	typedef typename std::remove_const<decltype( std::declval< host_system_type>().backend)>::type  raw_host_system_type;
+
+	//pointers
+	typedef hydra::thrust::pointer<double, raw_host_system_type>      host_pointer_type;
+	typedef hydra::thrust::pointer<double, raw_device_system_type>  device_pointer_type;
+
+public:
+
+	// upper limit of the adaptive bandwidth factors
+	static constexpr double max_bandwidth_factor = 10.0;
+
+	// ratio between the bandwidths of consecutive classes
+	static constexpr double bandwidth_class_ratio = 1.2;
+
+	KDE() = delete;
+
+	/**
+	 * @param min lower limits of the grid.
+	 * @param max upper limits of the grid.
+	 * @param nbins number of grid nodes along each axis.
+	 * @param h global bandwidths along each axis.
+	 * @param begin first point of the sample.
+	 * @param end end of the sample.
+	 * @param alpha sensitivity of the adaptive bandwidths, 0 for a fixed bandwidth.
+	 * @param cubic interpolate with Catmull-Rom cubics instead of multilinearly.
+	 */
+	template<typename Iterator>
+	KDE( std::array<double, N> const& min, std::array<double, N> const& max, std::array<size_t, N> const& nbins,
+			std::array<double, N> const& h, Iterator begin, Iterator end, double alpha=0.5, bool cubic=false):
+		super_type(),
+		fAlpha(alpha),
+		fCubic(cubic)
+	{
+		Build(min, max, nbins, h, begin, end);
+	}
+
+	/**
+	 * As above, with the global bandwidths chosen by the rule, see Bandwidth().
+	 */
+	template<typename Iterator>
+	KDE( std::array<double, N> const& min, std::array<double, N> const& max, std::array<size_t, N> const& nbins,
+			KDEBandwidth rule, Iterator begin, Iterator end, double alpha=0.5, bool cubic=false):
+		super_type(),
+		fAlpha(alpha),
+		fCubic(cubic)
+	{
+		Build(min, max, nbins, Bandwidth(rule, begin, end), begin, end);
+	}
+
+	__hydra_host__ __hydra_device__
+	KDE( this_type const& other):
+		super_type(other),
+		fNValues(other.GetNValues()),
+		fAlpha(other.GetAlpha()),
+		fCubic(other.IsCubic()),
+		fDeviceData(other.GetDeviceData()),
+		fHostData(other.GetHostData())
+	{
+		for(size_t a=0; a<N; a++){
+			fNBins[a] = other.GetNBins(a);
+			fMin[a]   = other.GetMin(a);
+			fDelta[a] = other.GetDelta(a);
+			fH[a]     = other.GetBandwidth(a);
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	this_type& operator=(this_type const& other){
+
+		if(this == &other) return *this;
+
+		super_type::operator=(other);
+
+		for(size_t a=0; a<N; a++){
+			fNBins[a] = other.GetNBins(a);
+			fMin[a]   = other.GetMin(a);
+			fDelta[a] = other.GetDelta(a);
+			fH[a]     = other.GetBandwidth(a);
+		}
+
+		fNValues    = other.GetNValues();
+		fAlpha      = other.GetAlpha();
+		fCubic      = other.IsCubic();
+		fDeviceData = other.GetDeviceData();
+		fHostData   = other.GetHostData();
+
+		return *this;
+	}
+
+	/**
+	 * Global bandwidths of the sample [begin, end) according to the rule, applied to each marginal.
+	 * For more than one dimension, the bandwidths are rescaled from the rate n^(-1/5) to n^(-1/(N+4)).
+	 */
+	template<typename Iterator>
+	static std::array<double, N> Bandwidth(KDEBandwidth rule, Iterator begin, Iterator end);
+
+	__hydra_host__ __hydra_device__
+	inline double Evaluate(ArgTypes... X) const	{
+
+		double x[N]{ double(X)... };
+
+#ifdef __CUDA_ARCH__
+		double r = detail::kde::interpolate(fDeviceData, fNBins, fMin, fDelta, x, fCubic);
+#else
+		double r = detail::kde::interpolate(fHostData, fNBins, fMin, fDelta, x, fCubic);
+#endif
+		return CHECK_VALUE( r, "r=%f", r);
+	}
+
+	/**
+	 * Integral of the interpolated density over the box [lower, upper].
+	 */
+	double Integral(std::array<double, N> const& lower, std::array<double, N> const& upper) const;
+
+	void Dispose(){
+
+		using hydra::thrust::return_temporary_buffer;
+
+		return_temporary_buffer( device_system_type(), fDeviceData, fNValues );
+		return_temporary_buffer( host_system_type(),   fHostData,   fNValues );
+	}
+
+	virtual ~KDE()=default;
+
+	__hydra_host__ __hydra_device__
+	inline bool IsCubic() const {
+		return fCubic;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline void SetCubic(bool cubic) {
+		fCubic = cubic;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetAlpha() const {
+		return fAlpha;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline size_t GetNBins(size_t axis) const {
+		return fNBins[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetMin(size_t axis) const {
+		return fMin[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetMax(size_t axis) const {
+		return fMin[axis] + (fNBins[axis] - 1)*fDelta[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetDelta(size_t axis) const {
+		return fDelta[axis];
+	}
+
+	/**
+	 * @brief Global bandwidth along the axis.
+	 */
+	__hydra_host__ __hydra_device__
+	inline double GetBandwidth(size_t axis) const {
+		return fH[axis];
+	}
+
+	/**
+	 * @brief Number of grid nodes.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNValues() const {
+		return fNValues;
+	}
+
+	__hydra_host__ __hydra_device__
+	const device_pointer_type& GetDeviceData() const {
+		return fDeviceData;
+	}
+
+	__hydra_host__ __hydra_device__
+	const host_pointer_type& GetHostData() const {
+		return fHostData;
+	}
+
+private:
+
+	template<typename Iterator>
+	void Build(std::array<double, N> const& min, std::array<double, N> const& max, std::array<size_t, N> const& nbins,
+			std::array<double, N> const& h, Iterator begin, Iterator end);
+
+	size_t fNBins[N];
+	double fMin[N];
+	double fDelta[N];
+	double fH[N];
+	size_t fNValues;
+	double fAlpha;
+	bool   fCubic;
+	device_pointer_type fDeviceData;
+	host_pointer_type   fHostData;
+};
+
+template<size_t N, detail::Backend BACKEND, typename ...ArgTypes>
+class IntegrationFormula< KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>, N>
+{
+
+protected:
+
+	inline std::pair<GReal_t, GReal_t>
+	EvalFormula( KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...> const& functor,
+			const double (&LowerLimit)[N], const double (&UpperLimit)[N] ) const
+	{
+		std::array<double, N> lower, upper;
+
+		for(size_t a=0; a<N; a++){
+			lower[a] = LowerLimit[a];
+			upper[a] = UpperLimit[a];
+		}
+
+		double r = functor.Integral(lower, upper);
+
+		return std::make_pair( CHECK_VALUE(r, "r=%f", r), 0.0);
+	}
+
+	inline std::pair<GReal_t, GReal_t>
+	EvalFormula( KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...> const& functor,
+			double LowerLimit, double UpperLimit ) const
+	{
+		const double lower[1]{LowerLimit};
+		const double upper[1]{UpperLimit};
+
+		return EvalFormula(functor, lower, upper);
+	}
+
+};
+
+/**
+ * Builds the adaptive KDE of the points of the iterable, of the variables ArgTypes..., tabulated on a grid with
+ * nbins[a] nodes spanning [min[a], max[a]] along the axis a. The bandwidth is an array of global bandwidths or a KDEBandwidth rule.
+ */
+template<typename ...ArgTypes, detail::Backend BACKEND, size_t N, typename Bandwidth, typename Iterable>
+inline typename std::enable_if< (N == sizeof...(ArgTypes)) && hydra::detail::is_iterable<Iterable>::value,
+	KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>>::type
+make_kde( detail::BackendPolicy<BACKEND> const&, std::array<double, N> const& min, std::array<double, N> const& max,
+		std::array<size_t, N> const& nbins, Bandwidth const& bandwidth, Iterable&& points, double alpha=0.5, bool cubic=false)
+{
+	return KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>(min, max, nbins, bandwidth,
+			std::forward<Iterable>(points).begin(), std::forward<Iterable>(points).end(), alpha, cubic);
+}
+
+}  // namespace hydra
+
+#include <hydra/functions/detail/KDE.inl>
+
+#endif /* KDE_H_ */
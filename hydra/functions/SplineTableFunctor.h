@@ -0,0 +1,438 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+
+/*
+ * SplineTableFunctor.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SPLINETABLEFUNCTOR_H_
+#define SPLINETABLEFUNCTOR_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/host/System.h>
+#include <hydra/Types.h>
+#include <hydra/Function.h>
+#include <hydra/Integrator.h>
+#include <hydra/detail/utility/CheckValue.h>
+#include <hydra/detail/SplineTable.inl>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hydra {
+
+/**
+ * \ingroup common_functions
+ *
+ * \brief Steffen monotone spline of one to four variables, with the coefficients precomputed.
+ *
+ * The data points are given on a grid, by the nodes along each axis and the values at the grid points, the first axis running fastest.
+ * Along the first axis the slopes and the polynomial coefficients of every interval of every grid row are calculated once,
+ * at construction, and stored interleaved, {a, b, c, d} per interval, so that the spline is evaluated
+ * with three multiply-adds once the interval is found. The interval is found directly from the argument if the nodes are
+ * equally spaced, within 1e-10 of the range, and by binary search otherwise.
+ * Along the further axes, the spline is not linear in the data and is calculated locally, from the 4 grid rows around the
+ * argument, as hydra::spline2D and the like do. Arguments outside the grid are clamped to its borders.
+ *
+ * The results agree with hydra::spline and hydra::spline2D up to rounding, except in the last interval of each axis,
+ * where the table uses the border slope of Steffen's method.
+ *
+ * The table is kept in host and device memory, shared by the copies of the functor and released by Dispose().
+ *
+ * Reference: M. Steffen, Astron. Astrophys. 239, 443—450 (1990).
+ *
+ * \tparam Backend memory space keeping the table evaluated by the device.
+ * \tparam ArgTypes arguments of the functor, one per axis.
+ */
+template<typename Backend, typename ...ArgTypes>
+class SplineTableFunctor;
+
+template<detail::Backend BACKEND, typename ...ArgTypes>
+class SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>:
+	public BaseFunctor<SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>, double(ArgTypes...), 0>
+{
+	static constexpr size_t N = sizeof...(ArgTypes);
+
+	static_assert( N>=1 && N<=4, "[hydra::SplineTableFunctor]: Only splines of one to four variables are supported." );
+
+	typedef SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...> this_type;
+
+	typedef BaseFunctor<this_type, double(ArgTypes...), 0> super_type;
+
+	//hydra backend
+	typedef typename detail::BackendPolicy<BACKEND> device_system_type;
+	typedef hydra::host::sys_t                       host_system_type;
+
+	//raw thrust backend
+	typedef typename std::remove_const<decltype(std::declval<device_system_type>().backend)>::type  raw_device_system_type;
+	typedef typename std::remove_const<decltype( std::declval< host_system_type>().backend)>::type  raw_host_system_type;
+
+	//pointers
+	typedef hydra::thrust::pointer<double, raw_host_system_type>      host_pointer_type;
+	typedef hydra::thrust::pointer<double, raw_device_system_type>  device_pointer_type;
+
+public:
+
+	SplineTableFunctor() = delete;
+
+	/**
+	 * @param abscissae increasing nodes along each axis, at least two per axis.
+	 * @param values values at the grid points, of index i_0 + n_0*(i_1 + n_1*(i_2 + ...)).
+	 */
+	SplineTableFunctor( std::array<std::vector<double>, N> const& abscissae, std::vector<double> const& values ):
+		super_type()
+	{
+		Build(abscissae, values);
+	}
+
+	/**
+	 * One-dimensional spline through the points (x, y) with x in [xfirst, xlast).
+	 */
+	template<typename Iterator1, typename Iterator2, size_t M=N>
+	SplineTableFunctor( Iterator1 xfirst, Iterator1 xlast, Iterator2 yfirst,
+			typename std::enable_if<M==1, void*>::type = nullptr ):
+		super_type()
+	{
+		std::array<std::vector<double>, 1> abscissae{ std::vector<double>(xfirst, xlast) };
+
+		std::vector<double> values(abscissae[0].size());
+
+		hydra::thrust::copy(yfirst, yfirst + values.size(), values.begin());
+
+		Build(abscissae, values);
+	}
+
+	__hydra_host__ __hydra_device__
+	SplineTableFunctor( this_type const& other):
+		super_type(other),
+		fNRows(other.GetNRows()),
+		fNValues(other.GetNValues()),
+		fDeviceData(other.GetDeviceData()),
+		fHostData(other.GetHostData())
+	{
+		for(size_t a=0; a<N; a++){
+			fNKnots[a]  = other.GetNKnots(a);
+			fOffset[a]  = other.GetOffset(a);
+			fUniform[a] = other.IsUniform(a);
+			fX0[a]      = other.GetMin(a);
+			fInvH[a]    = other.GetInverseSpacing(a);
+		}
+	}
+
+	__hydra_host__ __hydra_device__
+	this_type& operator=(this_type const& other){
+
+		if(this == &other) return *this;
+
+		super_type::operator=(other);
+
+		for(size_t a=0; a<N; a++){
+			fNKnots[a]  = other.GetNKnots(a);
+			fOffset[a]  = other.GetOffset(a);
+			fUniform[a] = other.IsUniform(a);
+			fX0[a]      = other.GetMin(a);
+			fInvH[a]    = other.GetInverseSpacing(a);
+		}
+
+		fNRows      = other.GetNRows();
+		fNValues    = other.GetNValues();
+		fDeviceData = other.GetDeviceData();
+		fHostData   = other.GetHostData();
+
+		return *this;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double Evaluate(ArgTypes... X) const	{
+
+		double x[N]{ double(X)... };
+		size_t cell[N];
+
+		double r = Interpolate(x, cell, false);
+
+		return CHECK_VALUE( r, "r=%f", r);
+	}
+
+	/**
+	 * Spline at the point x. The intervals holding x along each axis are returned in cell.
+	 * If hinted, they are searched starting from the input cell, usually the one of a previous nearby point,
+	 * which is cheaper than a binary search on nonuniform axes.
+	 */
+	__hydra_host__ __hydra_device__
+	inline double Interpolate(const double (&x)[N], size_t (&cell)[N], bool hinted) const {
+
+#ifdef __CUDA_ARCH__
+		const double* data = hydra::thrust::raw_pointer_cast(fDeviceData);
+#else
+		const double* data = hydra::thrust::raw_pointer_cast(fHostData);
+#endif
+
+		double value[N];
+
+		for(size_t a=0; a<N; a++){
+
+			const double* nodes = data + fOffset[a];
+
+			value[a] = x[a] < nodes[0] ? nodes[0] : x[a] > nodes[fNKnots[a]-1] ? nodes[fNKnots[a]-1] : x[a];
+
+			cell[a] = hinted ? detail::spline::locate(nodes, fNKnots[a], fUniform[a], fX0[a], fInvH[a], value[a], cell[a])
+					         : detail::spline::locate(nodes, fNKnots[a], fUniform[a], fX0[a], fInvH[a], value[a]);
+		}
+
+		size_t i = cell[0];
+
+		double u = value[0] - data[fOffset[0] + i];
+
+		const double* table = data + fOffset[N-1] + fNKnots[N-1] + 4*i;
+
+		if( N==1 ) return detail::spline::horner(table, u);
+
+		// grid points around the argument along the further axes, clamped to the grid
+		size_t node[N][4];
+
+		for(size_t a=1; a<N; a++){
+
+			for(size_t k=0; k<4; k++){
+
+				long j = long(cell[a]) + long(k) - 1;
+
+				node[a][k] = j < 0 ? 0 : j > long(fNKnots[a] - 1) ? fNKnots[a] - 1 : size_t(j);
+			}
+		}
+
+		// splines along the first axis of the 4^(N-1) rows, the second axis running fastest
+		constexpr size_t nrows = N==1 ? 1 : N==2 ? 4 : N==3 ? 16 : 64;
+
+		double Y[nrows];
+
+		for(size_t r=0; r<nrows; r++){
+
+			size_t row = 0, stride = 1;
+
+			for(size_t a=1, k=r; a<N; a++, k/=4){
+				row    += node[a][k%4]*stride;
+				stride *= fNKnots[a];
+			}
+
+			Y[r] = detail::spline::horner(table + 4*row*(fNKnots[0] - 1), u);
+		}
+
+		// reduction of the further axes, one at a time
+		size_t n = nrows;
+
+		for(size_t a=1; a<N; a++){
+
+			const double* nodes = data + fOffset[a];
+
+			double X[4];
+			for(size_t k=0; k<4; k++) X[k] = nodes[node[a][k]];
+
+			n /= 4;
+
+			for(size_t r=0; r<n; r++){
+
+				const double y[4]{ Y[4*r], Y[4*r+1], Y[4*r+2], Y[4*r+3] };
+
+				Y[r] = detail::spline::steffen_local(cell[a], fNKnots[a], X, y, value[a]);
+			}
+		}
+
+		return Y[0];
+	}
+
+	/**
+	 * Evaluates the spline at the points [begin, end) into result, scalars for one variable and tuples otherwise,
+	 * in the memory space of the points. On the host back-ends, the points are processed in chunks of 256 consecutive
+	 * points, and the intervals of each point are searched from the ones of the previous point of the chunk, so that
+	 * sorted or clustered points are located in O(1) instead of O(log n) on nonuniform axes. On CUDA, each thread
+	 * evaluates one point, to keep the memory accesses coalesced. If sort is true, the points are first ordered
+	 * by grid cell, the last axis being the slowest, at the cost of a sort by key.
+	 */
+	template<typename Iterator, typename OutputIterator>
+	OutputIterator Interpolate(Iterator begin, Iterator end, OutputIterator result, bool sort=false) const;
+
+	/**
+	 * Replaces the values at the grid points, keeping the nodes, and recalculates the coefficients in place,
+	 * so that the copies of this functor see the new spline.
+	 */
+	void SetValues(std::vector<double> const& values);
+
+	/**
+	 * Integral of a one-dimensional spline over [lower, upper], calculated exactly from the coefficients.
+	 * Beyond the grid the spline is continued by its values at the borders, as in the evaluation.
+	 */
+	template<size_t M=N>
+	typename std::enable_if<M==1, double>::type
+	Integral(double lower, double upper) const;
+
+	void Dispose(){
+
+		using hydra::thrust::return_temporary_buffer;
+
+		return_temporary_buffer( device_system_type(), fDeviceData, fNValues );
+		return_temporary_buffer( host_system_type(),   fHostData,   fNValues );
+	}
+
+	virtual ~SplineTableFunctor()=default;
+
+	/**
+	 * @brief Number of nodes along the axis.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNKnots(size_t axis) const {
+		return fNKnots[axis];
+	}
+
+	/**
+	 * @brief Position of the nodes of the axis in the stored data.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetOffset(size_t axis) const {
+		return fOffset[axis];
+	}
+
+	/**
+	 * @brief Whether the nodes of the axis are equally spaced.
+	 */
+	__hydra_host__ __hydra_device__
+	inline bool IsUniform(size_t axis) const {
+		return fUniform[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetMin(size_t axis) const {
+		return fX0[axis];
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetMax(size_t axis) const {
+		return fX0[axis] + (fNKnots[axis] - 1)/fInvH[axis];
+	}
+
+	/**
+	 * @brief Inverse of the spacing of the nodes of a uniform axis.
+	 */
+	__hydra_host__ __hydra_device__
+	inline double GetInverseSpacing(size_t axis) const {
+		return fInvH[axis];
+	}
+
+	/**
+	 * @brief Number of grid rows along the first axis.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNRows() const {
+		return fNRows;
+	}
+
+	/**
+	 * @brief Number of stored values: the nodes of all the axes followed by the coefficients.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNValues() const {
+		return fNValues;
+	}
+
+	__hydra_host__ __hydra_device__
+	const device_pointer_type& GetDeviceData() const {
+		return fDeviceData;
+	}
+
+	__hydra_host__ __hydra_device__
+	const host_pointer_type& GetHostData() const {
+		return fHostData;
+	}
+
+private:
+
+	void Build(std::array<std::vector<double>, N> const& abscissae, std::vector<double> const& values);
+
+	size_t fNKnots[N];
+	size_t fOffset[N];
+	bool   fUniform[N];
+	double fX0[N];
+	double fInvH[N];
+	size_t fNRows;
+	size_t fNValues;
+	device_pointer_type fDeviceData;
+	host_pointer_type   fHostData;
+};
+
+template<detail::Backend BACKEND, typename ArgType>
+class IntegrationFormula< SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgType>, 1>
+{
+
+protected:
+
+	inline std::pair<GReal_t, GReal_t>
+	EvalFormula( SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgType> const& functor, double LowerLimit, double UpperLimit ) const
+	{
+		double r = functor.Integral(LowerLimit, UpperLimit);
+
+		return std::make_pair( CHECK_VALUE(r, "r=%f", r), 0.0);
+	}
+
+};
+
+/**
+ * Builds the one-dimensional Steffen spline table of the points (x, y), for the variable ArgType.
+ */
+template<typename ArgType, detail::Backend BACKEND, typename Iterable1, typename Iterable2>
+inline typename std::enable_if< hydra::detail::is_iterable<Iterable1>::value && hydra::detail::is_iterable<Iterable2>::value &&
+	std::is_convertible<decltype(*std::declval<Iterable1>().begin()), double>::value,
+	SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgType>>::type
+make_spline_table( detail::BackendPolicy<BACKEND> const&, Iterable1&& x, Iterable2&& y)
+{
+	return SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgType>(
+			std::forward<Iterable1>(x).begin(), std::forward<Iterable1>(x).end(), std::forward<Iterable2>(y).begin());
+}
+
+/**
+ * Builds the Steffen spline table of the variables ArgTypes... over the grid of nodes abscissae, with the first axis running fastest in values.
+ */
+template<typename ...ArgTypes, detail::Backend BACKEND, size_t N, typename Iterable>
+inline typename std::enable_if< (N == sizeof...(ArgTypes)) && hydra::detail::is_iterable<Iterable>::value,
+	SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>>::type
+make_spline_table( detail::BackendPolicy<BACKEND> const&, std::array<std::vector<double>, N> const& abscissae, Iterable&& values)
+{
+	std::vector<double> v(std::forward<Iterable>(values).size());
+
+	hydra::thrust::copy(std::forward<Iterable>(values).begin(), std::forward<Iterable>(values).end(), v.begin());
+
+	return SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>(abscissae, v);
+}
+
+}  // namespace hydra
+
+#include <hydra/functions/detail/SplineTableFunctor.inl>
+
+#endif /* SPLINETABLEFUNCTOR_H_ */
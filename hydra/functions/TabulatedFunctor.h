@@ -0,0 +1,339 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+
+/*
+ * TabulatedFunctor.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef TABULATEDFUNCTOR_H_
+#define TABULATEDFUNCTOR_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/detail/BackendPolicy.h>
+#include <hydra/Types.h>
+#include <hydra/Function.h>
+#include <hydra/Integrator.h>
+#include <hydra/Parameter.h>
+#include <hydra/detail/Print.h>
+#include <hydra/detail/utility/CheckValue.h>
+#include <hydra/functions/SplineTableFunctor.h>
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+namespace hydra {
+
+/**
+ * \ingroup common_functions
+ *
+ * \brief Adaptor serving a costly one-dimensional functor from a Steffen spline tabulated on a uniform grid.
+ *
+ * The functor is evaluated in parallel at the nnodes nodes spanning [min, max] and the coefficients of the spline
+ * are precomputed, see hydra::SplineTableFunctor. The table is rebuilt by Update(), called by SetParameters(), only if the
+ * parameters of the functor changed, as detected by GetParametersKey(). The parameters of the adaptor are the ones of the
+ * functor, so that it can be fitted in their place. The integral over any subrange of [min, max] is calculated exactly from the
+ * coefficients, through Integral() and hydra::AnalyticalIntegral. Outside [min, max] the functor itself is evaluated.
+ *
+ * After each tabulation, the largest absolute deviation from the functor is measured at nchecks random points, spread
+ * evenly over the intervals of the grid, with at least one point per interval, see GetMaxError(). A warning is issued
+ * if it exceeds the tolerance, when this is positive. As any sampled maximum, GetMaxError() is a lower bound of the
+ * actual largest deviation, which it approaches as the number of points per interval grows.
+ *
+ * The table is kept in host and device memory, shared by the copies of the adaptor and released by Dispose().
+ *
+ * \tparam Functor one-dimensional functor to tabulate.
+ * \tparam Backend memory space keeping the table evaluated by the device.
+ * \tparam ArgType argument of the functor.
+ */
+template<typename Functor, typename Backend, typename ArgType>
+class TabulatedFunctor;
+
+template<typename Functor, detail::Backend BACKEND, typename ArgType>
+class TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>:
+	public BaseFunctor<TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>, double(ArgType), 0>
+{
+	typedef TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType> this_type;
+
+	typedef BaseFunctor<this_type, double(ArgType), 0> super_type;
+
+	typedef SplineTableFunctor<detail::BackendPolicy<BACKEND>, double> table_type;
+
+	typedef typename detail::BackendPolicy<BACKEND> device_system_type;
+
+public:
+
+	TabulatedFunctor() = delete;
+
+	/**
+	 * @param functor functor to tabulate.
+	 * @param min lower limit of the grid.
+	 * @param max upper limit of the grid.
+	 * @param nnodes number of nodes of the grid.
+	 * @param tolerance largest absolute deviation from the functor accepted without warning, 0 to disable the warning.
+	 * @param nchecks number of random points where the deviation is measured after each tabulation, rounded up
+	 * to a multiple of the number of intervals (nnodes-1), 0 to disable the check.
+	 */
+	TabulatedFunctor( Functor const& functor, double min, double max, size_t nnodes=1024,
+			double tolerance=0.0, size_t nchecks=4096):
+		super_type(),
+		fFunctor(functor),
+		fTable(Grid(min, max, nnodes), std::vector<double>(nnodes, 0.0)),
+		fMin(min),
+		fMax(max),
+		fTolerance(tolerance),
+		fNChecks(nchecks),
+		fMaxError(0.0),
+		fKey(0),
+		fNTabulations(0)
+	{
+		Tabulate();
+	}
+
+	__hydra_host__ __hydra_device__
+	TabulatedFunctor( this_type const& other):
+		super_type(other),
+		fFunctor(other.GetExactFunctor()),
+		fTable(other.GetTable()),
+		fMin(other.GetMin()),
+		fMax(other.GetMax()),
+		fTolerance(other.GetTolerance()),
+		fNChecks(other.GetNChecks()),
+		fMaxError(other.GetMaxError()),
+		fKey(other.GetKey()),
+		fNTabulations(other.GetNTabulations())
+	{}
+
+	__hydra_host__ __hydra_device__
+	this_type& operator=(this_type const& other){
+
+		if(this == &other) return *this;
+
+		super_type::operator=(other);
+
+		fFunctor      = other.GetExactFunctor();
+		fTable        = other.GetTable();
+		fMin          = other.GetMin();
+		fMax          = other.GetMax();
+		fTolerance    = other.GetTolerance();
+		fNChecks      = other.GetNChecks();
+		fMaxError     = other.GetMaxError();
+		fKey          = other.GetKey();
+		fNTabulations = other.GetNTabulations();
+
+		return *this;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double Evaluate(ArgType X) const	{
+
+		double x[1]{ double(X) };
+
+		if( x[0] < fMin || x[0] > fMax ) return fFunctor(X);
+
+		size_t cell[1];
+
+		double r = fTable.Interpolate(x, cell, false);
+
+		return CHECK_VALUE( r, "r=%f", r);
+	}
+
+	/**
+	 * Integral of the tabulated functor over [lower, upper], which must lie within [min, max].
+	 */
+	double Integral(double lower, double upper) const;
+
+	/**
+	 * Tabulates the functor again if its parameters changed since the last tabulation.
+	 */
+	void Update() {
+
+		if( fFunctor.GetParametersKey() != fKey ) Tabulate();
+	}
+
+	/**
+	 * Tabulates the functor, evaluated in parallel at the grid nodes, and measures the deviation of the table.
+	 */
+	void Tabulate();
+
+	/**
+	 * Largest absolute deviation of the table from the functor at nchecks random points, rounded up to
+	 * the same number of points in every interval of the grid.
+	 */
+	double Check(size_t nchecks) const;
+
+	void Dispose(){
+		fTable.Dispose();
+	}
+
+	virtual ~TabulatedFunctor()=default;
+
+	//parameters, forwarded to the functor
+	inline void AddUserParameters(std::vector<hydra::Parameter*>& user_parameters ) {
+		fFunctor.AddUserParameters(user_parameters);
+	}
+
+	inline void SetParameters(const std::vector<double>& parameters){
+
+		fFunctor.SetParameters(parameters);
+		Update();
+	}
+
+	inline size_t GetParametersKey(){
+		return fFunctor.GetParametersKey();
+	}
+
+	inline size_t GetNumberOfParameters() const {
+		return fFunctor.GetNumberOfParameters();
+	}
+
+	inline void PrintRegisteredParameters() {
+		fFunctor.PrintRegisteredParameters();
+	}
+
+	__hydra_host__ __hydra_device__
+	inline const Functor& GetExactFunctor() const {
+		return fFunctor;
+	}
+
+	/**
+	 * @brief Functor being tabulated. Call Update() after changing its parameters directly.
+	 */
+	inline Functor& GetExactFunctor() {
+		return fFunctor;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline const table_type& GetTable() const {
+		return fTable;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetMin() const {
+		return fMin;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetMax() const {
+		return fMax;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline size_t GetNNodes() const {
+		return fTable.GetNKnots(0);
+	}
+
+	__hydra_host__ __hydra_device__
+	inline double GetTolerance() const {
+		return fTolerance;
+	}
+
+	inline void SetTolerance(double tolerance) {
+		fTolerance = tolerance;
+	}
+
+	__hydra_host__ __hydra_device__
+	inline size_t GetNChecks() const {
+		return fNChecks;
+	}
+
+	inline void SetNChecks(size_t nchecks) {
+		fNChecks = nchecks;
+	}
+
+	/**
+	 * @brief Largest deviation from the functor measured after the last tabulation.
+	 */
+	__hydra_host__ __hydra_device__
+	inline double GetMaxError() const {
+		return fMaxError;
+	}
+
+	/**
+	 * @brief Parameters key of the functor at the last tabulation.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetKey() const {
+		return fKey;
+	}
+
+	/**
+	 * @brief Number of tabulations performed.
+	 */
+	__hydra_host__ __hydra_device__
+	inline size_t GetNTabulations() const {
+		return fNTabulations;
+	}
+
+private:
+
+	static std::array<std::vector<double>, 1> Grid(double min, double max, size_t nnodes);
+
+	Functor    fFunctor;
+	table_type fTable;
+	double fMin;
+	double fMax;
+	double fTolerance;
+	size_t fNChecks;
+	double fMaxError;
+	size_t fKey;
+	size_t fNTabulations;
+};
+
+template<typename Functor, detail::Backend BACKEND, typename ArgType>
+class IntegrationFormula< TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>, 1>
+{
+
+protected:
+
+	inline std::pair<GReal_t, GReal_t>
+	EvalFormula( TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType> const& functor,
+			double LowerLimit, double UpperLimit ) const
+	{
+		double r = functor.Integral(LowerLimit, UpperLimit);
+
+		return std::make_pair( CHECK_VALUE(r, "r=%f", r), 0.0);
+	}
+
+};
+
+/**
+ * Tabulates the functor of the variable ArgType on nnodes nodes spanning [min, max], see hydra::TabulatedFunctor.
+ */
+template<typename ArgType, typename Functor, detail::Backend BACKEND>
+inline TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>
+make_tabulated( detail::BackendPolicy<BACKEND> const&, Functor const& functor, double min, double max,
+		size_t nnodes=1024, double tolerance=0.0, size_t nchecks=4096)
+{
+	return TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>(functor, min, max, nnodes, tolerance, nchecks);
+}
+
+}  // namespace hydra
+
+#include <hydra/functions/detail/TabulatedFunctor.inl>
+
+#endif /* TABULATEDFUNCTOR_H_ */
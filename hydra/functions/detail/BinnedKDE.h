@@ -0,0 +1,671 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * BinnedKDE.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef BINNEDKDE_H_
+#define BINNEDKDE_H_
+
+#include <hydra/detail/Config.h>
+#include <hydra/Types.h>
+#include <hydra/Complex.h>
+#include <hydra/detail/functors/KDEBinning.h>
+#include <hydra/detail/native_fft/BaseNativeFFT.h>
+#include <hydra/detail/native_fft/NativeFFTPlan.h>
+#include <hydra/detail/external/hydra_thrust/copy.h>
+#include <hydra/detail/external/hydra_thrust/count.h>
+#include <hydra/detail/external/hydra_thrust/distance.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+
+#include <math.h>
+#include <array>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+namespace hydra {
+
+/**
+ * \ingroup common_functions
+ *
+ * Rules for the automatic choice of the bandwidth of the Gaussian kernel density estimators:
+ *  - Silverman: rule of thumb, h = 0.9 min(sigma, IQR/1.34) n^{-1/5}.
+ *  - SheatherJones: two-stage direct plug-in estimate of the bandwidth minimizing the asymptotic MISE
+ *  (S. J. Sheather and M. C. Jones, J. R. Statist. Soc. B 53 (1991) 683; M. P. Wand and M. C. Jones,
+ *  Kernel Smoothing, Chapman & Hall (1995)), with the density functionals estimated on binned data.
+ */
+enum KDEBandwidth{ Silverman=0, SheatherJones=1 };
+
+namespace detail {
+
+namespace kde {
+
+// number of grid points used to estimate the bandwidth
+constexpr size_t bandwidth_grid_size = 1024;
+
+// the Gaussian kernel is truncated at kernel_cutoff bandwidths
+constexpr double kernel_cutoff = 6.0;
+
+/*
+ * Count, mean, variance and range of the sample in one pass.
+ */
+template<typename Iterator>
+inline Moments moments(Iterator begin, Iterator end)
+{
+	return hydra::thrust::transform_reduce(begin, end, MomentsTransform(), Moments(), MomentsPlus());
+}
+
+/*
+ * Linear binning of [begin, end) on the grid min + j*delta, j in [0, npoints), returned in host memory.
+ * The events are split in partitions binned in parallel in private histograms, which are summed at the end.
+ */
+template<typename Iterator>
+inline std::vector<double> linear_binning(Iterator begin, Iterator end, double min, double delta, size_t npoints)
+{
+	typedef typename hydra::thrust::iterator_system<Iterator>::type system_t;
+
+	std::vector<double> counts(npoints, 0.0);
+
+	size_t n = hydra::thrust::distance(begin, end);
+
+	if(n==0) return counts;
+
+	// at least 2^16 events per partition, at most 256 partitions
+	size_t npartitions = std::min(size_t(256), std::max(size_t(1), n >> 16));
+	size_t chunk       = (n + npartitions - 1)/npartitions;
+	npartitions        = (n + chunk - 1)/chunk;
+
+	auto partials = hydra::thrust::get_temporary_buffer<double>(system_t(), npartitions*npoints);
+
+	hydra::thrust::for_each(system_t(),
+			hydra::thrust::counting_iterator<size_t>(0),
+			hydra::thrust::counting_iterator<size_t>(npartitions),
+			LinearBinning<Iterator, decltype(partials.first)>(begin, partials.first, n, chunk, npoints, min, delta));
+
+	std::vector<double> host_partials(npartitions*npoints);
+
+	hydra::thrust::copy(partials.first, partials.first + npartitions*npoints, host_partials.begin());
+
+	hydra::thrust::return_temporary_buffer(system_t(), partials.first, partials.second);
+
+	for(size_t p=0; p<npartitions; p++)
+		for(size_t j=0; j<npoints; j++)
+			counts[j] += host_partials[p*npoints + j];
+
+	return counts;
+}
+
+/*
+ * Abscissa where the cumulative counts, starting from the events below the grid, reach target,
+ * interpolating inside the grid cells.
+ */
+inline double quantile(std::vector<double> const& counts, double min, double delta, double below, double target)
+{
+	double cumulative = below;
+
+	for(size_t j=0; j<counts.size(); j++){
+
+		if( cumulative + counts[j] >= target && counts[j] > 0.0 ){
+
+			double f = (target - cumulative)/counts[j];
+
+			return min + (double(j) + f - 0.5)*delta;
+		}
+
+		cumulative += counts[j];
+	}
+
+	return min + (counts.size() - 1)*delta;
+}
+
+/*
+ * First and third quartiles of the sample [begin, end), of n events in [min, max].
+ * The sample is binned on bandwidth_grid_size points, and the grid is narrowed around the quartiles
+ * until they are resolved by at least 64 cells, which heavy-tailed samples need.
+ */
+template<typename Iterator>
+inline std::pair<double, double> quartiles(Iterator begin, Iterator end, double n, double min, double max)
+{
+	double lower = min, upper = max, below = 0.0;
+	double q1 = min, q3 = max;
+
+	for(unsigned iteration=0; iteration<8; iteration++){
+
+		double delta = (upper - lower)/(bandwidth_grid_size - 1);
+
+		std::vector<double> counts = linear_binning(begin, end, lower, delta, bandwidth_grid_size);
+
+		q1 = quantile(counts, lower, delta, below, 0.25*n);
+		q3 = quantile(counts, lower, delta, below, 0.75*n);
+
+		if( q3 - q1 > 64.0*delta ) break;
+
+		lower = std::max(lower, q1 - 2.0*delta);
+		upper = std::min(upper, q3 + 2.0*delta);
+
+		below = hydra::thrust::count_if(begin, end, LessThan(lower));
+	}
+
+	return std::make_pair(q1, q3);
+}
+
+/*
+ * Binned estimate of the density functional psi_r = int f^{(r)}(x) f(x) dx, r = 4 or 6,
+ * psi_r(g) = n^{-2} g^{-r-1} sum_k sum_l c_k c_l phi^{(r)}((k - l) delta/g).
+ */
+inline double psi(std::vector<double> const& counts, double n, double delta, double g, unsigned r)
+{
+	size_t npoints = counts.size();
+	size_t L = std::min(npoints - 1, size_t(::ceil(kernel_cutoff*g/delta)));
+
+	std::vector<double> kappa(L + 1);
+
+	for(size_t m=0; m<=L; m++){
+
+		double u  = m*delta/g;
+		double u2 = u*u;
+
+		//probabilists' Hermite polynomials, phi^{(r)}(u) = He_r(u) phi(u) for even r
+		double hermite = r==4 ? (u2 - 6.0)*u2 + 3.0 : ((u2 - 15.0)*u2 + 45.0)*u2 - 15.0;
+
+		kappa[m] = hermite*math_constants::inverse_sqrt2Pi*::exp(-0.5*u2);
+	}
+
+	double sum = 0.0;
+
+	for(size_t k=0; k<npoints; k++){
+
+		if( counts[k]==0.0 ) continue;
+
+		double s = kappa[0]*counts[k];
+
+		for(size_t m=1; m<=L && k + m < npoints; m++)
+			s += 2.0*kappa[m]*counts[k + m];
+
+		sum += counts[k]*s;
+	}
+
+	return sum/(n*n*::pow(g, r + 1));
+}
+
+/*
+ * Silverman's rule of thumb, scale = min(sigma, IQR/1.34).
+ */
+inline double silverman_bandwidth(double n, double scale)
+{
+	return 0.9*scale*::pow(n, -0.2);
+}
+
+/*
+ * Two-stage direct plug-in bandwidth. psi_8 is taken from the normal reference with the given scale,
+ * psi_6 and psi_4 are estimated from the binned data with the AMSE-optimal pilot bandwidths.
+ * Estimates with the wrong sign, which only happen for pathological samples, are replaced by
+ * their normal references.
+ */
+inline double sheather_jones_bandwidth(std::vector<double> const& counts, double n, double delta, double scale)
+{
+	const double sqrt_pi  = ::sqrt(PI);
+	const double sqrt_2pi = ::sqrt(2.0*PI);
+
+	double psi8 = 105.0/(32.0*sqrt_pi*::pow(scale, 9));
+
+	double g6   = ::pow(30.0/(sqrt_2pi*psi8*n), 1.0/9.0);
+	double psi6 = psi(counts, n, delta, g6, 6);
+
+	if( !(psi6 < 0.0) ) psi6 = -15.0/(16.0*sqrt_pi*::pow(scale, 7));
+
+	double g4   = ::pow(-6.0/(sqrt_2pi*psi6*n), 1.0/7.0);
+	double psi4 = psi(counts, n, delta, g4, 4);
+
+	if( !(psi4 > 0.0) ) psi4 = 3.0/(8.0*sqrt_pi*::pow(scale, 5));
+
+	return ::pow(1.0/(2.0*sqrt_pi*psi4*n), 0.2);
+}
+
+/*
+ * Automatic bandwidth of the sample [begin, end), estimated from its moments, its quartiles and,
+ * for the Sheather-Jones rule, a linear binning on bandwidth_grid_size points spanning its range
+ * trimmed to 8 interquartile ranges beyond the quartiles.
+ */
+template<typename Iterator>
+inline double bandwidth(KDEBandwidth rule, Iterator begin, Iterator end)
+{
+	Moments m = moments(begin, end);
+
+	if( m.fN < 2.0 )
+		throw std::invalid_argument("[hydra::KDEBandwidth]: At least two events are needed to estimate the bandwidth. (n < 2)");
+
+	if( !(m.fMax > m.fMin) )
+		throw std::invalid_argument("[hydra::KDEBandwidth]: Sample with null range. (max == min)");
+
+	double mean  = m.fSum/m.fN;
+	double sigma = ::sqrt(std::max(0.0, (m.fSum2 - m.fN*mean*mean)/(m.fN - 1.0)));
+
+	std::pair<double, double> q = quartiles(begin, end, m.fN, m.fMin, m.fMax);
+
+	double iqr   = q.second - q.first;
+	double scale = iqr > 0.0 ? std::min(sigma, iqr/1.349) : sigma;
+
+	if( rule!=SheatherJones )
+		return silverman_bandwidth(m.fN, scale);
+
+	double lower = iqr > 0.0 ? std::max(m.fMin, q.first  - 8.0*iqr) : m.fMin;
+	double upper = iqr > 0.0 ? std::min(m.fMax, q.second + 8.0*iqr) : m.fMax;
+	double delta = (upper - lower)/(bandwidth_grid_size - 1);
+
+	std::vector<double> counts = linear_binning(begin, end, lower, delta, bandwidth_grid_size);
+
+	return sheather_jones_bandwidth(counts, m.fN, delta, scale);
+}
+
+/*
+ * Gaussian kernel phi(m*delta/h), m in [0, L], normalized so that its samples over [-L, L] sum to h/delta.
+ * The normalization only matters for bandwidths comparable to the grid spacing, where it keeps the
+ * smoothing from changing the number of events.
+ */
+inline std::vector<double> sampled_kernel(size_t L, double delta, double h)
+{
+	std::vector<double> samples(L + 1);
+
+	double sum = 0.0;
+
+	for(size_t m=0; m<=L; m++){
+
+		double u = m*delta/h;
+
+		samples[m] = math_constants::inverse_sqrt2Pi*::exp(-0.5*u*u);
+		sum += m==0 ? samples[m] : 2.0*samples[m];
+	}
+
+	for(auto& sample: samples) sample *= h/(delta*sum);
+
+	return samples;
+}
+
+/*
+ * Discrete convolution s_k = sum_l c_l phi((k - l) delta/h) of the binned counts with the sampled
+ * Gaussian kernel, truncated at kernel_cutoff bandwidths. The convolution is calculated with
+ * power-of-two native transforms, padded to avoid the circular wrap-around.
+ */
+inline std::vector<double> gaussian_smoothing(std::vector<double> const& counts, double delta, double h)
+{
+	typedef hydra::complex<double> complex_t;
+	typedef detail::native_fft::Plan<double, hydra::detail::native_fft::default_backend_type> plan_t;
+
+	size_t npoints = counts.size();
+	size_t L = std::min(npoints - 1, size_t(::ceil(kernel_cutoff*h/delta)));
+
+	size_t size = 1;
+	while( size < npoints + L ) size <<= 1;
+
+	std::vector<complex_t> data(size, complex_t(0.0, 0.0));
+	std::vector<complex_t> kernel(size, complex_t(0.0, 0.0));
+	std::vector<complex_t> data_fft(size);
+	std::vector<complex_t> kernel_fft(size);
+
+	for(size_t j=0; j<npoints; j++)
+		data[j] = complex_t(counts[j], 0.0);
+
+	std::vector<double> samples = sampled_kernel(L, delta, h);
+
+	for(size_t m=0; m<=L; m++){
+
+		kernel[m] = complex_t(samples[m], 0.0);
+		if(m>0) kernel[size - m] = complex_t(samples[m], 0.0);
+	}
+
+	plan_t forward(size, -1);
+	plan_t backward(size, +1);
+
+	forward.Execute(data.data(), data_fft.data());
+	forward.Execute(kernel.data(), kernel_fft.data());
+
+	for(size_t k=0; k<size; k++)
+		data_fft[k] *= kernel_fft[k];
+
+	backward.Execute(data_fft.data(), data.data());
+
+	std::vector<double> smoothed(npoints);
+
+	for(size_t j=0; j<npoints; j++)
+		smoothed[j] = data[j].real()/size;
+
+	return smoothed;
+}
+
+/*
+ * Multilinear binning of [begin, end) on the grid of npoints[a] points min[a] + j*delta[a] along each axis,
+ * the axis 0 running fastest, returned in host memory. The number of partitions is limited to keep their
+ * private histograms below 2^25 grid points in total.
+ */
+template<size_t N, typename Iterator>
+inline std::vector<double> linear_binning(Iterator begin, Iterator end, std::array<double, N> const& min,
+		std::array<double, N> const& delta, std::array<size_t, N> const& npoints)
+{
+	typedef typename hydra::thrust::iterator_system<Iterator>::type system_t;
+
+	size_t size = 1;
+	for(size_t a=0; a<N; a++) size *= npoints[a];
+
+	std::vector<double> counts(size, 0.0);
+
+	size_t n = hydra::thrust::distance(begin, end);
+
+	if(n==0) return counts;
+
+	size_t npartitions = std::min(size_t(256), std::max(size_t(1), n >> 16));
+	npartitions        = std::min(npartitions, std::max(size_t(1), (size_t(1) << 25)/size));
+	size_t chunk       = (n + npartitions - 1)/npartitions;
+	npartitions        = (n + chunk - 1)/chunk;
+
+	auto partials = hydra::thrust::get_temporary_buffer<double>(system_t(), npartitions*size);
+
+	hydra::thrust::for_each(system_t(),
+			hydra::thrust::counting_iterator<size_t>(0),
+			hydra::thrust::counting_iterator<size_t>(npartitions),
+			LinearBinningND<N, Iterator, decltype(partials.first)>(begin, partials.first, n, chunk, npoints, min, delta));
+
+	std::vector<double> host_partials(npartitions*size);
+
+	hydra::thrust::copy(partials.first, partials.first + npartitions*size, host_partials.begin());
+
+	hydra::thrust::return_temporary_buffer(system_t(), partials.first, partials.second);
+
+	for(size_t p=0; p<npartitions; p++)
+		for(size_t j=0; j<size; j++)
+			counts[j] += host_partials[p*size + j];
+
+	return counts;
+}
+
+/*
+ * Convolution of a grid of npoints[a] points along each axis, the axis 0 running fastest, with the
+ * product of sampled Gaussian kernels of bandwidths h[a], truncated at kernel_cutoff bandwidths.
+ * The kernel is separable, so the grid is smoothed one axis at a time, with batches of lines
+ * transformed by power-of-two native plans padded to avoid the circular wrap-around.
+ * The lines holding only zeros are skipped.
+ */
+template<size_t N>
+inline void gaussian_smoothing(std::vector<double>& grid, std::array<size_t, N> const& npoints,
+		std::array<double, N> const& delta, std::array<double, N> const& h)
+{
+	typedef hydra::complex<double> complex_t;
+	typedef detail::native_fft::Plan<double, detail::native_fft::default_backend_type> plan_t;
+
+	// lines transformed per batch
+	constexpr size_t max_batch = 256;
+
+	size_t stride = 1;
+
+	for(size_t a=0; a<N; a++){
+
+		size_t length = npoints[a];
+		size_t L = std::min(length - 1, size_t(::ceil(kernel_cutoff*h[a]/delta[a])));
+
+		size_t size = 1;
+		while( size < length + L ) size <<= 1;
+
+		std::vector<complex_t> kernel(size, complex_t(0.0, 0.0));
+		std::vector<complex_t> kernel_fft(size);
+
+		std::vector<double> samples = sampled_kernel(L, delta[a], h[a]);
+
+		for(size_t m=0; m<=L; m++){
+
+			kernel[m] = complex_t(samples[m], 0.0);
+			if(m>0) kernel[size - m] = complex_t(samples[m], 0.0);
+		}
+
+		plan_t forward(size, -1);
+		plan_t backward(size, +1);
+
+		forward.Execute(kernel.data(), kernel_fft.data());
+
+		// bases of the lines along the axis holding any non-zero value
+		std::vector<size_t> bases;
+
+		for(size_t line=0; line<grid.size()/length; line++){
+
+			size_t base = line%stride + (line/stride)*stride*length;
+
+			for(size_t j=0; j<length; j++)
+				if( grid[base + j*stride]!=0.0 ){ bases.push_back(base); break; }
+		}
+
+		size_t nlines = bases.size();
+		size_t batch  = std::min(nlines, max_batch);
+
+		std::vector<complex_t> lines(batch*size);
+		std::vector<complex_t> lines_fft(batch*size);
+
+		for(size_t first=0; first<nlines; first+=batch){
+
+			size_t nbatch = std::min(batch, nlines - first);
+
+			std::fill(lines.begin(), lines.end(), complex_t(0.0, 0.0));
+
+			for(size_t l=0; l<nbatch; l++){
+
+				size_t base = bases[first + l];
+
+				for(size_t j=0; j<length; j++)
+					lines[l*size + j] = complex_t(grid[base + j*stride], 0.0);
+			}
+
+			forward.Execute(lines.data(), lines_fft.data(), nbatch);
+
+			for(size_t l=0; l<nbatch; l++)
+				for(size_t k=0; k<size; k++)
+					lines_fft[l*size + k] *= kernel_fft[k];
+
+			backward.Execute(lines_fft.data(), lines.data(), nbatch);
+
+			for(size_t l=0; l<nbatch; l++){
+
+				size_t base = bases[first + l];
+
+				for(size_t j=0; j<length; j++)
+					grid[base + j*stride] = lines[l*size + j].real()/size;
+			}
+		}
+
+		stride *= length;
+	}
+}
+
+/*
+ * Weights of the four nodes k-1, k, k+1, k+2 of the Catmull-Rom cubic interpolating the cell [k, k+1] at
+ * the fraction t of the cell.
+ */
+__hydra_host__ __hydra_device__
+inline void catmull_rom_weights(double t, double (&w)[4])
+{
+	double t2 = t*t;
+	double t3 = t2*t;
+
+	w[0] = 0.5*(-t + 2.0*t2 - t3);
+	w[1] = 0.5*(2.0 - 5.0*t2 + 3.0*t3);
+	w[2] = 0.5*(t + 4.0*t2 - 3.0*t3);
+	w[3] = 0.5*(-t2 + t3);
+}
+
+/*
+ * Primitives of the Catmull-Rom weights, vanishing at t=0.
+ */
+inline void catmull_rom_primitives(double t, double (&w)[4])
+{
+	double t2 = t*t;
+	double t3 = t2*t;
+	double t4 = t3*t;
+
+	w[0] = 0.5*(-t2/2.0 + 2.0*t3/3.0 - t4/4.0);
+	w[1] = 0.5*(2.0*t - 5.0*t3/3.0 + 3.0*t4/4.0);
+	w[2] = 0.5*(t2/2.0 + 4.0*t3/3.0 - 3.0*t4/4.0);
+	w[3] = 0.5*(-t3/3.0 + t4/4.0);
+}
+
+/*
+ * Multilinear or tensor-product Catmull-Rom interpolation of the grid of n[a] points min[a] + j*delta[a]
+ * along each axis, the axis 0 running fastest. The nodes beyond the borders are replaced by the border nodes,
+ * and the points outside the grid evaluate to zero. Both interpolations are linear in the grid values.
+ */
+template<size_t N, typename Pointer>
+__hydra_host__ __hydra_device__
+inline double interpolate(Pointer data, const size_t (&n)[N], const double (&min)[N],
+		const double (&delta)[N], const double (&x)[N], bool cubic)
+{
+	size_t index[N];
+	double t[N];
+
+	for(size_t a=0; a<N; a++){
+
+		double u = (x[a] - min[a])/delta[a];
+
+		if( !(u >= 0.0) || u > double(n[a] - 1) ) return 0.0;
+
+		index[a] = size_t(u);
+		t[a]     = u - double(index[a]);
+
+		if( index[a] + 1 == n[a] ){ index[a]--; t[a] = 1.0; }
+	}
+
+	double result = 0.0;
+
+	if(!cubic){
+
+		for(size_t corner=0; corner < (size_t(1)<<N); corner++){
+
+			double weight = 1.0;
+			size_t offset = 0;
+			size_t stride = 1;
+
+			for(size_t a=0; a<N; a++){
+
+				size_t upper = (corner >> a) & 1;
+
+				weight *= upper ? t[a] : 1.0 - t[a];
+				offset += (index[a] + upper)*stride;
+				stride *= n[a];
+			}
+
+			result += weight*data[offset];
+		}
+
+		return result;
+	}
+
+	double w[N][4];
+
+	for(size_t a=0; a<N; a++)
+		catmull_rom_weights(t[a], w[a]);
+
+	for(size_t node=0; node < (size_t(1)<<(2*N)); node++){
+
+		double weight = 1.0;
+		size_t offset = 0;
+		size_t stride = 1;
+
+		for(size_t a=0; a<N; a++){
+
+			size_t m = (node >> (2*a)) & 3;
+			size_t j = index[a] + m;
+
+			//nodes index[a]-1 ... index[a]+2, clamped to the grid
+			j = j==0 ? 0 : j - 1;
+			j = j < n[a] ? j : n[a] - 1;
+
+			weight *= w[a][m];
+			offset += j*stride;
+			stride *= n[a];
+		}
+
+		result += weight*data[offset];
+	}
+
+	return result;
+}
+
+/*
+ * Weights w[j] such that the integral of the interpolation along one axis over [lower, upper]
+ * is sum_j w[j]*y[j], for the grid of n points min + j*delta.
+ */
+inline std::vector<double> integration_weights(size_t n, double min, double delta,
+		double lower, double upper, bool cubic)
+{
+	std::vector<double> weights(n, 0.0);
+
+	double ulow = std::max((lower - min)/delta, 0.0);
+	double uup  = std::min((upper - min)/delta, double(n - 1));
+
+	if( !(uup > ulow) ) return weights;
+
+	size_t first = std::min(size_t(ulow), n - 2);
+	size_t last  = std::min(size_t(::ceil(uup)), n - 1);
+
+	for(size_t k=first; k<last; k++){
+
+		double t0 = std::max(ulow - k, 0.0);
+		double t1 = std::min(uup  - k, 1.0);
+
+		if( !(t1 > t0) ) continue;
+
+		if(!cubic){
+
+			double s = 0.5*(t1*t1 - t0*t0);
+
+			weights[k]     += delta*(t1 - t0 - s);
+			weights[k + 1] += delta*s;
+
+			continue;
+		}
+
+		double w0[4], w1[4];
+
+		catmull_rom_primitives(t0, w0);
+		catmull_rom_primitives(t1, w1);
+
+		size_t nodes[4] = { k==0 ? 0 : k - 1, k, k + 1, std::min(k + 2, n - 1) };
+
+		for(size_t m=0; m<4; m++)
+			weights[nodes[m]] += delta*(w1[m] - w0[m]);
+	}
+
+	return weights;
+}
+
+}  // namespace kde
+
+}  // namespace detail
+
+}  // namespace hydra
+
+#endif /* BINNEDKDE_H_ */
@@ -38,48 +38,69 @@
 #include <hydra/Types.h>
 #include <hydra/Function.h>
 #include <hydra/detail/external/hydra_thrust/transform_reduce.h>
-#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+#include <hydra/detail/external/hydra_thrust/distance.h>
 #include <hydra/detail/external/hydra_thrust/extrema.h>
 
 #include <math.h>
+#include <vector>
 #include <algorithm>
+#include <stdexcept>
 
 namespace hydra {
 
-template< size_t NBins, typename ArgType>
+template< size_t NBins, typename ArgType, typename Signature>
 template<typename Iterator>
-__hydra_host__ __hydra_device__
-inline CubicSpiline<NBins> GaussianKDE<NBins, ArgType>::BuildKDE(double min, double max, double h, Iterator begin, Iterator end) {
+inline void GaussianKDE<NBins, ArgType, Signature>::BuildKDE(double min, double max, double h, Iterator begin, Iterator end) {
+
+	if( !(max > min) )
+		throw std::invalid_argument("[hydra::GaussianKDE]: Invalid range. (max <= min)");
+
+	double n = hydra::thrust::distance(begin, end);
+
+	if( n==0 )
+		throw std::invalid_argument("[hydra::GaussianKDE]: Empty sample. (begin == end)");
 
-	auto _KDE = [=](double x){
+	double bin_width = (max-min)/(NBins-1);
 
-		double init = 0;
+	for(size_t i=0; i<NKnots; i++){
+
+		fX[i] = min + i*bin_width;
 
 		double sum  = hydra::thrust::transform_reduce(begin, end,
-				GaussianKDE<NBins, ArgType>::Kernel(h,x), 0.0,
+				typename GaussianKDE<NBins, ArgType, Signature>::Kernel(h, fX[i]), 0.0,
 				hydra::thrust::plus<double>() );
 
-		return  sum/(h*hydra::thrust::distance(begin, end) ) ;
-	};
+		fD[i] = sum/(h*n);
+	}
+}
+
+template< size_t NBins, typename ArgType, typename Signature>
+template<typename Iterator>
+inline void GaussianKDE<NBins, ArgType, Signature>::BuildBinnedKDE(double min, double max, double h, Iterator begin, Iterator end) {
 
-	double bin_width = (max-min)/(NBins);
+	if( !(max > min) )
+		throw std::invalid_argument("[hydra::GaussianKDE]: Invalid range. (max <= min)");
 
-	auto _X = [=](size_t index){
+	double n = hydra::thrust::distance(begin, end);
 
-		return min + index*bin_width;
-	};
+	if( n==0 )
+		throw std::invalid_argument("[hydra::GaussianKDE]: Empty sample. (begin == end)");
 
-	typedef hydra::thrust::counting_iterator<size_t> citerator;
-	citerator counter(0);
+	double bin_width = (max-min)/(NBins-1);
 
-	typedef hydra::thrust::transform_iterator<decltype(_X),   citerator> xiterator;
-	xiterator Xiterator(counter,  _X);
+	//the grid extends kernel_cutoff bandwidths beyond the knots
+	size_t pad     = size_t(::ceil(detail::kde::kernel_cutoff*h/bin_width));
+	size_t npoints = NKnots + 2*pad;
 
-	hydra::thrust::transform_iterator<decltype(_KDE), xiterator> diterator(Xiterator,  _KDE);
+	std::vector<double> counts = detail::kde::linear_binning(begin, end, min - pad*bin_width, bin_width, npoints);
 
-	return CubicSpiline<NBins>(Xiterator, diterator);
+	std::vector<double> smoothed = detail::kde::gaussian_smoothing(counts, bin_width, h);
 
+	for(size_t i=0; i<NKnots; i++){
 
+		fX[i] = min + i*bin_width;
+		fD[i] = smoothed[i + pad]/(h*n);
+	}
 }
 
 }  // namespace hydra
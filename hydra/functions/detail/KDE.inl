@@ -0,0 +1,248 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * KDE.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef KDE_INL_
+#define KDE_INL_
+
+#include <hydra/detail/external/hydra_thrust/distance.h>
+#include <hydra/detail/external/hydra_thrust/iterator/transform_iterator.h>
+
+#include <math.h>
+#include <algorithm>
+
+namespace hydra {
+
+template<size_t N, detail::Backend BACKEND, typename ...ArgTypes>
+template<typename Iterator>
+std::array<double, N>
+KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>::Bandwidth(KDEBandwidth rule, Iterator begin, Iterator end)
+{
+	std::array<double, N> h;
+
+	double n = hydra::thrust::distance(begin, end);
+
+	for(size_t a=0; a<N; a++){
+
+		auto first = hydra::thrust::make_transform_iterator(begin, detail::kde::AxisCoordinate<N>(a));
+		auto last  = hydra::thrust::make_transform_iterator(end,   detail::kde::AxisCoordinate<N>(a));
+
+		h[a] = detail::kde::bandwidth(rule, first, last)*::pow(n, 0.2 - 1.0/(N + 4.0));
+	}
+
+	return h;
+}
+
+template<size_t N, detail::Backend BACKEND, typename ...ArgTypes>
+template<typename Iterator>
+void KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>::Build(std::array<double, N> const& min,
+		std::array<double, N> const& max, std::array<size_t, N> const& nbins,
+		std::array<double, N> const& h, Iterator begin, Iterator end)
+{
+	using hydra::thrust::get_temporary_buffer;
+
+	if( fAlpha < 0.0 )
+		throw std::invalid_argument("[hydra::KDE]: Negative sensitivity. (alpha < 0)");
+
+	double n = hydra::thrust::distance(begin, end);
+
+	if( n==0 )
+		throw std::invalid_argument("[hydra::KDE]: Empty sample. (begin == end)");
+
+	// extended grid
+	std::array<size_t, N> npoints;
+	std::array<double, N> gmin, delta;
+
+	size_t pad[N];
+	double volume = 1.0;
+
+	// widest kernel: the upper neighbour class of the capped bandwidth factor, in the adaptive case
+	double max_factor = fAlpha > 0.0 ? max_bandwidth_factor*bandwidth_class_ratio : 1.0;
+
+	fNValues = 1;
+
+	for(size_t a=0; a<N; a++){
+
+		if( nbins[a] < 2 )
+			throw std::invalid_argument("[hydra::KDE]: Less than two nodes per axis. (nbins[a] < 2)");
+
+		if( !(max[a] > min[a]) )
+			throw std::invalid_argument("[hydra::KDE]: Invalid range. (max[a] <= min[a])");
+
+		if( !(h[a] > 0.0) )
+			throw std::invalid_argument("[hydra::KDE]: Bandwidth is not positive. (h[a] <= 0)");
+
+		fNBins[a] = nbins[a];
+		fMin[a]   = min[a];
+		fDelta[a] = (max[a] - min[a])/(nbins[a] - 1);
+		fH[a]     = h[a];
+
+		pad[a]     = size_t(::ceil(max_factor*detail::kde::kernel_cutoff*h[a]/fDelta[a]));
+		npoints[a] = nbins[a] + 2*pad[a];
+		gmin[a]    = min[a] - pad[a]*fDelta[a];
+		delta[a]   = fDelta[a];
+
+		volume   *= h[a];
+		fNValues *= nbins[a];
+	}
+
+	std::vector<double> counts = detail::kde::linear_binning<N>(begin, end, gmin, delta, npoints);
+
+	size_t size = counts.size();
+
+	// fixed bandwidth pilot
+	std::vector<double> density(counts);
+
+	detail::kde::gaussian_smoothing<N>(density, npoints, delta, h);
+
+	for(auto& d: density) d /= n*volume;
+
+	if( fAlpha > 0.0 ){
+
+		// geometric mean of the pilot over the binned sample
+		double total = 0.0, log_mean = 0.0, peak = 0.0;
+
+		for(size_t j=0; j<size; j++){
+
+			peak = std::max(peak, density[j]);
+
+			if( counts[j] > 0.0 ){
+
+				total    += counts[j];
+				log_mean += counts[j]*::log(std::max(density[j], 1.0e-300));
+			}
+		}
+
+		double g = ::exp(log_mean/total);
+
+		// bandwidth factors of the nodes, as fractional class indices
+		double lambda_min = std::min(::pow(peak/g, -fAlpha), max_bandwidth_factor);
+		double log_ratio  = ::log(bandwidth_class_ratio);
+
+		std::vector<double> classes(size, 0.0);
+		size_t nclasses = 1;
+
+		for(size_t j=0; j<size; j++){
+
+			if( counts[j]==0.0 ) continue;
+
+			double lambda = std::min(::pow(std::max(density[j], 1.0e-300)/g, -fAlpha), max_bandwidth_factor);
+
+			classes[j] = std::max(::log(lambda/lambda_min)/log_ratio, 0.0);
+
+			nclasses = std::max(nclasses, size_t(classes[j]) + 2);
+		}
+
+		std::fill(density.begin(), density.end(), 0.0);
+
+		std::vector<double> grid(size);
+
+		for(size_t k=0; k<nclasses; k++){
+
+			double lambda = lambda_min*::pow(bandwidth_class_ratio, double(k));
+
+			bool empty = true;
+
+			for(size_t j=0; j<size; j++){
+
+				double u = classes[j] - double(k);
+
+				grid[j] = counts[j] > 0.0 && ::fabs(u) < 1.0 ? counts[j]*(1.0 - ::fabs(u)) : 0.0;
+
+				empty = empty && grid[j]==0.0;
+			}
+
+			if(empty) continue;
+
+			std::array<double, N> hk;
+			for(size_t a=0; a<N; a++) hk[a] = lambda*h[a];
+
+			detail::kde::gaussian_smoothing<N>(grid, npoints, delta, hk);
+
+			double scale = 1.0/(n*volume*::pow(lambda, double(N)));
+
+			for(size_t j=0; j<size; j++)
+				density[j] += grid[j]*scale;
+		}
+	}
+
+	// nodes of the grid [min, max]
+	std::vector<double> values(fNValues);
+
+	for(size_t i=0; i<fNValues; i++){
+
+		size_t offset = 0, stride = 1, rest = i;
+
+		for(size_t a=0; a<N; a++){
+
+			offset += (rest%nbins[a] + pad[a])*stride;
+			rest   /= nbins[a];
+			stride *= npoints[a];
+		}
+
+		values[i] = density[offset];
+	}
+
+	fHostData   = get_temporary_buffer<double>(raw_host_system_type(),   fNValues).first;
+	fDeviceData = get_temporary_buffer<double>(raw_device_system_type(), fNValues).first;
+
+	hydra::thrust::copy(values.begin(), values.end(), fHostData);
+	hydra::thrust::copy(values.begin(), values.end(), fDeviceData);
+}
+
+template<size_t N, detail::Backend BACKEND, typename ...ArgTypes>
+double KDE<N, detail::BackendPolicy<BACKEND>, ArgTypes...>::Integral(std::array<double, N> const& lower,
+		std::array<double, N> const& upper) const
+{
+	std::vector<double> weights[N];
+
+	for(size_t a=0; a<N; a++)
+		weights[a] = detail::kde::integration_weights(fNBins[a], fMin[a], fDelta[a], lower[a], upper[a], fCubic);
+
+	double result = 0.0;
+
+	for(size_t i=0; i<fNValues; i++){
+
+		double weight = 1.0;
+		size_t rest = i;
+
+		for(size_t a=0; a<N && weight!=0.0; a++){
+
+			weight *= weights[a][rest%fNBins[a]];
+			rest   /= fNBins[a];
+		}
+
+		if( weight!=0.0 ) result += weight*fHostData[i];
+	}
+
+	return result;
+}
+
+}  // namespace hydra
+
+#endif /* KDE_INL_ */
@@ -0,0 +1,218 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * SplineTableFunctor.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef SPLINETABLEFUNCTOR_INL_
+#define SPLINETABLEFUNCTOR_INL_
+
+#include <hydra/detail/functors/ProcessSplineTable.h>
+#include <hydra/detail/external/hydra_thrust/for_each.h>
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/sequence.h>
+#include <hydra/detail/external/hydra_thrust/sort.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+#include <hydra/detail/external/hydra_thrust/iterator/iterator_traits.h>
+#include <hydra/detail/external/hydra_thrust/iterator/zip_iterator.h>
+
+#include <math.h>
+
+namespace hydra {
+
+template<detail::Backend BACKEND, typename ...ArgTypes>
+void SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>::Build(
+		std::array<std::vector<double>, N> const& abscissae, std::vector<double> const& values)
+{
+	using hydra::thrust::get_temporary_buffer;
+
+	size_t npoints = 1, nnodes = 0;
+
+	for(size_t a=0; a<N; a++){
+
+		std::vector<double> const& x = abscissae[a];
+
+		size_t n = x.size();
+
+		if( n < 2 )
+			throw std::invalid_argument("[hydra::SplineTableFunctor]: At least two nodes per axis are needed. (abscissae[a].size() < 2)");
+
+		for(size_t i=0; i+1<n; i++)
+			if( !(x[i] < x[i + 1]) )
+				throw std::invalid_argument("[hydra::SplineTableFunctor]: The nodes must be strictly increasing. (abscissae[a][i] >= abscissae[a][i+1])");
+
+		// equally spaced nodes are located without search
+		double h = (x[n - 1] - x[0])/(n - 1);
+
+		bool uniform = true;
+
+		for(size_t i=1; i+1<n && uniform; i++)
+			uniform = ::fabs(x[i] - (x[0] + i*h)) <= 1.0e-10*(x[n - 1] - x[0]);
+
+		fNKnots[a]  = n;
+		fOffset[a]  = nnodes;
+		fUniform[a] = uniform;
+		fX0[a]      = x[0];
+		fInvH[a]    = 1.0/h;
+
+		nnodes  += n;
+		npoints *= n;
+	}
+
+	fNRows   = npoints/fNKnots[0];
+	fNValues = nnodes + 4*fNRows*(fNKnots[0] - 1);
+
+	// nodes of every axis, followed by the coefficients of the rows along the first axis
+	std::vector<double> nodes;
+	nodes.reserve(nnodes);
+
+	for(size_t a=0; a<N; a++)
+		nodes.insert(nodes.end(), abscissae[a].begin(), abscissae[a].end());
+
+	fHostData   = get_temporary_buffer<double>(raw_host_system_type(),   fNValues).first;
+	fDeviceData = get_temporary_buffer<double>(raw_device_system_type(), fNValues).first;
+
+	hydra::thrust::copy(nodes.begin(), nodes.end(), fHostData);
+	hydra::thrust::copy(nodes.begin(), nodes.end(), fDeviceData);
+
+	SetValues(values);
+}
+
+template<detail::Backend BACKEND, typename ...ArgTypes>
+void SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>::SetValues(std::vector<double> const& values)
+{
+	if( values.size() != fNRows*fNKnots[0] )
+		throw std::invalid_argument("[hydra::SplineTableFunctor]: The number of values does not match the grid. (values.size() != number of grid points)");
+
+	// the nodes of the first axis lead the stored data
+	std::vector<double> x(fNKnots[0]);
+
+	hydra::thrust::copy(fHostData, fHostData + fNKnots[0], x.begin());
+
+	std::vector<double> coefficients;
+	coefficients.reserve(4*fNRows*(fNKnots[0] - 1));
+
+	for(size_t row=0; row<fNRows; row++)
+		detail::spline::steffen_coefficients(x.data(), fNKnots[0], values.data() + row*fNKnots[0], coefficients);
+
+	size_t nnodes = fOffset[N-1] + fNKnots[N-1];
+
+	hydra::thrust::copy(coefficients.begin(), coefficients.end(), fHostData   + nnodes);
+	hydra::thrust::copy(coefficients.begin(), coefficients.end(), fDeviceData + nnodes);
+}
+
+template<detail::Backend BACKEND, typename ...ArgTypes>
+template<size_t M>
+typename std::enable_if<M==1, double>::type
+SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>::Integral(double lower, double upper) const
+{
+	if( lower > upper ) return -Integral(upper, lower);
+
+	const double* data  = hydra::thrust::raw_pointer_cast(fHostData);
+	const double* table = data + fNKnots[0];
+
+	size_t n = fNKnots[0];
+
+	double x0 = data[0], x1 = data[n - 1];
+
+	// constant continuation beyond the grid
+	double r = 0.0;
+
+	if( lower < x0 ) r += ( (upper < x0 ? upper : x0) - lower )*table[3];
+	if( upper > x1 ) r += ( upper - (lower > x1 ? lower : x1) )*detail::spline::horner(table + 4*(n - 2), x1 - data[n - 2]);
+
+	double a = lower < x0 ? x0 : lower;
+	double b = upper > x1 ? x1 : upper;
+
+	if( !(a < b) ) return r;
+
+	size_t i = detail::spline::locate(data, n, fUniform[0], fX0[0], fInvH[0], a);
+	size_t j = detail::spline::locate(data, n, fUniform[0], fX0[0], fInvH[0], b);
+
+	if( i == j )
+		return r + detail::spline::primitive(table + 4*i, b - data[i]) - detail::spline::primitive(table + 4*i, a - data[i]);
+
+	r += detail::spline::primitive(table + 4*i, data[i + 1] - data[i]) - detail::spline::primitive(table + 4*i, a - data[i]);
+
+	for(size_t k=i+1; k<j; k++)
+		r += detail::spline::primitive(table + 4*k, data[k + 1] - data[k]);
+
+	return r + detail::spline::primitive(table + 4*j, b - data[j]);
+}
+
+template<detail::Backend BACKEND, typename ...ArgTypes>
+template<typename Iterator, typename OutputIterator>
+OutputIterator SplineTableFunctor<detail::BackendPolicy<BACKEND>, ArgTypes...>::Interpolate(
+		Iterator begin, Iterator end, OutputIterator result, bool sort) const
+{
+	typedef typename hydra::thrust::iterator_system<Iterator>::type system_t;
+
+	size_t npoints = hydra::thrust::distance(begin, end);
+
+	if( npoints == 0 ) return result;
+
+	constexpr size_t chunk_size = detail::spline::chunk_size<system_t>::value;
+
+	size_t nchunks = (npoints + chunk_size - 1)/chunk_size;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+
+	if( !sort ){
+
+		hydra::thrust::for_each(system_t(), first, first + nchunks,
+				detail::ProcessSplineTable<this_type, Iterator, OutputIterator, N>(*this, begin, result, nullptr, npoints, chunk_size) );
+
+		return result + npoints;
+	}
+
+	// copy of the points sorted by grid cell, along with their positions
+	typedef typename hydra::thrust::iterator_traits<Iterator>::value_type point_type;
+
+	auto keys   = hydra::thrust::get_temporary_buffer<uint32_t>(system_t(), npoints);
+	auto order  = hydra::thrust::get_temporary_buffer<size_t>(system_t(), npoints);
+	auto points = hydra::thrust::get_temporary_buffer<point_type>(system_t(), npoints);
+
+	hydra::thrust::transform(system_t(), begin, end, keys.first, detail::SplineTableKey<N>(*this));
+	hydra::thrust::sequence(system_t(), order.first, order.first + npoints);
+	hydra::thrust::copy(system_t(), begin, end, points.first);
+
+	hydra::thrust::sort_by_key(system_t(), keys.first, keys.first + npoints,
+			hydra::thrust::make_zip_iterator(hydra::thrust::make_tuple(points.first, order.first)));
+
+	hydra::thrust::for_each(system_t(), first, first + nchunks,
+			detail::ProcessSplineTable<this_type, point_type*, OutputIterator, N>(*this, hydra::thrust::raw_pointer_cast(points.first), result,
+					hydra::thrust::raw_pointer_cast(order.first), npoints, chunk_size) );
+
+	hydra::thrust::return_temporary_buffer(system_t(), keys.first, keys.second);
+	hydra::thrust::return_temporary_buffer(system_t(), order.first, order.second);
+	hydra::thrust::return_temporary_buffer(system_t(), points.first, points.second);
+
+	return result + npoints;
+}
+
+}  // namespace hydra
+
+#endif /* SPLINETABLEFUNCTOR_INL_ */
@@ -0,0 +1,239 @@
+/*----------------------------------------------------------------------------
+ *
+ *   Copyright (C) 2016 - 2025 Antonio Augusto Alves Junior
+ *
+ *   This file is part of Hydra Data Analysis Framework.
+ *
+ *   Hydra is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Hydra is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with Hydra.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *---------------------------------------------------------------------------*/
+
+
+/*
+ * TabulatedFunctor.inl
+ *
+ *  Created on: 19/10/2026
+ *      Author: Antonio Augusto Alves Junior
+ */
+
+#ifndef TABULATEDFUNCTOR_INL_
+#define TABULATEDFUNCTOR_INL_
+
+#include <hydra/detail/external/hydra_thrust/transform.h>
+#include <hydra/detail/external/hydra_thrust/transform_reduce.h>
+#include <hydra/detail/external/hydra_thrust/functional.h>
+#include <hydra/detail/external/hydra_thrust/random.h>
+#include <hydra/detail/external/hydra_thrust/memory.h>
+#include <hydra/detail/external/hydra_thrust/iterator/counting_iterator.h>
+
+#include <math.h>
+#include <sstream>
+
+namespace hydra {
+
+namespace detail {
+
+namespace tabulated {
+
+/*
+ * Functor at the node i of the grid of n nodes spanning [min, max].
+ */
+template<typename Functor, typename ArgType>
+struct NodeValue
+{
+	NodeValue(Functor const& functor, double min, double max, size_t n):
+		fFunctor(functor),
+		fMin(min),
+		fMax(max),
+		fN(n)
+	{}
+
+	__hydra_host__ __hydra_device__
+	NodeValue(NodeValue<Functor, ArgType> const& other):
+		fFunctor(other.fFunctor),
+		fMin(other.fMin),
+		fMax(other.fMax),
+		fN(other.fN)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline double operator()(size_t i) const
+	{
+		return fFunctor( ArgType( node(i, fMin, fMax, fN) ) );
+	}
+
+	__hydra_host__ __hydra_device__
+	static inline double node(size_t i, double min, double max, size_t n)
+	{
+		return i + 1 == n ? max : min + i*(max - min)/(n - 1);
+	}
+
+	Functor fFunctor;
+	double fMin;
+	double fMax;
+	size_t fN;
+};
+
+/*
+ * Absolute deviation between the functor and its table at the i-th check point: a random point of
+ * the interval i%(n-1) of the grid of n nodes spanning [min, max], so that consecutive points cover
+ * all intervals.
+ */
+template<typename Functor, typename Table, typename ArgType>
+struct Deviation
+{
+	Deviation(Functor const& functor, Table const& table, double min, double max, size_t n, size_t seed):
+		fFunctor(functor),
+		fTable(table),
+		fMin(min),
+		fMax(max),
+		fN(n),
+		fSeed(seed)
+	{}
+
+	__hydra_host__ __hydra_device__
+	Deviation(Deviation<Functor, Table, ArgType> const& other):
+		fFunctor(other.fFunctor),
+		fTable(other.fTable),
+		fMin(other.fMin),
+		fMax(other.fMax),
+		fN(other.fN),
+		fSeed(other.fSeed)
+	{}
+
+	__hydra_host__ __hydra_device__
+	inline double operator()(size_t i) const
+	{
+		hydra::thrust::default_random_engine engine(fSeed);
+		engine.discard(i);
+
+		hydra::thrust::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+		size_t interval = i%(fN - 1);
+
+		double lower = NodeValue<Functor, ArgType>::node(interval,     fMin, fMax, fN);
+		double upper = NodeValue<Functor, ArgType>::node(interval + 1, fMin, fMax, fN);
+
+		double x[1]{ lower + uniform(engine)*(upper - lower) };
+		size_t cell[1];
+
+		return ::fabs( double(fFunctor(ArgType(x[0]))) - fTable.Interpolate(x, cell, false) );
+	}
+
+	Functor fFunctor;
+	Table   fTable;
+	double fMin;
+	double fMax;
+	size_t fN;
+	size_t fSeed;
+};
+
+}  // namespace tabulated
+
+}  // namespace detail
+
+template<typename Functor, detail::Backend BACKEND, typename ArgType>
+std::array<std::vector<double>, 1>
+TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>::Grid(double min, double max, size_t nnodes)
+{
+	if( !(min < max) )
+		throw std::invalid_argument("[hydra::TabulatedFunctor]: Empty tabulation range. (min >= max)");
+
+	if( nnodes < 2 )
+		throw std::invalid_argument("[hydra::TabulatedFunctor]: At least two nodes are needed. (nnodes < 2)");
+
+	std::vector<double> nodes(nnodes);
+
+	for(size_t i=0; i<nnodes; i++)
+		nodes[i] = detail::tabulated::NodeValue<Functor, ArgType>::node(i, min, max, nnodes);
+
+	return std::array<std::vector<double>, 1>{ nodes };
+}
+
+template<typename Functor, detail::Backend BACKEND, typename ArgType>
+void TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>::Tabulate()
+{
+	typedef typename std::remove_const<decltype(std::declval<device_system_type>().backend)>::type raw_device_system_type;
+
+	size_t nnodes = GetNNodes();
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+
+	auto values_d = hydra::thrust::get_temporary_buffer<double>(raw_device_system_type(), nnodes);
+
+	hydra::thrust::transform(device_system_type(), first, first + nnodes, values_d.first,
+			detail::tabulated::NodeValue<Functor, ArgType>(fFunctor, fMin, fMax, nnodes));
+
+	std::vector<double> values(nnodes);
+
+	hydra::thrust::copy(values_d.first, values_d.first + nnodes, values.begin());
+
+	hydra::thrust::return_temporary_buffer(raw_device_system_type(), values_d.first, values_d.second);
+
+	fTable.SetValues(values);
+
+	fKey = fFunctor.GetParametersKey();
+
+	fNTabulations++;
+
+	if( fNChecks == 0 ) return;
+
+	fMaxError = Check(fNChecks);
+
+	if( fTolerance > 0.0 && fMaxError > fTolerance && WARNING >= Print::Level() )
+	{
+		std::ostringstream stringStream;
+
+		stringStream << "Deviation of the table from the functor " << fMaxError
+				     << " above the tolerance " << fTolerance << ".\n"
+				     << "Increase the number of nodes.\n";
+
+		HYDRA_LOG(WARNING, stringStream.str().c_str() )
+	}
+}
+
+template<typename Functor, detail::Backend BACKEND, typename ArgType>
+double TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>::Check(size_t nchecks) const
+{
+	if( nchecks == 0 ) return 0.0;
+
+	// the same number of points in every interval, at least one
+	size_t nintervals = fTable.GetNKnots(0) - 1;
+
+	nchecks = ((nchecks + nintervals - 1)/nintervals)*nintervals;
+
+	hydra::thrust::counting_iterator<size_t> first(0);
+
+	// fresh points for each tabulation
+	size_t seed = 0x9e3779b9 + fNTabulations;
+
+	return hydra::thrust::transform_reduce(device_system_type(), first, first + nchecks,
+			detail::tabulated::Deviation<Functor, table_type, ArgType>(fFunctor, fTable, fMin, fMax, nintervals + 1, seed),
+			0.0, hydra::thrust::maximum<double>());
+}
+
+template<typename Functor, detail::Backend BACKEND, typename ArgType>
+double TabulatedFunctor<Functor, detail::BackendPolicy<BACKEND>, ArgType>::Integral(double lower, double upper) const
+{
+	double tolerance = 1.0e-12*(fMax - fMin);
+
+	if( (lower < upper ? lower : upper) < fMin - tolerance || (lower < upper ? upper : lower) > fMax + tolerance )
+		throw std::invalid_argument("[hydra::TabulatedFunctor]: Integration range beyond the tabulated range. ([lower, upper] not in [min, max])");
+
+	return fTable.Integral(lower, upper);
+}
+
+}  // namespace hydra
+
+#endif /* TABULATEDFUNCTOR_INL_ */